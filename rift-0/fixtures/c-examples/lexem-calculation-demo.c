@@ -10,6 +10,7 @@
  */
 
 #include "rift-0/core/tokenizer_rules.h"
+#include "rift-0/core/parser/rift_pratt.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -277,44 +278,98 @@ static void print_token_analysis(CalculationContext *ctx) {
     }
 }
 
+/* Operand values and evaluation state for the tree walk */
+typedef struct {
+    const TokenizationResult *tokens;
+    const char *source;
+    double values[64];
+    size_t depth;
+    bool failed;
+} ExpressionEvaluator;
+
+static void evaluate_node(const FlatTree *tree, uint32_t node, void *user_data) {
+    ExpressionEvaluator *e = (ExpressionEvaluator *)user_data;
+    uint32_t kind = tree->kinds[node];
+    
+    if (e->failed) return;
+    
+    if (flat_tree_is_terminal(tree, node)) {
+        /* Only numeric literals have a value in this demo */
+        const TokenTriplet *token = &e->tokens->tokens[tree->nodes[node].first_token];
+        if (token->type != TOKEN_LITERAL_NUMBER || e->depth == 64) {
+            e->failed = true;
+            return;
+        }
+        e->values[e->depth++] = atof(e->source + token->mem_ptr);
+        return;
+    }
+    
+    if (RIFT_PRATT_FIXITY(kind) == RIFT_PRATT_PREFIX) {
+        e->values[e->depth - 1] = -e->values[e->depth - 1];
+        return;
+    }
+    
+    double right = e->values[--e->depth];
+    double *left = &e->values[e->depth - 1];
+    switch (RIFT_PRATT_KEY(kind)) {
+        case '+': *left += right; break;
+        case '-': *left -= right; break;
+        case '*': *left *= right; break;
+        case '/': *left = (right != 0.0) ? *left / right : NAN; break;
+        default: e->failed = true; break;
+    }
+}
+
 /**
- * Simple mathematical expression evaluator for demonstration
- * Note: This is a simplified evaluator for demonstration purposes
+ * Mathematical expression evaluator for demonstration
+ * Parses the token stream with the library's precedence parser and
+ * folds the tree; only numeric expressions have a value.
  */
 static double evaluate_simple_expression(const TokenizationResult *tokens, const char *source) {
     if (!tokens || !tokens->success || tokens->count == 0) {
         return NAN;
     }
     
-    /* For demonstration, handle simple binary operations */
-    if (tokens->count == 3) {
-        /* Pattern: number operator number */
-        if (tokens->tokens[0].type == TOKEN_LITERAL_NUMBER &&
-            tokens->tokens[1].type == TOKEN_OPERATOR &&
-            tokens->tokens[2].type == TOKEN_LITERAL_NUMBER) {
-            
-            /* Extract operands */
-            double left = atof(source + tokens->tokens[0].mem_ptr);
-            double right = atof(source + tokens->tokens[2].mem_ptr);
-            char operator = *(source + tokens->tokens[1].mem_ptr);
-            
-            /* Perform operation */
-            switch (operator) {
-                case '+': return left + right;
-                case '-': return left - right;
-                case '*': return left * right;
-                case '/': return (right != 0.0) ? left / right : NAN;
-                default: return NAN;
+    /* Binding powers follow the precedence classes below */
+    RiftPratt *pratt = rift_pratt_create();
+    FlatTree *tree = flat_tree_create(0);
+    uint32_t *keys = malloc(tokens->count * sizeof(uint32_t));
+    double result = NAN;
+    
+    if (pratt && tree && keys) {
+        rift_pratt_add_operand(pratt, RIFT_PRATT_TYPE_KEY(TOKEN_LITERAL_NUMBER));
+        rift_pratt_add_operand(pratt, RIFT_PRATT_TYPE_KEY(TOKEN_IDENTIFIER));
+        rift_pratt_add_infix(pratt, '+', 1, RIFT_PRATT_LEFT);
+        rift_pratt_add_infix(pratt, '-', 1, RIFT_PRATT_LEFT);
+        rift_pratt_add_infix(pratt, '*', 2, RIFT_PRATT_LEFT);
+        rift_pratt_add_infix(pratt, '/', 2, RIFT_PRATT_LEFT);
+        rift_pratt_add_prefix(pratt, '-', 3);
+        rift_pratt_add_group(pratt, '(', ')');
+        
+        /* Literals and names by type, operators and brackets by character */
+        for (size_t i = 0; i < tokens->count; i++) {
+            const TokenTriplet *token = &tokens->tokens[i];
+            if (token->type == TOKEN_LITERAL_NUMBER || token->type == TOKEN_IDENTIFIER) {
+                keys[i] = RIFT_PRATT_TYPE_KEY(token->type);
+            } else {
+                keys[i] = RIFT_PRATT_CHAR_KEY(source[token->mem_ptr]);
             }
         }
+        
+        /* A single expression tree; statements and calls are not evaluated */
+        size_t error_token;
+        if (rift_pratt_parse(pratt, keys, tokens->count, tree, &error_token) == 0 &&
+            tree->count > 0 && tree->nodes[0].subtree_size == tree->count) {
+            ExpressionEvaluator e = { tokens, source, { 0 }, 0, false };
+            flat_tree_visit(tree, 0, NULL, evaluate_node, &e);
+            if (!e.failed && e.depth == 1) result = e.values[0];
+        }
     }
     
-    /* Handle single number */
-    if (tokens->count == 1 && tokens->tokens[0].type == TOKEN_LITERAL_NUMBER) {
-        return atof(source + tokens->tokens[0].mem_ptr);
-    }
-    
-    return NAN; /* Complex expressions not supported in this demo */
+    free(keys);
+    flat_tree_destroy(tree);
+    rift_pratt_destroy(pratt);
+    return result;
 }
 
 /**
@@ -14,6 +14,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "rift-0/core/tokenizer_rules.h"
+#include "rift-0/core/lexer/tokenizer_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,100 @@
+/**
+ * =================================================================
+ * batch_command.h - RIFT-0 Batch Tokenization Command
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Parallel tokenization of file sets
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#ifndef RIFT_0_BATCH_COMMAND_H
+#define RIFT_0_BATCH_COMMAND_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "rift-0/cli/clli.h"
+#include "rift-0/core/rift_common.h"
+#include "rift-0/core/rift_workpool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Files larger than this are split into line-aligned sub-tasks */
+#define RIFT_BATCH_DEFAULT_CHUNK_SIZE (256 * 1024)
+
+/**
+ * Batch run options
+ */
+typedef struct {
+    int thread_count;           /* Worker threads; <= 0 selects online CPUs */
+    size_t chunk_size;          /* Split threshold; 0 selects the default */
+    bool verbose;               /* Per-chunk detail in the report */
+    FILE* output;               /* Per-file report in input order; NULL for none */
+    rift_placement_policy_t placement; /* Zeroed leaves workers unpinned */
+} RiftBatchOptions;
+
+/**
+ * Batch run summary
+ */
+typedef struct {
+    size_t files;
+    size_t failed;
+    size_t chunks;
+    size_t bytes;
+    size_t tokens;
+    double elapsed;             /* Wall-clock seconds */
+
+    /* Where the work ran, by each worker's home NUMA node */
+    size_t node_count;
+    RiftWorkPoolNodeStats nodes[RIFT_WORKPOOL_MAX_NODES];
+} RiftBatchSummary;
+
+/**
+ * Expand command-line operands into a file list
+ * Directories are walked recursively (hidden entries skipped, sorted),
+ * "@file" operands name a list file with one path per line, anything
+ * else is taken as a file path.
+ *
+ * @param operands Operand strings
+ * @param operand_count Number of operands
+ * @param paths Output array of heap-allocated paths (free with rift_batch_free_paths)
+ * @param count Output number of paths
+ * @return 0 on success, negative on error
+ */
+int rift_batch_collect_paths(char** operands, int operand_count,
+                             char*** paths, size_t* count);
+
+void rift_batch_free_paths(char** paths, size_t count);
+
+/**
+ * Tokenize a set of files on a work-stealing pool
+ * Report lines are written in input order as soon as every earlier
+ * file has finished.
+ *
+ * @param paths File paths
+ * @param count Number of files
+ * @param options Run options
+ * @param summary Optional output summary
+ * @return 0 if every file was tokenized, negative otherwise
+ */
+int rift_batch_tokenize(const char* const* paths, size_t count,
+                        const RiftBatchOptions* options,
+                        RiftBatchSummary* summary);
+
+/**
+ * Entry point for "riftlang batch [-j N] [-v] [--pin MODE] <dir|@list|file>..."
+ *
+ * @param argc Argument count (argv[0] is "batch")
+ * @param argv Argument vector
+ * @return CLIExitCode
+ */
+int batch_command_main(int argc, char** argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_BATCH_COMMAND_H */
@@ -0,0 +1,103 @@
+/*
+ * =================================================================
+ * gov_cache.h - RIFT-0 Governance Configuration Cache
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Stat-validated cache of parsed governance records
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Maps a configuration file's path to the fixed-size record parsed
+ * from it. A lookup whose stat (device, inode, size, mtime) matches
+ * the entry is answered without opening the file. When the stat
+ * differs, or the file changed within the second it was last
+ * verified in, the contents are read and hashed; identical bytes
+ * still skip the parse. Only successful parses are stored.
+ *
+ * The in-memory table lives as long as the cache; it can be seeded
+ * from and saved to a cache file, replaced by atomic rename. The
+ * file's checksum is unkeyed and only catches corruption, so records
+ * loaded from it go through a validate hook before they are used.
+ * =================================================================
+ */
+
+#ifndef RIFT_GOV_CACHE_H
+#define RIFT_GOV_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped whenever the cache file layout changes */
+#define RIFT_GOV_CACHE_FORMAT   1
+
+typedef struct RiftGovCache RiftGovCache;
+
+/**
+ * Parse a configuration into record. content is NUL-terminated.
+ * @return 0 on success; any other value is handed back to the caller
+ *         and nothing is cached
+ */
+typedef int (*RiftGovParseFn)(const char* content,
+                              size_t length,
+                              void* record,
+                              void* user_data);
+
+/**
+ * Check a record read back from a cache file. It may repair the record
+ * in place, e.g. terminate strings or recompute derived fields. Runs
+ * with the cache locked, so it must not call back into the cache.
+ * @return false to drop the entry; the file is then parsed on lookup
+ */
+typedef bool (*RiftGovValidateFn)(void* record, void* user_data);
+
+/* Cache statistics */
+typedef struct {
+    size_t stat_hits;           /* Answered from the stat alone */
+    size_t content_hits;        /* Read and hashed, but not parsed */
+    size_t parses;
+    size_t entries;
+    size_t rejected;            /* Loaded records the validator dropped */
+} RiftGovCacheStats;
+
+/* Records are record_size bytes; record_version is part of the key of
+ * every entry, so bumping it retires cache files of an older layout */
+RiftGovCache* rift_gov_cache_create(size_t record_size, uint32_t record_version);
+void rift_gov_cache_destroy(RiftGovCache* cache);
+
+/* Validate records from cache files; without one they are used as read */
+void rift_gov_cache_set_validator(RiftGovCache* cache,
+                                  RiftGovValidateFn validate,
+                                  void* user_data);
+
+/**
+ * Fill record for the file at path, parsing it only when it changed
+ * @return 0 on success, -1 when the file cannot be read, otherwise
+ *         the parse function's result
+ */
+int rift_gov_cache_get(RiftGovCache* cache,
+                       const char* path,
+                       RiftGovParseFn parse,
+                       void* user_data,
+                       void* record);
+
+/**
+ * Add the entries of a cache file for paths not cached yet. A file is
+ * read once per cache; later calls return 0.
+ * @return Entries added, -1 if the file is missing or invalid
+ */
+int rift_gov_cache_load(RiftGovCache* cache, const char* file);
+
+/* Write every entry to file if anything changed since the last load or
+ * save; 0 on success */
+int rift_gov_cache_save(RiftGovCache* cache, const char* file);
+
+void rift_gov_cache_get_stats(RiftGovCache* cache, RiftGovCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_GOV_CACHE_H */
@@ -0,0 +1,76 @@
+/*
+ * =================================================================
+ * heap_queue.h - RIFT-0 Concurrent Priority Queue
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Concurrent priority queue (library API)
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * A relaxed multi-queue: items live in several independently locked,
+ * growable binary min-heaps. Producers push into whichever shard they
+ * can lock without waiting; consumers compare the published minimum
+ * of two random shards and pop from the better one. Dequeue order is
+ * therefore approximately, not strictly, by priority. A queue created
+ * with a single shard is an exact min-heap.
+ *
+ * Nothing in Stage-0 schedules through it yet; rift_scheduler keeps
+ * its own FIFO of unstarted jobs.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_HEAP_QUEUE_H
+#define RIFT_0_HEAP_QUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Shared with the forward declarations in the Stage-0 sources */
+#ifndef HEAPQUEUE_FORWARD_DECLARED
+#define HEAPQUEUE_FORWARD_DECLARED
+struct HeapQueue;
+typedef struct HeapQueue HeapQueue;
+
+typedef struct {
+    int priority;
+    int value;
+} Item;
+#endif
+
+/* Upper bound on shards chosen automatically */
+#define HQ_MAX_SHARDS 64
+
+/* Lifecycle; capacity is an initial size hint, the queue grows */
+HeapQueue* hq_create(int capacity);
+HeapQueue* hq_create_sharded(int capacity, int shard_count);
+void hq_destroy(HeapQueue* hq);
+
+/* Returns 0, or -1 if the queue is closed or memory ran out */
+int hq_enqueue(HeapQueue* hq, int priority, int value);
+int hq_enqueue_batch(HeapQueue* hq, const Item* items, size_t count);
+
+/* Non-blocking pop; false when the queue is empty */
+bool hq_try_dequeue(HeapQueue* hq, Item* out);
+
+/* Non-blocking pop kept for existing callers; {0, 0} when empty */
+Item hq_dequeue(HeapQueue* hq);
+
+/* Blocking pop; timeout_ms < 0 waits indefinitely.
+ * Returns 0 with an item, -1 on timeout or once closed and drained. */
+int hq_dequeue_timed(HeapQueue* hq, Item* out, int timeout_ms);
+
+/* Pop up to max items, lowest priorities first within each shard */
+size_t hq_dequeue_batch(HeapQueue* hq, Item* out, size_t max);
+
+/* Reject further enqueues and wake every blocked consumer */
+void hq_close(HeapQueue* hq);
+
+size_t hq_size(const HeapQueue* hq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_HEAP_QUEUE_H */
@@ -18,20 +18,9 @@ void lexer_set_flag(LexerContext* ctx, int flag); /* RIFT_CLEANUP: Fixed incompl
 #include <pthread.h>
 
 // =====================
-// Heap-based Priority Queue (thread-safe)
+// Priority Queue (sharded, growable; see heap_queue.h)
 // =====================
-
-typedef struct Item {
-    int priority;
-    int value;
-} Item;
-
-typedef struct HeapQueue {
-    Item* heap;
-    int size;
-    int capacity;
-    pthread_mutex_t lock;
-} HeapQueue;
+#include "rift-0/core/lexer/heap_queue.h"
 
 typedef struct State {
     char* pattern;
@@ -78,11 +67,6 @@ typedef struct TokenNode {
     void* memory;
 } TokenNode;
 
-HeapQueue* hq_create(int capacity);
-void hq_destroy(HeapQueue* hq);
-void hq_enqueue(HeapQueue* hq, int priority, int value);
-Item hq_dequeue(HeapQueue* hq);
-
 Flags flag);
 void lexer_clear_flag(LexerContext* ctx, LexerFlags flag);
 bool lexer_flag_enabled(const LexerContext* ctx, LexerFlags flag);
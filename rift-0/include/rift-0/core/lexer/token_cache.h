@@ -0,0 +1,90 @@
+/*
+ * =================================================================
+ * token_cache.h - RIFT-0 Content-Addressed Tokenization Cache
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Persistent on-disk cache of TokenTriplet streams
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Entries are keyed by a hash of the input bytes, the active rule-set
+ * and the tokenizer version. Hits are served by mmap; stores are
+ * published with an atomic rename; the directory is kept under a
+ * byte budget by evicting least-recently-used entries.
+ * =================================================================
+ */
+
+#ifndef RIFT_TOKEN_CACHE_H
+#define RIFT_TOKEN_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rift-0/core/lexer/tokenizer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped whenever the on-disk entry layout changes */
+#define RIFT_TOKEN_CACHE_FORMAT        1
+#define RIFT_TOKEN_CACHE_SUFFIX        ".rtc"
+#define RIFT_TOKEN_CACHE_DEFAULT_BYTES (256u * 1024u * 1024u)
+
+typedef struct RiftTokenCache RiftTokenCache;
+
+/* Cache configuration */
+typedef struct {
+    const char* directory;      /* Created if missing */
+    size_t max_bytes;           /* 0 selects RIFT_TOKEN_CACHE_DEFAULT_BYTES */
+} RiftTokenCacheConfig;
+
+/* Mapped cache hit; tokens stay valid until rift_token_cache_release */
+typedef struct {
+    const TokenTriplet* tokens;
+    size_t count;
+    void* mapping;
+    size_t mapping_size;
+} RiftTokenCacheHit;
+
+/* Cache statistics */
+typedef struct {
+    size_t hits;
+    size_t misses;
+    size_t stores;
+    size_t evictions;
+    size_t bytes_on_disk;
+} RiftTokenCacheStats;
+
+/* Lifecycle */
+RiftTokenCache* rift_token_cache_open(const RiftTokenCacheConfig* config);
+void rift_token_cache_close(RiftTokenCache* cache);
+
+/* Hash identifying a rule-set; part of every cache key */
+uint64_t rift_token_cache_ruleset_hash(const TokenizerContext* tokenizer);
+
+/* Lookup and store, keyed by (input bytes, ruleset_hash, tokenizer version) */
+bool rift_token_cache_lookup(RiftTokenCache* cache,
+                             const char* input,
+                             size_t length,
+                             uint64_t ruleset_hash,
+                             RiftTokenCacheHit* hit);
+void rift_token_cache_release(RiftTokenCacheHit* hit);
+
+int rift_token_cache_store(RiftTokenCache* cache,
+                           const char* input,
+                           size_t length,
+                           uint64_t ruleset_hash,
+                           const TokenTriplet* tokens,
+                           size_t count);
+
+/* Evict LRU entries until the directory fits the byte budget */
+size_t rift_token_cache_evict(RiftTokenCache* cache);
+
+void rift_token_cache_get_stats(const RiftTokenCache* cache,
+                                RiftTokenCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_TOKEN_CACHE_H */
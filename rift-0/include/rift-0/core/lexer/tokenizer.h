@@ -58,6 +58,18 @@ bool rift_tokenizer_lock(TokenizerContext* ctx);
 bool rift_tokenizer_unlock(TokenizerContext* ctx);
 bool rift_tokenizer_trylock(TokenizerContext* ctx);
 
+/* Stage lifecycle; each context owns its state, so distinct contexts
+ * may be processed concurrently without any shared lock */
+rift_tokenizer_context_t* rift_tokenizer_init(rift_tokenizer_config_t* config);
+rift_tokenizer_result_t rift_tokenizer_process(rift_tokenizer_context_t* ctx,
+                                               const void* input,
+                                               size_t input_size,
+                                               void** output,
+                                               size_t* output_size);
+rift_tokenizer_result_t rift_tokenizer_validate(rift_tokenizer_context_t* ctx);
+void rift_tokenizer_cleanup(rift_tokenizer_context_t* ctx);
+const char* rift_tokenizer_version(void);
+
 #ifdef __cplusplus
 }
 #endif
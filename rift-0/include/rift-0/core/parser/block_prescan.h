@@ -0,0 +1,57 @@
+/*
+ * =================================================================
+ * block_prescan.h - RIFT-0 Top-Level Block Prescan
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Splitting sources into independently parsable blocks
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * A RIFT source is a run of top-level units: brace blocks such as
+ * function bodies and @quantum { ... }, and the !classic / !quantum /
+ * !collapse sections between them. The prescan tracks brace depth
+ * outside strings and comments and cuts the input into contiguous
+ * blocks: after the line on which a top-level brace block closes, and
+ * before a line that opens with a '!' directive at depth zero.
+ *
+ * Only structural bytes ({ } " / * \ and newline) are looked at; with
+ * SSE2 they are found sixteen bytes at a time, and the state machine
+ * runs once per structural byte rather than once per byte.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_BLOCK_PRESCAN_H
+#define RIFT_0_BLOCK_PRESCAN_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bytes [start, end) of the input */
+typedef struct {
+    size_t start;
+    size_t end;
+} RiftBlockSpan;
+
+/* Reusable across scans; zero-initialize before first use */
+typedef struct {
+    RiftBlockSpan* spans;
+    size_t count;
+    size_t capacity;
+} RiftBlockList;
+
+/**
+ * Split input into top-level blocks that together cover it, replacing
+ * the list's contents. Unbalanced braces leave the rest of the input in
+ * one block.
+ * @return 0 on success, -1 when out of memory
+ */
+int rift_block_prescan(const char* input, size_t length, RiftBlockList* list);
+
+void rift_block_list_free(RiftBlockList* list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_BLOCK_PRESCAN_H */
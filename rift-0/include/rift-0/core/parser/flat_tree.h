@@ -0,0 +1,117 @@
+/*
+ * =================================================================
+ * flat_tree.h - RIFT-0 Flat Parse Tree
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Contiguous pre-order parse trees
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Every node sits in one array in pre-order, so a node's subtree is
+ * the run [node, node + subtree_size) and walking the tree is a
+ * forward scan. The first child of a node is node + 1 and its next
+ * sibling is node + subtree_size while that stays inside the parent.
+ * Node kinds live in a side array so passes that only dispatch on the
+ * kind touch four bytes per node.
+ *
+ * Trees are built bottom-up: a shift-reduce parser appends each node
+ * after its whole subtree (post-order), and finishing reorders the
+ * array to pre-order in one linear pass.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_FLAT_TREE_H
+#define RIFT_0_FLAT_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLAT_TREE_NONE      UINT32_MAX
+#define FLAT_TREE_TERMINAL  0x80000000u     /* Kind bit: leaf for a token type */
+
+typedef struct {
+    uint32_t subtree_size;          /* Nodes in the subtree, itself included */
+    uint32_t parent;                /* FLAT_TREE_NONE for a root */
+    uint32_t first_token;           /* Token span [first_token, end_token) */
+    uint32_t end_token;
+} FlatTreeNode;
+
+typedef struct {
+    FlatTreeNode* nodes;
+    uint32_t* kinds;                /* Production, or FLAT_TREE_TERMINAL | type */
+    uint32_t count;
+    uint32_t capacity;
+    bool finished;                  /* Pre-order; false while appending */
+} FlatTree;
+
+typedef enum {
+    FLAT_TREE_CONTINUE,             /* Descend into the children */
+    FLAT_TREE_SKIP,                 /* Go on past this subtree */
+    FLAT_TREE_STOP                  /* End the walk */
+} FlatTreeVisit;
+
+typedef FlatTreeVisit (*FlatTreeEnterFn)(const FlatTree* tree, uint32_t node, void* user_data);
+typedef void (*FlatTreeLeaveFn)(const FlatTree* tree, uint32_t node, void* user_data);
+
+FlatTree* flat_tree_create(uint32_t initial_capacity);
+void flat_tree_destroy(FlatTree* tree);
+
+/* Drop every node, keeping the storage */
+void flat_tree_clear(FlatTree* tree);
+
+/**
+ * Append a node after the subtree_size - 1 nodes that form its subtree
+ * @return Post-order index, FLAT_TREE_NONE when out of memory or the
+ *         size does not fit the nodes appended so far
+ */
+uint32_t flat_tree_append(FlatTree* tree,
+                          uint32_t kind,
+                          uint32_t subtree_size,
+                          uint32_t first_token,
+                          uint32_t end_token);
+
+/* Reorder the appended nodes to pre-order and fill in parents */
+bool flat_tree_finish(FlatTree* tree);
+
+/**
+ * Append a finished forest after the roots of a finished (or empty)
+ * tree, adding token_offset to its token spans. Trees of separately
+ * parsed pieces are stitched this way; the result stays finished.
+ */
+bool flat_tree_splice(FlatTree* tree, const FlatTree* forest, uint32_t token_offset);
+
+/**
+ * Depth-first walk of the subtree at root. enter sees nodes in
+ * pre-order, leave in post-order; either may be NULL. A skipped node
+ * is still left; nothing is left after a stop.
+ */
+void flat_tree_visit(const FlatTree* tree,
+                     uint32_t root,
+                     FlatTreeEnterFn enter,
+                     FlatTreeLeaveFn leave,
+                     void* user_data);
+
+static inline bool flat_tree_is_terminal(const FlatTree* tree, uint32_t node) {
+    return (tree->kinds[node] & FLAT_TREE_TERMINAL) != 0;
+}
+
+static inline uint32_t flat_tree_first_child(const FlatTree* tree, uint32_t node) {
+    return tree->nodes[node].subtree_size > 1 ? node + 1 : FLAT_TREE_NONE;
+}
+
+static inline uint32_t flat_tree_next_sibling(const FlatTree* tree, uint32_t node) {
+    uint32_t parent = tree->nodes[node].parent;
+    uint32_t next = node + tree->nodes[node].subtree_size;
+    uint32_t limit = parent == FLAT_TREE_NONE ? tree->count
+                                              : parent + tree->nodes[parent].subtree_size;
+    return next < limit ? next : FLAT_TREE_NONE;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_FLAT_TREE_H */
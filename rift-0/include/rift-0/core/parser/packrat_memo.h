@@ -0,0 +1,70 @@
+/*
+ * =================================================================
+ * packrat_memo.h - RIFT-0 Packrat Memo Table
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: (rule, offset) match memoization for recursive descent
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * One column per rule, each a ring of `window` cells indexed by input
+ * offset. A cell holds the offset it describes next to the result, so
+ * an offset that falls out of the window is simply overwritten by the
+ * one `window` bytes ahead and memory stays rules * window words however
+ * long the input is. Every cell is a single 64-bit word read and written
+ * with relaxed atomics: concurrent passes over the same input store the
+ * same result for the same key, so they may share one table.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_PACKRAT_MEMO_H
+#define RIFT_0_PACKRAT_MEMO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PACKRAT_DEFAULT_WINDOW  1024            /* Offsets kept per rule */
+#define PACKRAT_MAX_LENGTH      0xFFFFFE        /* Longer matches are not kept */
+
+typedef enum {
+    PACKRAT_UNKNOWN = 0,            /* Never tried, or evicted */
+    PACKRAT_FAIL,
+    PACKRAT_MATCH
+} PackratResult;
+
+typedef struct {
+    size_t rule_count;
+    size_t window;                  /* Power of two */
+    uint64_t base;                  /* Key of offset 0 in the current input */
+    uint64_t span;                  /* Keys the current input may use */
+    _Atomic(uint64_t)* cells;       /* rule_count columns of window cells */
+} PackratMemo;
+
+/* window is rounded up to a power of two; 0 selects the default */
+PackratMemo* packrat_memo_create(size_t rule_count, size_t window);
+void packrat_memo_destroy(PackratMemo* memo);
+
+/* Start a new input of `length` bytes; earlier entries stop matching */
+void packrat_memo_begin(PackratMemo* memo, size_t length);
+
+/* Memoized result of `rule` at `offset`, with the match length */
+PackratResult packrat_memo_lookup(const PackratMemo* memo,
+                                  size_t rule,
+                                  size_t offset,
+                                  size_t* length);
+
+void packrat_memo_store(PackratMemo* memo,
+                        size_t rule,
+                        size_t offset,
+                        bool matched,
+                        size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_PACKRAT_MEMO_H */
@@ -0,0 +1,51 @@
+/*
+ * =================================================================
+ * parse_arena.h - RIFT-0 Parse Arena
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Bump allocation for per-parse nodes
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Allocations are carved from a chain of chunks and never freed one
+ * at a time. Resetting rewinds to the first chunk in O(1) and keeps
+ * every chunk for the next parse, so a parser that has warmed up
+ * allocates nothing. One owner at a time; not thread safe.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_PARSE_ARENA_H
+#define RIFT_0_PARSE_ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PARSE_ARENA_DEFAULT_CHUNK   (64 * 1024)
+
+typedef struct ParseArenaChunk ParseArenaChunk;
+
+typedef struct {
+    ParseArenaChunk* head;
+    ParseArenaChunk* current;
+    size_t used;                    /* Bytes taken from current */
+    size_t chunk_size;
+} ParseArena;
+
+ParseArena* parse_arena_create(size_t chunk_size);
+void parse_arena_destroy(ParseArena* arena);
+
+/* Suitably aligned for any type; NULL when out of memory */
+void* parse_arena_alloc(ParseArena* arena, size_t size);
+
+/* NUL-terminated copy of length bytes */
+char* parse_arena_strndup(ParseArena* arena, const char* text, size_t length);
+
+/* Invalidate every allocation, keeping the chunks */
+void parse_arena_reset(ParseArena* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_PARSE_ARENA_H */
@@ -0,0 +1,147 @@
+/*
+ * =================================================================
+ * rift_grammar.h - RIFT-0 LALR(1) Grammar Engine
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: BNF productions, LALR(1) tables and shift-reduce driver
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Productions are given as BNF text:
+ *
+ *     expr   : expr PLUS term | term ;
+ *     term   : term STAR factor | factor ;
+ *     factor : LPAREN expr RPAREN | NUM ;
+ *
+ * A symbol is a nonterminal if it appears left of ':' and a terminal
+ * if it was bound to a token type; the first left-hand side is the
+ * start symbol and an empty alternative derives nothing. Building
+ * produces LALR(1) action and goto tables packed by row displacement
+ * (base/next/check, with a default reduction per state and a default
+ * target per nonterminal). Conflicts are resolved as yacc does, in
+ * favour of the shift or of the earlier production, and counted.
+ *
+ * Parsing is a table-driven loop over token types: one lookup per
+ * shift or reduce, linear in the token count.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_GRAMMAR_H
+#define RIFT_0_GRAMMAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rift-0/core/parser/flat_tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_GRAMMAR_MAX_TOKEN_TYPE 0xFFFF
+
+typedef struct RiftGrammar RiftGrammar;
+
+/* A production was reduced over tokens [first_token, end_token) */
+typedef void (*RiftReduceFn)(uint32_t production,
+                             size_t first_token,
+                             size_t end_token,
+                             void* user_data);
+
+typedef struct {
+    size_t terminals;               /* Including the end marker */
+    size_t nonterminals;
+    size_t productions;
+    size_t states;
+    size_t shift_reduce_conflicts;
+    size_t reduce_reduce_conflicts;
+    size_t table_entries;           /* Packed action plus goto slots */
+} RiftGrammarStats;
+
+RiftGrammar* rift_grammar_create(void);
+void rift_grammar_destroy(RiftGrammar* grammar);
+
+/* Bind a grammar symbol to the token type the tokenizer produces */
+int rift_grammar_add_terminal(RiftGrammar* grammar, const char* name, uint32_t token_type);
+
+/**
+ * Append BNF productions
+ * @return Number of productions added, -1 on a syntax error
+ */
+int rift_grammar_add_rules(RiftGrammar* grammar, const char* bnf);
+
+/**
+ * Build the LALR(1) tables; later additions require a rebuild
+ * @return 0 on success, -1 with rift_grammar_error set
+ */
+int rift_grammar_build(RiftGrammar* grammar);
+
+bool rift_grammar_is_built(const RiftGrammar* grammar);
+
+/* Last build or rule error, "" if none */
+const char* rift_grammar_error(const RiftGrammar* grammar);
+
+/* Left-hand side of a production, numbered in the order added */
+const char* rift_grammar_production_name(const RiftGrammar* grammar, uint32_t production);
+
+/**
+ * Shift-reduce parse of a token type sequence
+ * Token types that are not bound to a terminal are skipped. on_reduce
+ * may be NULL. Safe to call concurrently on a built grammar.
+ *
+ * @param error_token Set to the offending token index on a syntax error
+ *                    (count when the input ended early)
+ * @return 0 when the input is accepted, -1 otherwise
+ */
+int rift_grammar_parse(const RiftGrammar* grammar,
+                       const uint32_t* token_types,
+                       size_t count,
+                       RiftReduceFn on_reduce,
+                       void* user_data,
+                       size_t* error_token);
+
+/**
+ * rift_grammar_parse that also records the parse as a flat tree: one
+ * node per reduction (kind = production) and per shifted token (kind =
+ * FLAT_TREE_TERMINAL | token type). The tree is cleared first and is
+ * only complete, in pre-order, when the input is accepted.
+ */
+int rift_grammar_parse_tree(const RiftGrammar* grammar,
+                            const uint32_t* token_types,
+                            size_t count,
+                            RiftReduceFn on_reduce,
+                            void* user_data,
+                            FlatTree* tree,
+                            size_t* error_token);
+
+/* Push-mode parse: tokens are fed one at a time as they are produced,
+ * and each reduction is reported as soon as the lookahead decides it.
+ * Memory grows with nesting depth only, never with input length. The
+ * grammar must stay built while a push parse is in progress. */
+typedef struct RiftGrammarPush RiftGrammarPush;
+
+RiftGrammarPush* rift_grammar_push_create(const RiftGrammar* grammar,
+                                          RiftReduceFn on_reduce,
+                                          void* user_data);
+void rift_grammar_push_destroy(RiftGrammarPush* push);
+
+/**
+ * Feed the next token type. Unbound types are skipped but still count
+ * toward token indices.
+ * @return 0, or -1 on a syntax error, after which every call fails
+ */
+int rift_grammar_push_token(RiftGrammarPush* push, uint32_t token_type);
+
+/**
+ * End of input
+ * @param error_token Set as by rift_grammar_parse when not accepted
+ * @return 0 when the tokens fed form a sentence, -1 otherwise
+ */
+int rift_grammar_push_finish(RiftGrammarPush* push, size_t* error_token);
+
+void rift_grammar_get_stats(const RiftGrammar* grammar, RiftGrammarStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_GRAMMAR_H */
@@ -0,0 +1,89 @@
+/*
+ * =================================================================
+ * rift_pratt.h - RIFT-0 Operator-Precedence Expression Parser
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Pratt parsing of classic-mode expressions
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Tokens are given as keys (a token type, an operator character, or
+ * any caller numbering below RIFT_PRATT_MAX_KEY). Each key is bound to
+ * one or more roles: operand, prefix, infix or postfix operator, group
+ * bracket or expression separator. An operator's precedence level and
+ * associativity become a pair of binding powers; a key that is both
+ * prefix and infix (unary and binary minus) is read by position.
+ *
+ * Parsing keeps explicit operand and operator stacks instead of
+ * recursing, so nesting depth is bounded by memory alone, and each
+ * token is shifted and reduced once. The result is a flat tree: leaves
+ * are FLAT_TREE_TERMINAL | key and operator nodes carry their fixity
+ * and key. Consecutive expressions, split by a separator or simply by
+ * an operand where an operator was expected, become sibling roots.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_PRATT_H
+#define RIFT_0_PRATT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rift-0/core/parser/flat_tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_PRATT_MAX_KEY      0x00FFFFFF
+#define RIFT_PRATT_MAX_LEVEL    0x7FFE
+
+/* Key conventions for the stage-0 tokenizer: single-character operators
+ * and delimiters by character, every other token by type */
+#define RIFT_PRATT_CHAR_KEY(c)  ((uint32_t)(unsigned char)(c))
+#define RIFT_PRATT_TYPE_KEY(t)  (0x100u + (uint32_t)(t))
+
+/* Operator node kinds in the tree */
+#define RIFT_PRATT_PREFIX       0x10000000u
+#define RIFT_PRATT_INFIX        0x20000000u
+#define RIFT_PRATT_POSTFIX      0x30000000u
+#define RIFT_PRATT_FIXITY(kind) ((kind) & 0x70000000u)
+#define RIFT_PRATT_KEY(kind)    ((kind) & RIFT_PRATT_MAX_KEY)
+
+typedef enum {
+    RIFT_PRATT_LEFT,
+    RIFT_PRATT_RIGHT
+} RiftPrattAssoc;
+
+typedef struct RiftPratt RiftPratt;
+
+RiftPratt* rift_pratt_create(void);
+void rift_pratt_destroy(RiftPratt* pratt);
+
+/* Binding; levels run from 1 (loosest) to RIFT_PRATT_MAX_LEVEL */
+int rift_pratt_add_operand(RiftPratt* pratt, uint32_t key);
+int rift_pratt_add_prefix(RiftPratt* pratt, uint32_t key, uint16_t level);
+int rift_pratt_add_infix(RiftPratt* pratt, uint32_t key, uint16_t level, RiftPrattAssoc assoc);
+int rift_pratt_add_postfix(RiftPratt* pratt, uint32_t key, uint16_t level);
+int rift_pratt_add_group(RiftPratt* pratt, uint32_t open_key, uint32_t close_key);
+int rift_pratt_add_separator(RiftPratt* pratt, uint32_t key);
+
+/**
+ * Parse a key sequence into tree, clearing it first. Unbound keys are
+ * skipped. Groups add no node; they widen the token span of the
+ * expression inside them to include the brackets.
+ *
+ * @param error_token Set to the offending token index on a syntax error
+ *                    (count when the input ended early)
+ * @return 0 with a finished tree, -1 otherwise
+ */
+int rift_pratt_parse(const RiftPratt* pratt,
+                     const uint32_t* keys,
+                     size_t count,
+                     FlatTree* tree,
+                     size_t* error_token);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_PRATT_H */
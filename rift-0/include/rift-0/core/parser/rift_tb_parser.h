@@ -2,7 +2,7 @@
  * =================================================================
  * rift_tb_parser.h - RIFT Dual-Mode Top-Down/Bottom-Up Parser
  * RIFT: RIFT Is a Flexible Translator
- * Component: Dual-mode parsing with semaphore parity elimination
+ * Component: Dual-mode parsing with atomic parity elimination
  * OBINexus Computing Framework - AEGIS Compliant
  * 
  * Pattern: R"/[^A-Z0-9]\b/gmbi[tb]"
@@ -15,18 +15,23 @@
 #define RIFT_TB_PARSER_H
 
 #include <pthread.h>
-#include <semaphore.h>
 #include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <regex.h>
 
+#include "rift-0/core/parser/block_prescan.h"
+#include "rift-0/core/parser/packrat_memo.h"
+#include "rift-0/core/parser/parse_arena.h"
+#include "rift-0/core/parser/rift_grammar.h"
+#include "rift-0/core/rift_workpool.h"
+
 /* =================================================================
  * PARITY ELIMINATION CONSTANTS
  * =================================================================
  */
 
-#define PARITY_PATTERN      0b101001    /* Binary semaphore pattern */
+#define PARITY_PATTERN      0b101001    /* Initial parity bits */
 #define THREAD_PAIR_COUNT   2            /* Parent-child thread pairs */
 #define TB_PATTERN_STR      "tbtbbt"     /* Thread execution pattern */
 
@@ -44,14 +49,19 @@ typedef enum {
  */
 
 typedef struct {
-    regex_t* compiled_regex;         /* Compiled regex pattern */
+    regex_t* compiled_regex;         /* Compiled regex pattern (bottom-up) */
+    regex_t* td_regex;               /* Private copy for the top-down pass */
     char* pattern_str;               /* Original pattern string */
-    uint32_t flags;                  /* gmbi flags */
+    uint32_t flags;                  /* gmbi flags, as regcomp flags */
     ParseMode parse_mode;            /* [tb] mode flags */
     bool is_r_extension;            /* R extension for all R execution */
 } RiftRegexPattern;
 
-/* Token memory for bottom-up parsing */
+/* Token memory for bottom-up parsing. memory_value points at the
+ * lexeme inside the parsed input (lexeme_end - lexeme_start bytes, not
+ * NUL-terminated) and is only valid while the input is; with
+ * rift_tb_set_copy_lexemes it is instead a NUL-terminated copy that the
+ * caller frees. */
 typedef struct {
     uint32_t token_type;
     uint32_t token_value;
@@ -60,13 +70,27 @@ typedef struct {
     void* memory_value;              /* Bottom-up memory storage */
 } TokenMemory;
 
+/* Zero-copy view of a token range. Its first half is [0, mid) and its
+ * second [mid, count); membership is derived from the index rather than
+ * marked in token_type. A view owns nothing and stays valid as long as
+ * the array it looks into. */
+typedef struct {
+    const TokenMemory* tokens;       /* First token of the range */
+    size_t start;                    /* Index of tokens[0] in the source */
+    size_t count;
+    size_t mid;                      /* count / 2 */
+} TokenSliceView;
+
 /* =================================================================
- * SEMAPHORE-BASED PARITY ELIMINATION
+ * ATOMIC PARITY ELIMINATION
  * =================================================================
  */
 
+/* One eliminator per parser; nothing is shared across parsers or
+ * processes. parity_lock is 0 when free, 1 when held and 2 when held
+ * with waiters parked on it in the kernel. */
 typedef struct {
-    sem_t* parity_sem;               /* Parity elimination semaphore */
+    atomic_uint parity_lock;         /* Futex word guarding a parity turn */
     atomic_uint_fast32_t parity_state;  /* Current parity state */
     pthread_t threads[THREAD_PAIR_COUNT];
     bool thread_is_topdown[THREAD_PAIR_COUNT];
@@ -99,6 +123,9 @@ typedef struct {
     bool invariant_slicing;          /* Enable invariant logic slicing */
 } YodaConfig;
 
+/* Words of a per-token result bitmap; bit i of word i / 64 is token i */
+#define YODA_BITMAP_WORDS(count)    (((count) + 63) / 64)
+
 /* =================================================================
  * DUAL-MODE PARSER CONTEXT
  * =================================================================
@@ -113,32 +140,61 @@ typedef struct {
     ParityEliminator* parity_elim;
     pthread_mutex_t context_mutex;
     
+    /* Persistent worker for the top-down pass (NULL runs it inline) */
+    RiftWorkPool* workers;
+    
     /* Parse state */
     ParseMode current_mode;
     bool dual_mode_enabled;
+    bool copy_lexemes;               /* Output owns copies, not spans */
+    bool line_matching;              /* Every pattern has 'm': matches stop at line ends */
     
     /* Top-down state (recursive descent) */
     struct {
-        void* parse_stack;
         size_t recursion_depth;
         size_t max_recursion;
+        TokenMemory* token_scratch;  /* Reused across dual-mode calls */
+        PackratMemo* memo;           /* Packrat mode; shared with bottom-up */
+        ParseArena* arena;           /* Parse nodes; rewound every parse */
+        size_t packrat_window;       /* 0 while packrat mode is off */
+        size_t token_count;          /* Tokens the last dual-mode pass left */
     } td_state;
     
     /* Bottom-up state (shift-reduce) */
     struct {
-        TokenMemory* token_memory;
         size_t memory_size;
-        void* reduce_stack;
+        RiftGrammar* grammar;        /* LALR(1) rules; NULL until the first */
+        RiftReduceFn on_reduce;      /* Called for each reduction */
+        void* reduce_data;
+        uint32_t* type_scratch;      /* Token types fed to the grammar */
+        size_t type_capacity;
+        bool accepted;               /* Last parse formed a sentence */
+        FlatTree* tree;              /* Its parse tree, in pre-order */
+        size_t error_token;          /* Where it failed otherwise */
+        TokenMemory* relex_scratch;  /* Tokens re-lexed by a reparse */
     } bu_state;
     
+    /* Block-parallel parsing */
+    struct {
+        RiftBlockList blocks;        /* Last prescan */
+        regex_t* regexes;            /* set_count sets of pattern_count */
+        size_t set_count;            /* Pool workers plus the caller */
+        size_t pattern_count;
+    } block_state;
+    
     /* YODA evaluation system */
     YodaConfig yoda_config;
+    uint64_t* yoda_invariant;        /* Bitmaps over the last dual-mode */
+    uint64_t* yoda_true;             /* output, memory_size bits each */
+    uint64_t* consensus;             /* Tokens both passes produced alike */
     
     /* Statistics */
     struct {
         atomic_size_t top_down_ops;
         atomic_size_t bottom_up_ops;
         atomic_size_t parity_eliminations;
+        atomic_size_t memo_hits;      /* Pattern tries answered by the memo */
+        atomic_size_t reused_tokens;  /* Tokens a reparse kept or shifted */
     } stats;
 } DualModeParser;
 
@@ -151,12 +207,48 @@ typedef struct {
 DualModeParser* rift_tb_parser_create(void);
 void rift_tb_parser_destroy(DualModeParser* parser);
 
-/* Pattern registration with R"" syntax */
+/* Pattern registration with R"" syntax. A match may span lines unless
+ * every pattern has the 'm' flag; then every parse matches within a
+ * line, a match ending by the byte after the next newline at the
+ * latest, and a reparse restarts at the edited line. */
 bool rift_tb_add_pattern(DualModeParser* parser, 
                         const char* pattern,
                         const char* flags,  /* "gmbi[tb]" */
                         bool r_extension);
 
+/* Grammar rules: a named pattern is a terminal, and BNF productions
+ * over terminals are compiled to LALR(1) tables on first use. Once
+ * rules exist, the bottom-up pass also parses its token stream. */
+bool rift_tb_add_terminal(DualModeParser* parser,
+                         const char* name,
+                         const char* pattern,
+                         const char* flags);
+
+bool rift_tb_add_rule(DualModeParser* parser, const char* productions);
+
+/* Runs under the parser lock; it must not call back into the parser */
+void rift_tb_set_reduce_handler(DualModeParser* parser,
+                               RiftReduceFn on_reduce,
+                               void* user_data);
+
+/* Shift-reduce parse of tokens already produced; 0 when accepted */
+int rift_tb_parse_tokens(DualModeParser* parser,
+                        const TokenMemory* tokens,
+                        size_t count);
+
+/* Packrat mode: memoize each (pattern, offset) try so no pattern is
+ * matched twice at one offset, keeping the last `window` offsets per
+ * pattern (0 selects the default). Both passes share the table. */
+bool rift_tb_set_packrat(DualModeParser* parser, bool enabled, size_t window);
+
+/* Give each output token its own copy of the lexeme (off by default) */
+void rift_tb_set_copy_lexemes(DualModeParser* parser, bool enabled);
+
+/* Parse tree of the last accepted grammar parse, NULL if the last parse
+ * was rejected or kept no tree. Token indices refer to that parse's
+ * output; the tree is replaced by the next parse. */
+const FlatTree* rift_tb_parse_tree(const DualModeParser* parser);
+
 /* Dual-mode parsing operations */
 int rift_tb_parse_input(DualModeParser* parser,
                        const char* input,
@@ -164,6 +256,93 @@ int rift_tb_parse_input(DualModeParser* parser,
                        TokenMemory** output_tokens,
                        size_t* token_count);
 
+/* An edit between two inputs: bytes [start, old_end) of the old input
+ * were replaced by bytes [start, new_end) of the new one */
+typedef struct {
+    size_t start;
+    size_t old_end;
+    size_t new_end;
+} RiftTbEdit;
+
+/* Incremental reparse. tokens holds the output of this parser's last
+ * parse or reparse (same mode and lexeme setting) and is updated in
+ * place to match a full parse of the new input: tokens after the edit
+ * are shifted once the tokenizer falls back into step with the old
+ * stream, and only the stretch before that is matched again. It starts
+ * at the edited line when every pattern has 'm', and at the start of
+ * the input otherwise, since a match there may look ahead into the
+ * edit. The grammar, if any, then runs over the whole stream. */
+int rift_tb_reparse(DualModeParser* parser,
+                    const char* input,
+                    size_t length,
+                    const RiftTbEdit* edit,
+                    TokenMemory* tokens,
+                    size_t* token_count);
+
+/* Block-parallel parse. A prescan splits the input into top-level
+ * blocks, which are tokenized by the bottom-up patterns and, when rules
+ * exist, parsed by the grammar as separate sentences on pool (NULL runs
+ * them on this thread). Each block is read on its own: matches stop at
+ * its end and an empty match skips a byte. Output tokens are in input
+ * order and not capped at memory_size; the block trees become sibling
+ * roots of rift_tb_parse_tree, which is NULL if any block was rejected.
+ * No top-down pass runs and reduce handlers are not called. */
+int rift_tb_parse_blocks(DualModeParser* parser,
+                        RiftWorkPool* pool,
+                        const char* input,
+                        size_t length,
+                        TokenMemory** output_tokens,
+                        size_t* token_count);
+
+/* Receives streamed tokens in input order and returns how many it
+ * took, from the first; taking fewer than count stops the parse. The
+ * tokens are only valid during the call, but copied lexemes become the
+ * sink's, taken or not. In dual mode bit i of consensus is set when
+ * both passes produced tokens[i]; it is NULL in the other modes. A sink
+ * applies backpressure by not returning until it has room. */
+typedef size_t (*RiftTokenSinkFn)(const TokenMemory* tokens,
+                                  size_t count,
+                                  const uint64_t* consensus,
+                                  void* user_data);
+
+/* Streaming parse. Tokens go to sink up to batch at a time (0 selects
+ * the default) as they are produced, from one reused buffer: memory
+ * stays constant whatever the input length, and no memory_size cap
+ * applies. With rules, each batch is fed to the grammar once the sink
+ * has it, so the reduce handler sees reductions as they happen, with
+ * token indices into the stream; no tree is kept. Tokens the sink did
+ * not take reach neither the grammar nor token_count. In dual mode the
+ * top-down pass runs in lockstep on this thread to flag consensus
+ * tokens, and YODA bitmaps are left to the sink. An empty match skips
+ * a byte. The sink runs under the parser lock, as the reduce handler
+ * does. Returns 0 once the whole input was streamed and -1 if the sink
+ * stopped it; the grammar's verdict is in bu_state.accepted. */
+int rift_tb_parse_stream(DualModeParser* parser,
+                        const char* input,
+                        size_t length,
+                        RiftTokenSinkFn sink,
+                        void* sink_data,
+                        size_t batch,
+                        size_t* token_count);
+
+/* Bounded ring carrying a streaming parse to a consumer thread. Pass
+ * rift_tb_ring_sink with the ring as sink data: it blocks while the
+ * ring is full. The producer closes the ring after the parse; pop
+ * blocks while it is empty and returns 0 once it is closed and
+ * drained. A consumer that gives up cancels it, which stops the
+ * parse; the parse's count then includes what was still queued. With
+ * owns_lexemes, copies the consumer never receives are freed by the
+ * ring. Only the tokens are carried, not consensus. */
+typedef struct RiftTbRing RiftTbRing;
+
+RiftTbRing* rift_tb_ring_create(size_t capacity, bool owns_lexemes);
+void rift_tb_ring_destroy(RiftTbRing* ring);
+size_t rift_tb_ring_sink(const TokenMemory* tokens, size_t count,
+                         const uint64_t* consensus, void* ring);
+size_t rift_tb_ring_pop(RiftTbRing* ring, TokenMemory* tokens, size_t max);
+void rift_tb_ring_close(RiftTbRing* ring);
+void rift_tb_ring_cancel(RiftTbRing* ring);
+
 /* Thread-safe parity elimination */
 bool rift_tb_acquire_parity(ParityEliminator* elim, 
                            size_t thread_index,
@@ -177,11 +356,88 @@ YodaEvalResult rift_tb_yoda_evaluate(DualModeParser* parser,
                                     const TokenMemory* token,
                                     YodaConfig* config);
 
-/* Invariant logic slicing for parity elimination */
+/* Batch evaluation in one branch-free pass: bit i of invariant is set
+ * when token i evaluates YODA_EVAL_INVARIANT, bit i of truth when it
+ * evaluates YODA_EVAL_TRUE. Either bitmap may be NULL; each needs
+ * YODA_BITMAP_WORDS(count) words. Returns the invariant count. */
+size_t rift_tb_yoda_evaluate_batch(DualModeParser* parser,
+                                  const TokenMemory* tokens,
+                                  size_t count,
+                                  const YodaConfig* config,
+                                  uint64_t* invariant,
+                                  uint64_t* truth);
+
+/* The same over token columns (struct-of-arrays); lexemes may be NULL
+ * when every token has one */
+size_t rift_tb_yoda_evaluate_columns(DualModeParser* parser,
+                                    const uint32_t* types,
+                                    const uint32_t* values,
+                                    const void* const* lexemes,
+                                    size_t count,
+                                    const YodaConfig* config,
+                                    uint64_t* invariant,
+                                    uint64_t* truth);
+
+/* Bitmaps the last dual-mode parse or reparse left, one bit per output
+ * token; replaced by the next parse */
+bool rift_tb_yoda_bitmaps(const DualModeParser* parser,
+                         const uint64_t** invariant,
+                         const uint64_t** truth);
+
+/* Bitmap of the same output with bit i set when the top-down pass
+ * produced token i identically; replaced by the next parse */
+bool rift_tb_consensus_bitmap(const DualModeParser* parser, const uint64_t** consensus);
+
+/* Invariant logic slicing for parity elimination: a view of
+ * tokens[start_token, end_token) of count output tokens from this
+ * parser, split in half at its mid. Nothing is copied or marked; false
+ * when invariant_slicing is off or the range is not in the output. */
 bool rift_tb_invariant_slice(DualModeParser* parser,
+                            const TokenMemory* tokens,
+                            size_t count,
                             size_t start_token,
                             size_t end_token,
-                            void** slice_result);
+                            TokenSliceView* view);
+
+/* View of tokens[start, end) in an array of count tokens, such as the
+ * output of a parse */
+static inline bool rift_tb_token_view(const TokenMemory* tokens,
+                                      size_t count,
+                                      size_t start,
+                                      size_t end,
+                                      TokenSliceView* view) {
+    if (!tokens || !view || start >= end || end > count) return false;
+    view->tokens = tokens + start;
+    view->start = start;
+    view->count = end - start;
+    view->mid = view->count / 2;
+    return true;
+}
+
+/* Narrower view; start and end are relative to view */
+static inline bool rift_tb_view_slice(const TokenSliceView* view,
+                                      size_t start,
+                                      size_t end,
+                                      TokenSliceView* sub) {
+    if (!view || !rift_tb_token_view(view->tokens, view->count, start, end, sub)) return false;
+    sub->start += view->start;
+    return true;
+}
+
+/* The two halves as views of their own; a one-token view has an empty
+ * first half */
+static inline void rift_tb_view_halves(const TokenSliceView* view,
+                                       TokenSliceView* first,
+                                       TokenSliceView* second) {
+    size_t rest = view->count - view->mid;
+    *first = (TokenSliceView){ view->tokens, view->start, view->mid, view->mid / 2 };
+    *second = (TokenSliceView){ view->tokens + view->mid, view->start + view->mid,
+                                rest, rest / 2 };
+}
+
+static inline bool rift_tb_view_in_first_half(const TokenSliceView* view, size_t index) {
+    return index < view->mid;
+}
 
 /* =================================================================
  * IMPLEMENTATION DETAILS
@@ -193,62 +449,69 @@ bool rift_tb_invariant_slice(DualModeParser* parser,
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <sched.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+/* Park on the futex word while it still holds `expected` */
+static void parity_futex_wait(atomic_uint* word, unsigned int expected) {
+#ifdef __linux__
+    syscall(SYS_futex, (unsigned int*)word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#else
+    (void)word;
+    (void)expected;
+    sched_yield();
+#endif
+}
+
+static void parity_futex_wake_one(atomic_uint* word) {
+#ifdef __linux__
+    syscall(SYS_futex, (unsigned int*)word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    (void)word;
+#endif
+}
+
+/* Uncontended acquire and release are a single atomic each */
+static void parity_lock_acquire(atomic_uint* word) {
+    unsigned int state = 0;
+    if (atomic_compare_exchange_strong(word, &state, 1)) return;
+
+    if (state != 2) state = atomic_exchange(word, 2);
+    while (state != 0) {
+        parity_futex_wait(word, 2);
+        state = atomic_exchange(word, 2);
+    }
+}
 
-/* Create parity eliminator with semaphore pattern */
+static void parity_lock_release(atomic_uint* word) {
+    if (atomic_fetch_sub(word, 1) != 1) {
+        atomic_store(word, 0);
+        parity_futex_wake_one(word);
+    }
+}
+
+/* Create parity eliminator with the initial parity pattern */
 static ParityEliminator* create_parity_eliminator(void) {
     ParityEliminator* elim = calloc(1, sizeof(ParityEliminator));
     if (!elim) return NULL;
     
-    /* Initialize semaphore with parity pattern */
-    elim->parity_sem = sem_open("/rift_parity", O_CREAT, 0644, 1);
-    if (elim->parity_sem == SEM_FAILED) {
-        free(elim);
-        return NULL;
-    }
-    
+    atomic_init(&elim->parity_lock, 0);
     atomic_store(&elim->parity_state, PARITY_PATTERN);
     return elim;
 }
 
-/* Thread execution with tbtbbt pattern */
-static void* thread_execute_pattern(void* arg) {
-    ThreadContext* ctx = (ThreadContext*)arg;
-    const char* pattern = TB_PATTERN_STR;
-    size_t pattern_len = strlen(pattern);
-    
-    for (size_t i = 0; i < pattern_len; i++) {
-        bool should_be_topdown = (pattern[i] == 't');
-        
-        /* Acquire parity lock */
-        if (rift_tb_acquire_parity(ctx->eliminator, 
-                                  ctx->thread_index,
-                                  should_be_topdown)) {
-            
-            /* Execute based on mode */
-            if (should_be_topdown && ctx->mode == PARSE_MODE_TOP_DOWN) {
-                /* Top-down recursive descent execution */
-                /* Priority queue scheduling for heap operations */
-            } else if (!should_be_topdown && ctx->mode == PARSE_MODE_BOTTOM_UP) {
-                /* Bottom-up shift-reduce execution */
-                /* Token memory and value storage */
-            }
-            
-            /* Release parity */
-            rift_tb_release_parity(ctx->eliminator, ctx->thread_index);
-        }
-    }
-    
-    return NULL;
-}
-
 /* Parity elimination acquisition */
 bool rift_tb_acquire_parity(ParityEliminator* elim,
                            size_t thread_index,
                            bool is_topdown) {
     if (!elim || thread_index >= THREAD_PAIR_COUNT) return false;
     
-    /* Wait on semaphore */
-    if (sem_wait(elim->parity_sem) != 0) return false;
+    /* Take the lock; a mismatched parity gives it back and fails */
+    parity_lock_acquire(&elim->parity_lock);
     
     /* Check parity state for elimination */
     uint32_t current_parity = atomic_load(&elim->parity_state);
@@ -264,7 +527,7 @@ bool rift_tb_acquire_parity(ParityEliminator* elim,
     }
     
     /* Release if parity doesn't match */
-    sem_post(elim->parity_sem);
+    parity_lock_release(&elim->parity_lock);
     return false;
 }
 
@@ -299,21 +562,27 @@ DualModeParser* rift_tb_parser_create(void) {
     /* Initialize parse states */
     parser->td_state.max_recursion = 1024;
     parser->bu_state.memory_size = 4096;
-    parser->bu_state.token_memory = calloc(parser->bu_state.memory_size, 
-                                          sizeof(TokenMemory));
+    
+    parser->td_state.arena = parse_arena_create(0);
+    
+    /* Dual-mode YODA results, kept apart from the token types */
+    size_t words = YODA_BITMAP_WORDS(parser->bu_state.memory_size);
+    parser->yoda_invariant = calloc(words, sizeof(uint64_t));
+    parser->yoda_true = calloc(words, sizeof(uint64_t));
+    parser->consensus = calloc(words, sizeof(uint64_t));
+    
+    /* Threads live as long as the parser, not one parse call */
+    parser->workers = rift_workpool_create(THREAD_PAIR_COUNT - 1);
     
     return parser;
 }
 
-/* Add R"" pattern with [tb] flags */
-bool rift_tb_add_pattern(DualModeParser* parser,
-                        const char* pattern,
-                        const char* flags,
-                        bool r_extension) {
-    if (!parser || !pattern || !flags) return false;
-    
-    pthread_mutex_lock(&parser->context_mutex);
-    
+/* Compile and append a pattern; returns its index, -1 on failure.
+ * Caller holds context_mutex. */
+static int add_pattern_locked(DualModeParser* parser,
+                              const char* pattern,
+                              const char* flags,
+                              bool r_extension) {
     /* Parse flags for [tb] mode */
     ParseMode mode = 0;
     if (strstr(flags, "[tb]")) {
@@ -326,10 +595,7 @@ bool rift_tb_add_pattern(DualModeParser* parser,
     
     /* Allocate pattern structure */
     RiftRegexPattern* rp = calloc(1, sizeof(RiftRegexPattern));
-    if (!rp) {
-        pthread_mutex_unlock(&parser->context_mutex);
-        return false;
-    }
+    if (!rp) return -1;
     
     /* Store pattern info */
     rp->pattern_str = strdup(pattern);
@@ -343,22 +609,49 @@ bool rift_tb_add_pattern(DualModeParser* parser,
     /* Parse standard regex flags */
     if (strchr(flags, 'i')) compile_flags |= REG_ICASE;
     if (strchr(flags, 'm')) compile_flags |= REG_NEWLINE;
+    rp->flags = (uint32_t)compile_flags;
     
     if (regcomp(rp->compiled_regex, pattern, compile_flags) != 0) {
         free(rp->pattern_str);
         free(rp->compiled_regex);
         free(rp);
-        pthread_mutex_unlock(&parser->context_mutex);
-        return false;
+        return -1;
     }
     
+    /* glibc serializes regexec calls on one regex_t, so the top-down
+     * pass gets its own compiled copy to run alongside bottom-up */
+    rp->td_regex = calloc(1, sizeof(regex_t));
+    if (!rp->td_regex || regcomp(rp->td_regex, pattern, compile_flags) != 0) {
+        regfree(rp->compiled_regex);
+        free(rp->compiled_regex);
+        free(rp->td_regex);
+        free(rp->pattern_str);
+        free(rp);
+        return -1;
+    }
+    
+    /* One pattern that may span lines makes every match full-range */
+    parser->line_matching = (compile_flags & REG_NEWLINE) &&
+                            (parser->pattern_count == 0 || parser->line_matching);
+    
     /* Add to parser patterns */
     parser->patterns = realloc(parser->patterns,
                               (parser->pattern_count + 1) * sizeof(RiftRegexPattern*));
-    parser->patterns[parser->pattern_count++] = rp;
+    parser->patterns[parser->pattern_count] = rp;
+    return (int)parser->pattern_count++;
+}
+
+/* Add R"" pattern with [tb] flags */
+bool rift_tb_add_pattern(DualModeParser* parser,
+                        const char* pattern,
+                        const char* flags,
+                        bool r_extension) {
+    if (!parser || !pattern || !flags) return false;
     
+    pthread_mutex_lock(&parser->context_mutex);
+    int index = add_pattern_locked(parser, pattern, flags, r_extension);
     pthread_mutex_unlock(&parser->context_mutex);
-    return true;
+    return index >= 0;
 }
 
 /* YODA evaluation system */
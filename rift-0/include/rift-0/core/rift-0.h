@@ -15,6 +15,7 @@ extern "C" {
 typedef struct RiftStage0Context RiftStage0Context;
 typedef struct RiftStats RiftStats;
 typedef struct RiftMemoryGovernor RiftMemoryGovernor;
+typedef struct RiftTokenCache RiftTokenCache;
 
 /* RIFT Statistics tracking */
 struct RiftStats {
@@ -38,6 +39,9 @@ struct RiftStage0Context {
     /* Tokenizer subsystem */
     TokenizerContext* tokenizer;
     
+    /* Optional on-disk token cache (not owned) */
+    RiftTokenCache* token_cache;
+    
     /* Memory governance */
     RiftMemoryGovernor* mem_gov;
     
@@ -58,13 +62,18 @@ struct RiftStage0Context {
 
 /* RIFT DSL API - Core functions for build language processing */
 RiftStage0Context* rift_stage0_create(void);
+RiftStage0Context* rift_stage0_create_with_capacity(size_t token_capacity);
 void rift_stage0_destroy(RiftStage0Context* ctx);
+bool rift_stage0_reset(RiftStage0Context* ctx);
 
 /* DSL Processing functions */
 int rift_process_build_script(RiftStage0Context* ctx, const char* script);
 int rift_compile_pattern(RiftStage0Context* ctx, const char* pattern);
 int rift_generate_parser(RiftStage0Context* ctx, const char* output_file);
 
+/* Attach a token cache consulted by rift_tokenize_input; NULL detaches */
+void rift_stage0_set_token_cache(RiftStage0Context* ctx, RiftTokenCache* cache);
+
 /* Token processing for DSL */
 int rift_tokenize_input(RiftStage0Context* ctx, const char* input, 
                        TokenTriplet* tokens, size_t max_tokens);
@@ -0,0 +1,109 @@
+/*
+ * =================================================================
+ * rift_common.h - RIFT-0 Concurrency Governance Definitions
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Shared telemetry, policy and placement structures
+ * OBINexus Computing Framework - AEGIS Compliant
+ * =================================================================
+ */
+
+#ifndef RIFT_COMMON_H
+#define RIFT_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum hierarchy constraints per RIFT governance
+#define RIFT_MAX_CHILDREN_PER_PROCESS 32
+#define RIFT_MAX_HIERARCHY_DEPTH 8
+#define RIFT_MAX_THREAD_COUNT 256
+
+// Telemetry and tracking structures
+typedef struct {
+    pid_t process_id;               // System process ID
+    pthread_t thread_id;            // Thread ID (if applicable)
+    uint64_t rift_thread_id;        // Internal RIFT thread identifier
+    pid_t parent_process_id;        // Parent process PID
+    uint64_t parent_rift_id;        // Parent RIFT thread ID
+    struct timespec spawn_time;     // Thread/process creation timestamp
+    char spawn_location[128];       // Where in code this was spawned
+    uint32_t hierarchy_depth;       // Depth in parent-child tree
+    uint32_t child_count;           // Number of children spawned
+    bool is_daemon;                 // Daemon thread flag
+} rift_spawn_telemetry_t;
+
+// Governance policy structure (shared between modules)
+typedef enum {
+    CONCURRENCY_SIMULATED,          // Single-thread cooperative
+    CONCURRENCY_TRUE_THREAD,        // Multi-thread within process
+    CONCURRENCY_TRUE_PROCESS        // Multi-process hierarchy
+} rift_concurrency_mode_t;
+
+// Worker placement policy
+typedef enum {
+    PIN_NONE,                       // Let the scheduler place workers freely
+    PIN_NODE,                       // Bind each worker to one NUMA node's CPUs
+    PIN_CORE_COMPACT,               // One CPU per worker, filling a node first
+    PIN_CORE_SCATTER                // One CPU per worker, alternating nodes
+} rift_pin_policy_t;
+
+typedef struct {
+    rift_pin_policy_t pin_policy;   // How workers are bound to CPUs
+    char cpu_list[64];              // Allowed CPUs ("0-7,16-23"); empty for all
+    bool node_local_memory;         // Workers first-touch their own buffers
+} rift_placement_policy_t;
+
+typedef enum {
+    DESTROY_CASCADE,                // Cascade destruction to children
+    DESTROY_KEEP_ALIVE,            // Allow children to survive
+    DESTROY_GRACEFUL,              // Graceful shutdown signal
+    DESTROY_IMMEDIATE              // Immediate termination
+} rift_destroy_policy_t;
+
+typedef struct {
+    uint64_t rift_id;              // Internal RIFT identifier
+    rift_concurrency_mode_t mode;  // Concurrency execution mode
+    rift_destroy_policy_t destroy_policy; // Child destruction policy
+    uint32_t max_children;         // Maximum children allowed
+    uint32_t max_execution_time_ms; // Execution time limit
+    bool trace_capped;             // Enable hierarchy depth limits
+    uint32_t max_hierarchy_depth;  // Maximum tree depth
+    bool daemon_mode;              // Daemon thread flag
+    bool keep_alive;               // Survival policy flag
+    rift_placement_policy_t placement; // Worker CPU and memory placement
+} rift_governance_policy_t;
+
+// Thread context structure (shared between modules)
+typedef struct {
+    rift_spawn_telemetry_t telemetry;     // Spawn tracking and telemetry
+    rift_governance_policy_t policy;      // Governance and policy constraints
+    struct timespec last_heartbeat;       // Last activity timestamp
+    uint32_t context_switches;            // Context switch counter
+    volatile bool should_terminate;       // Termination signal
+    void* module_specific_data;           // Module-specific context
+} rift_thread_context_t;
+
+// Memory token for resource governance
+typedef struct {
+    uint64_t token_id;             // Unique token identifier
+    uint64_t owner_rift_id;        // Owning RIFT thread ID
+    pid_t owner_process_id;        // Owning process ID
+    uint32_t access_mask;          // Permission bit mask (R/W/X)
+    char resource_name[64];        // Resource identifier
+    struct timespec acquisition_time; // When token was acquired
+    uint32_t validation_bits;      // Token state validation
+    bool is_transferable;          // Can be transferred between threads
+} rift_memory_token_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_COMMON_H */
@@ -0,0 +1,33 @@
+/*
+ * =================================================================
+ * rift_hash.h - RIFT-0 Non-Cryptographic Content Hashing
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Fast 64-bit hashing for content-addressed caches
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * XXH64-compatible digest. Used to key on-disk caches by the bytes
+ * of an input, never for integrity or trust decisions.
+ * =================================================================
+ */
+
+#ifndef RIFT_HASH_H
+#define RIFT_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hash `length` bytes of `data` with the given seed (XXH64) */
+uint64_t rift_hash64(const void* data, size_t length, uint64_t seed);
+
+/* Mix a value into an existing hash (order dependent) */
+uint64_t rift_hash64_combine(uint64_t hash, uint64_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_HASH_H */
@@ -0,0 +1,84 @@
+/*
+ * =================================================================
+ * rift_ingest.h - RIFT-0 Bulk File Ingestion
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Asynchronous file loading for batch tokenization
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * On Linux builds with RIFT_HAVE_IO_URING, opens, reads and closes
+ * for many files are queued on one io_uring and complete out of
+ * order. Small files land directly in a set of pre-registered
+ * buffers; a file that outgrows its buffer continues into a heap
+ * buffer. When io_uring is not compiled in, or the kernel refuses to
+ * set one up, files are read with plain syscalls on a RiftWorkPool
+ * (or on the calling thread when no pool is given).
+ *
+ * Each loaded file is handed to the callback as a RiftIngestBuffer,
+ * including files that failed. The consumer owns it until
+ * rift_ingest_release. On the io_uring path at most queue_depth
+ * buffers are out at once, so a slow consumer throttles reading;
+ * it must therefore release without waiting for the run to return.
+ * =================================================================
+ */
+
+#ifndef RIFT_INGEST_H
+#define RIFT_INGEST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "rift-0/core/rift_workpool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_INGEST_DEFAULT_DEPTH       64
+#define RIFT_INGEST_DEFAULT_BUFFER_SIZE (64 * 1024)
+
+typedef struct RiftIngest RiftIngest;
+
+/* A loaded file, or the reason it could not be loaded */
+typedef struct {
+    size_t index;               /* Position in the path list */
+    const char* path;
+    char* data;                 /* NUL-terminated; NULL on error */
+    size_t size;
+    int error;                  /* errno value, 0 on success */
+} RiftIngestBuffer;
+
+/* Called once per path; may run on any thread, including concurrently */
+typedef void (*RiftIngestCallback)(RiftIngestBuffer* buffer, void* user_data);
+
+typedef struct {
+    size_t queue_depth;         /* Files in flight or held; 0 selects the default */
+    size_t buffer_size;         /* Bytes per registered buffer; 0 selects the default */
+    size_t max_file_size;       /* Larger files fail with EFBIG; 0 for no limit */
+    RiftWorkPool* readers;      /* Fallback reader pool; NULL reads on the caller */
+    bool disable_io_uring;      /* Force the fallback path */
+} RiftIngestConfig;
+
+RiftIngest* rift_ingest_create(const RiftIngestConfig* config);
+void rift_ingest_destroy(RiftIngest* ingest);
+
+/* "io_uring" or "threads" */
+const char* rift_ingest_backend(const RiftIngest* ingest);
+
+/**
+ * Load every path and pass each result to callback
+ * Returns once every path has been delivered; buffers still held by
+ * the consumer stay valid until released. One run at a time.
+ *
+ * @return 0 if every file loaded, -1 if any failed
+ */
+int rift_ingest_run(RiftIngest* ingest, const char* const* paths, size_t count,
+                    RiftIngestCallback callback, void* user_data);
+
+/* Hand a delivered buffer back; safe from any thread */
+void rift_ingest_release(RiftIngest* ingest, RiftIngestBuffer* buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_INGEST_H */
@@ -0,0 +1,113 @@
+/*
+ * =================================================================
+ * rift_log.h - RIFT-0 Leveled Logging
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Low-overhead diagnostics for library code
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Records below RIFT_LOG_COMPILE_LEVEL are removed by the compiler.
+ * Records below the runtime level cost one load and one branch; the
+ * arguments are not evaluated. Accepted records are formatted into a
+ * per-thread buffer and written to the log descriptor (stderr by
+ * default), optionally by a background flusher thread.
+ * =================================================================
+ */
+
+#ifndef RIFT_LOG_H
+#define RIFT_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Levels (plain integers so they can be compared by the preprocessor) */
+#define RIFT_LOG_LEVEL_TRACE 0
+#define RIFT_LOG_LEVEL_DEBUG 1
+#define RIFT_LOG_LEVEL_INFO  2
+#define RIFT_LOG_LEVEL_WARN  3
+#define RIFT_LOG_LEVEL_ERROR 4
+#define RIFT_LOG_LEVEL_OFF   5
+
+typedef int RiftLogLevel;
+
+/* Records below this level are compiled out */
+#ifndef RIFT_LOG_COMPILE_LEVEL
+#define RIFT_LOG_COMPILE_LEVEL RIFT_LOG_LEVEL_TRACE
+#endif
+
+#define RIFT_LOG_DEFAULT_LEVEL       RIFT_LOG_LEVEL_WARN
+#define RIFT_LOG_DEFAULT_BUFFER_SIZE 8192
+
+/* Binary record framing: header, then file name, NUL, message bytes */
+#define RIFT_LOG_BINARY_MAGIC 0x31474C52u   /* "RLG1" little-endian */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t length;            /* Bytes following the header */
+    uint64_t timestamp_ns;      /* CLOCK_REALTIME */
+    uint32_t thread_id;
+    uint32_t line;
+    uint8_t level;
+    uint8_t reserved[7];
+} RiftLogRecordHeader;
+
+/* Logger configuration */
+typedef struct {
+    RiftLogLevel level;
+    int fd;                     /* Destination; -1 selects stderr */
+    bool async;                 /* Hand buffers to a flusher thread */
+    bool binary;                /* Framed binary records instead of text */
+    size_t buffer_size;         /* Per-thread buffer; 0 selects the default */
+} RiftLogConfig;
+
+/* Runtime threshold; read by the macros below */
+extern atomic_int rift_log_threshold;
+
+/* Configure before worker threads start logging */
+int rift_log_init(const RiftLogConfig* config);
+
+/* Ship every thread's buffered records, wait for delivery and stop the
+ * flusher; also run at exit once async mode was started */
+void rift_log_shutdown(void);
+
+void rift_log_set_level(RiftLogLevel level);
+RiftLogLevel rift_log_get_level(void);
+RiftLogLevel rift_log_level_from_string(const char* name);
+
+/* Push the calling thread's buffered records and wait for delivery */
+void rift_log_flush(void);
+
+void rift_log_write(RiftLogLevel level, const char* file, int line,
+                    const char* format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 4, 5)))
+#endif
+    ;
+
+#define RIFT_LOG_ENABLED(level) \
+    ((level) >= RIFT_LOG_COMPILE_LEVEL && \
+     (level) >= atomic_load_explicit(&rift_log_threshold, memory_order_relaxed))
+
+#define RIFT_LOG_AT(level, ...) \
+    do { \
+        if (RIFT_LOG_ENABLED(level)) { \
+            rift_log_write((level), __FILE__, __LINE__, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define RIFT_LOG_TRACE(...) RIFT_LOG_AT(RIFT_LOG_LEVEL_TRACE, __VA_ARGS__)
+#define RIFT_LOG_DEBUG(...) RIFT_LOG_AT(RIFT_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define RIFT_LOG_INFO(...)  RIFT_LOG_AT(RIFT_LOG_LEVEL_INFO, __VA_ARGS__)
+#define RIFT_LOG_WARN(...)  RIFT_LOG_AT(RIFT_LOG_LEVEL_WARN, __VA_ARGS__)
+#define RIFT_LOG_ERROR(...) RIFT_LOG_AT(RIFT_LOG_LEVEL_ERROR, __VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_LOG_H */
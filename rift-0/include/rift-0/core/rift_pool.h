@@ -0,0 +1,64 @@
+/*
+ * =================================================================
+ * rift_pool.h - RIFT-0 Stage Context Pool
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Bounded reuse of warmed-up RiftStage0Context objects
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Contexts are kept on sharded free lists; each thread is pinned to
+ * one shard so acquire/release normally touch an uncontended lock.
+ * A context is reset on release and keeps its buffers, patterns and
+ * token cache binding for the next request.
+ * =================================================================
+ */
+
+#ifndef RIFT_POOL_H
+#define RIFT_POOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "rift-0/core/rift-0.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_POOL_DEFAULT_MAX_CONTEXTS 64
+#define RIFT_POOL_SHARD_COUNT          16
+
+typedef struct RiftContextPool RiftContextPool;
+
+/* Pool configuration */
+typedef struct {
+    size_t max_contexts;        /* Live contexts cap; 0 selects the default */
+    size_t prewarm;             /* Contexts created up front */
+    size_t token_capacity;      /* Token buffer size of each context */
+    RiftTokenCache* token_cache;/* Bound to every pooled context (optional) */
+} RiftContextPoolConfig;
+
+/* Pool statistics */
+typedef struct {
+    size_t live;                /* Contexts currently owned by the pool */
+    size_t idle;                /* Contexts waiting on free lists */
+    size_t created;
+    size_t reused;
+    size_t exhausted;           /* Acquires refused at max_contexts */
+} RiftContextPoolStats;
+
+/* Lifecycle */
+RiftContextPool* rift_context_pool_create(const RiftContextPoolConfig* config);
+void rift_context_pool_destroy(RiftContextPool* pool);
+
+/* Acquire returns NULL once max_contexts are checked out */
+RiftStage0Context* rift_context_pool_acquire(RiftContextPool* pool);
+void rift_context_pool_release(RiftContextPool* pool, RiftStage0Context* ctx);
+
+void rift_context_pool_get_stats(const RiftContextPool* pool,
+                                 RiftContextPoolStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_POOL_H */
@@ -0,0 +1,79 @@
+/*
+ * =================================================================
+ * rift_scheduler.h - RIFT-0 Cooperative Job Scheduler
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: M:N scheduling of governed jobs
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Jobs are stackful coroutines multiplexed over a fixed set of worker
+ * threads. A job gives up its worker with rift_job_yield (directly,
+ * or through RIFT_COOPERATIVE_YIELD at a governance checkpoint), and
+ * the worker switches to the next ready job in user space instead of
+ * handing the CPU back to the kernel.
+ *
+ * Jobs that have not started yet are shared by all workers. Once a
+ * job runs it stays on that worker, so thread-local state such as
+ * errno is never observed from a different thread across a yield.
+ * A job must not block in the kernel for long; it holds its worker.
+ * =================================================================
+ */
+
+#ifndef RIFT_SCHEDULER_H
+#define RIFT_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_SCHEDULER_DEFAULT_STACK    (64 * 1024)
+#define RIFT_SCHEDULER_DEFAULT_SLICE_US 1000
+
+typedef struct RiftScheduler RiftScheduler;
+
+typedef void (*RiftJobFn)(void* arg);
+
+typedef struct {
+    size_t worker_count;        /* 0 selects the online CPU count */
+    size_t stack_size;          /* Per job; 0 selects the default */
+    uint32_t time_slice_us;     /* rift_job_should_yield threshold; 0 selects the default */
+    size_t max_active;          /* Started jobs per worker; 0 for no limit */
+} RiftSchedulerConfig;
+
+typedef struct {
+    size_t worker_count;
+    size_t spawned;
+    size_t completed;
+    size_t switches;            /* Resumptions of a job that had yielded */
+} RiftSchedulerStats;
+
+RiftScheduler* rift_scheduler_create(const RiftSchedulerConfig* config);
+
+/* Runs every queued job to completion, then stops the workers */
+void rift_scheduler_destroy(RiftScheduler* scheduler);
+
+/* Queue fn(arg) as a new job; -1 if it could not be created */
+int rift_scheduler_spawn(RiftScheduler* scheduler, RiftJobFn fn, void* arg);
+
+/* Block until every spawned job has returned */
+void rift_scheduler_wait(RiftScheduler* scheduler);
+
+void rift_scheduler_get_stats(const RiftScheduler* scheduler, RiftSchedulerStats* stats);
+
+/* Inside a job: let the next ready job run. Elsewhere: sched_yield */
+void rift_job_yield(void);
+
+/* True inside a job that used up its time slice while others wait */
+bool rift_job_should_yield(void);
+
+/* True when called from inside a scheduled job */
+bool rift_job_in_scheduler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_SCHEDULER_H */
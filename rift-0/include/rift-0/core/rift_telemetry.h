@@ -0,0 +1,102 @@
+/*
+ * =================================================================
+ * rift_telemetry.h - RIFT-0 Spawn and Heartbeat Telemetry
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: PID/TID tracking and spawn telemetry
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Producers never touch the shared registry. Each thread that
+ * reports an event owns a single-producer ring, and a background
+ * aggregator folds the rings into the registry. Heartbeats take no
+ * lock. A full ring drops the heartbeat and counts it; spawns wait
+ * for room instead. Readers (get, validate, report) drain every ring
+ * first, so they see all events published before the call.
+ * =================================================================
+ */
+
+#ifndef RIFT_TELEMETRY_H
+#define RIFT_TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rift-0/core/rift_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIFT_TELEMETRY_RING_SIZE        1024    /* Events per thread; power of two */
+#define RIFT_TELEMETRY_INTERVAL_US      1000    /* Aggregator drain period */
+
+typedef struct {
+    size_t threads;                 /* Rings ever created */
+    size_t registered;              /* Spawns in the registry */
+    uint64_t heartbeats;            /* Heartbeats folded into the registry */
+    uint64_t dropped;               /* Heartbeats lost to a full ring */
+} rift_telemetry_stats_t;
+
+/**
+ * @brief Initialize telemetry subsystem
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_init(void);
+
+/**
+ * @brief Stop the aggregator and free the registry
+ * No thread may report events during or after the call.
+ */
+void rift_telemetry_shutdown(void);
+
+/**
+ * @brief Register new thread/process spawn with telemetry
+ * Assigns telemetry.rift_thread_id when it is 0 and stamps the
+ * process, thread and spawn time.
+ * @param context Thread context to register
+ * @param spawn_location Source location where spawn occurred
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* spawn_location);
+
+/**
+ * @brief Update heartbeat for thread/process
+ * @param rift_id RIFT thread identifier
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_heartbeat(uint64_t rift_id);
+
+/**
+ * @brief Get spawn telemetry for specific thread
+ * The record stays allocated until rift_telemetry_shutdown.
+ * @param rift_id RIFT thread identifier
+ * @return Pointer to telemetry data, NULL if not found
+ */
+rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id);
+
+/**
+ * @brief Last heartbeat folded in for a thread
+ * @return true if the thread is known and has sent one
+ */
+bool rift_telemetry_last_heartbeat(uint64_t rift_id, struct timespec* when);
+
+/**
+ * @brief Print comprehensive telemetry report
+ */
+void rift_telemetry_print_report(void);
+
+/**
+ * @brief Validate hierarchy constraints for new spawn
+ * @param parent_rift_id Parent RIFT thread ID
+ * @param proposed_policy Proposed governance policy
+ * @return true if spawn allowed, false if violates constraints
+ */
+bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy);
+
+void rift_telemetry_get_stats(rift_telemetry_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_TELEMETRY_H */
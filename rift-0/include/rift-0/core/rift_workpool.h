@@ -0,0 +1,110 @@
+/*
+ * =================================================================
+ * rift_workpool.h - RIFT-0 Work-Stealing Thread Pool
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Fork/join task execution for batch processing
+ * OBINexus Computing Framework - AEGIS Compliant
+ *
+ * Each worker owns a deque. Tasks submitted from a worker go to the
+ * bottom of its own deque and are popped LIFO; idle workers steal the
+ * oldest task from the top of a victim's deque. Tasks submitted from
+ * outside the pool are spread round-robin. Tasks may submit further
+ * tasks into the same group; a worker waiting on a group keeps
+ * executing tasks instead of blocking.
+ *
+ * Workers can be pinned by a rift_placement_policy_t. NUMA nodes are
+ * read from sysfs; each worker has a home node, and an optional start
+ * hook runs on the worker after pinning so per-worker buffers are
+ * first touched, and therefore allocated, on that node.
+ * =================================================================
+ */
+
+#ifndef RIFT_WORKPOOL_H
+#define RIFT_WORKPOOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "rift-0/core/rift_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct RiftWorkPool RiftWorkPool;
+
+typedef void (*RiftTaskFn)(void* arg);
+
+/* Runs on each worker thread after pinning, before its first task */
+typedef void (*RiftWorkerStartFn)(size_t worker, int node, void* user_data);
+
+#define RIFT_WORKPOOL_MAX_NODES 64
+
+typedef struct {
+    size_t worker_count;                /* 0 selects the allowed CPU count */
+    rift_placement_policy_t placement;
+    RiftWorkerStartFn on_worker_start;  /* Optional */
+    void* user_data;
+} RiftWorkPoolConfig;
+
+/* Completion tracking for a set of related tasks */
+typedef struct {
+    atomic_size_t pending;
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+} RiftTaskGroup;
+
+/* Pool statistics */
+typedef struct {
+    size_t worker_count;
+    size_t executed;
+    size_t stolen;
+} RiftWorkPoolStats;
+
+/* Per-node locality; a remote task ran while its worker sat off-node */
+typedef struct {
+    int node;
+    size_t workers;
+    size_t executed;
+    size_t remote;
+} RiftWorkPoolNodeStats;
+
+/* Lifecycle; worker_count 0 selects the allowed CPU count */
+RiftWorkPool* rift_workpool_create(size_t worker_count);
+
+/* NULL with errno EINVAL if placement.cpu_list is malformed or empty */
+RiftWorkPool* rift_workpool_create_with_config(const RiftWorkPoolConfig* config);
+void rift_workpool_destroy(RiftWorkPool* pool);
+
+size_t rift_workpool_worker_count(const RiftWorkPool* pool);
+
+/* Index of the calling worker in [0, worker_count), or -1 off-pool */
+int rift_workpool_current_worker(const RiftWorkPool* pool);
+
+/* Home NUMA node of a worker (0 without NUMA information) */
+int rift_workpool_worker_node(const RiftWorkPool* pool, size_t worker);
+
+/* Task groups */
+void rift_task_group_init(RiftTaskGroup* group);
+void rift_task_group_destroy(RiftTaskGroup* group);
+
+/* Queue fn(arg) as part of group; returns -1 if it could not be queued */
+int rift_workpool_submit(RiftWorkPool* pool, RiftTaskGroup* group,
+                         RiftTaskFn fn, void* arg);
+
+/* Block until every task in the group (including nested ones) finished */
+void rift_workpool_wait(RiftWorkPool* pool, RiftTaskGroup* group);
+
+void rift_workpool_get_stats(const RiftWorkPool* pool, RiftWorkPoolStats* stats);
+
+/* Fill up to max_nodes entries, ordered by node; returns the count */
+size_t rift_workpool_get_node_stats(const RiftWorkPool* pool,
+                                    RiftWorkPoolNodeStats* stats, size_t max_nodes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_WORKPOOL_H */
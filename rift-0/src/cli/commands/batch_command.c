@@ -0,0 +1,735 @@
+/*
+ * =================================================================
+ * batch_command.c - RIFT-0 Batch Tokenization Command
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+#include "rift-0/cli/command/batch_command.h"
+#include "rift-0/core/rift-0.h"
+#include "rift-0/core/rift_pool.h"
+#include "rift-0/core/rift_workpool.h"
+#include "rift-0/core/rift_ingest.h"
+#include "rift-0/core/rift_log.h"
+#include "rift-0/core/lexer/tokenizer.h"
+
+/* =================================================================
+ * BATCH STATE
+ * =================================================================
+ */
+
+typedef struct BatchJob BatchJob;
+typedef struct BatchFile BatchFile;
+
+typedef struct {
+    BatchFile* file;
+    size_t offset;
+    size_t length;
+    size_t tokens;
+    bool failed;
+} BatchChunk;
+
+struct BatchFile {
+    BatchJob* job;
+    const char* path;
+    RiftIngestBuffer* loaded;   /* Held until every chunk is tokenized */
+    char* content;
+    size_t size;
+
+    BatchChunk* chunks;
+    size_t chunk_count;
+    atomic_size_t chunks_left;
+
+    size_t tokens;
+    const char* error;          /* NULL when every chunk tokenized */
+    char error_text[128];       /* Backs error for load failures */
+    atomic_bool done;
+};
+
+struct BatchJob {
+    RiftWorkPool* workers;
+    RiftIngest* ingest;
+    RiftContextPool* contexts;
+    RiftStage0Context** local_contexts; /* Per worker, made on its node; NULL when unused */
+    RiftTaskGroup group;
+    const RiftBatchOptions* options;
+    size_t chunk_size;
+
+    BatchFile* files;
+    size_t count;
+
+    /* Report lines go out strictly in input order */
+    pthread_mutex_t emit_lock;
+    size_t next_emit;
+};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* =================================================================
+ * FILE I/O
+ * =================================================================
+ */
+
+int read_file_content(const char* filename, char** content, size_t* size) {
+    if (!filename || !content || !size) return -1;
+
+    FILE* f = fopen(filename, "rb");
+    if (!f) return -1;
+
+    struct stat st;
+    if (fstat(fileno(f), &st) != 0) {
+        fclose(f);
+        return -1;
+    }
+    if (!S_ISREG(st.st_mode) || st.st_size > CLI_MAX_FILE_SIZE) {
+        fclose(f);
+        errno = S_ISREG(st.st_mode) ? EFBIG : EINVAL;
+        return -1;
+    }
+
+    size_t length = (size_t)st.st_size;
+    char* buffer = malloc(length + 1);
+    if (!buffer) {
+        fclose(f);
+        return -1;
+    }
+
+    size_t got = fread(buffer, 1, length, f);
+    fclose(f);
+    if (got != length) {
+        free(buffer);
+        errno = EIO;
+        return -1;
+    }
+
+    buffer[length] = '\0';
+    *content = buffer;
+    *size = length;
+    return 0;
+}
+
+/* =================================================================
+ * PATH COLLECTION
+ * =================================================================
+ */
+
+typedef struct {
+    char** items;
+    size_t count;
+    size_t capacity;
+} PathList;
+
+static int path_list_add(PathList* list, const char* path) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 64;
+        char** items = realloc(list->items, capacity * sizeof(char*));
+        if (!items) return -1;
+        list->items = items;
+        list->capacity = capacity;
+    }
+
+    char* copy = strdup(path);
+    if (!copy) return -1;
+    list->items[list->count++] = copy;
+    return 0;
+}
+
+static int skip_hidden(const struct dirent* entry) {
+    return entry->d_name[0] != '.';
+}
+
+static int collect_directory(PathList* list, const char* dir) {
+    struct dirent** entries;
+    int n = scandir(dir, &entries, skip_hidden, alphasort);
+    if (n < 0) {
+        fprintf(stderr, "Cannot read directory %s: %s\n", dir, strerror(errno));
+        return -1;
+    }
+
+    int result = 0;
+    for (int i = 0; i < n; i++) {
+        size_t length = strlen(dir) + strlen(entries[i]->d_name) + 2;
+        char* path = malloc(length);
+        if (!path) {
+            result = -1;
+        } else {
+            snprintf(path, length, "%s/%s", dir, entries[i]->d_name);
+
+            struct stat st;
+            if (result == 0 && stat(path, &st) == 0) {
+                if (S_ISDIR(st.st_mode)) {
+                    result = collect_directory(list, path);
+                } else if (S_ISREG(st.st_mode)) {
+                    result = path_list_add(list, path);
+                }
+            }
+            free(path);
+        }
+        free(entries[i]);
+    }
+    free(entries);
+
+    return result;
+}
+
+static int collect_list_file(PathList* list, const char* list_path) {
+    FILE* f = fopen(list_path, "r");
+    if (!f) {
+        fprintf(stderr, "Cannot open list file %s: %s\n", list_path, strerror(errno));
+        return -1;
+    }
+
+    char* line = NULL;
+    size_t capacity = 0;
+    ssize_t length;
+    int result = 0;
+
+    while (result == 0 && (length = getline(&line, &capacity, f)) != -1) {
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) {
+            line[--length] = '\0';
+        }
+        if (length == 0 || line[0] == '#') continue;
+        result = path_list_add(list, line);
+    }
+
+    free(line);
+    fclose(f);
+    return result;
+}
+
+int rift_batch_collect_paths(char** operands, int operand_count,
+                             char*** paths, size_t* count) {
+    if (!operands || !paths || !count) return -1;
+
+    PathList list = { NULL, 0, 0 };
+    int result = 0;
+
+    for (int i = 0; i < operand_count && result == 0; i++) {
+        const char* operand = operands[i];
+        struct stat st;
+
+        if (operand[0] == '@') {
+            result = collect_list_file(&list, operand + 1);
+        } else if (stat(operand, &st) == 0 && S_ISDIR(st.st_mode)) {
+            result = collect_directory(&list, operand);
+        } else {
+            /* Unreadable files are reported per file, not here */
+            result = path_list_add(&list, operand);
+        }
+    }
+
+    if (result != 0) {
+        rift_batch_free_paths(list.items, list.count);
+        return -1;
+    }
+
+    *paths = list.items;
+    *count = list.count;
+    return 0;
+}
+
+void rift_batch_free_paths(char** paths, size_t count) {
+    if (!paths) return;
+    for (size_t i = 0; i < count; i++) {
+        free(paths[i]);
+    }
+    free(paths);
+}
+
+/* =================================================================
+ * TASKS
+ * =================================================================
+ */
+
+static void emit_ready_files(BatchJob* job) {
+    FILE* out = job->options->output;
+
+    pthread_mutex_lock(&job->emit_lock);
+    while (job->next_emit < job->count &&
+           atomic_load(&job->files[job->next_emit].done)) {
+        BatchFile* file = &job->files[job->next_emit++];
+        if (!out) continue;
+
+        if (file->error) {
+            fprintf(out, "%s\terror: %s\n", file->path, file->error);
+            continue;
+        }
+        fprintf(out, "%s\t%zu bytes\t%zu tokens\n", file->path, file->size, file->tokens);
+        if (job->options->verbose && file->chunk_count > 1) {
+            for (size_t i = 0; i < file->chunk_count; i++) {
+                fprintf(out, "  chunk %zu\t@%zu\t%zu bytes\t%zu tokens\n", i,
+                        file->chunks[i].offset, file->chunks[i].length,
+                        file->chunks[i].tokens);
+            }
+        }
+    }
+    pthread_mutex_unlock(&job->emit_lock);
+}
+
+static void finish_file(BatchFile* file) {
+    for (size_t i = 0; i < file->chunk_count; i++) {
+        if (file->chunks[i].failed) {
+            file->error = "tokenization failed";
+        }
+        file->tokens += file->chunks[i].tokens;
+    }
+
+    rift_ingest_release(file->job->ingest, file->loaded);
+    file->loaded = NULL;
+    file->content = NULL;
+
+    atomic_store(&file->done, true);
+    emit_ready_files(file->job);
+}
+
+/* Runs on each worker after pinning, so its token buffer is first
+ * touched, and therefore placed, on the worker's home node */
+static void create_local_context(size_t worker, int node, void* user_data) {
+    BatchJob* job = (BatchJob*)user_data;
+    (void)node;
+    job->local_contexts[worker] = rift_stage0_create_with_capacity(RIFT_TOKENIZER_MAX_TOKENS);
+}
+
+static void tokenize_chunk_task(void* arg) {
+    BatchChunk* chunk = (BatchChunk*)arg;
+    BatchFile* file = chunk->file;
+    BatchJob* job = file->job;
+
+    /* Workers use their own context; the helping caller borrows one */
+    int worker = rift_workpool_current_worker(job->workers);
+    RiftStage0Context* local = NULL;
+    if (worker >= 0 && job->local_contexts) local = job->local_contexts[worker];
+
+    RiftStage0Context* ctx = local ? local : rift_context_pool_acquire(job->contexts);
+    if (!ctx) {
+        chunk->failed = true;
+    } else {
+        ssize_t result = rift_tokenizer_process_with_flags(
+            ctx->tokenizer, file->content + chunk->offset, chunk->length,
+            TOKEN_FLAG_NONE);
+        if (result < 0) {
+            chunk->failed = true;
+        } else {
+            chunk->tokens = (size_t)result;
+        }
+        if (!local) {
+            rift_context_pool_release(job->contexts, ctx);
+        } else if (!rift_stage0_reset(local)) {
+            rift_stage0_destroy(local);
+            job->local_contexts[worker] = NULL;
+        }
+    }
+
+    if (atomic_fetch_sub(&file->chunks_left, 1) == 1) {
+        finish_file(file);
+    }
+}
+
+/* Split at the last newline before each boundary so no token straddles
+ * two chunks; a line longer than the chunk size stays whole. */
+static size_t plan_chunks(BatchFile* file, size_t chunk_size, BatchChunk* out) {
+    size_t count = 0;
+    size_t offset = 0;
+
+    while (offset < file->size) {
+        size_t end = file->size;
+        if (file->size - offset > chunk_size) {
+            const char* base = file->content + offset;
+            const char* cut = memrchr(base, '\n', chunk_size);
+            if (!cut) cut = memchr(base + chunk_size, '\n', file->size - offset - chunk_size);
+            end = cut ? (size_t)(cut - file->content) + 1 : file->size;
+        }
+
+        if (out) {
+            out[count].file = file;
+            out[count].offset = offset;
+            out[count].length = end - offset;
+        }
+        count++;
+        offset = end;
+    }
+
+    return count;
+}
+
+/* strerror is not thread-safe and loads finish on reader threads */
+static const char* describe_errno(int error, char* text, size_t size) {
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+    return strerror_r(error, text, size);
+#else
+    if (strerror_r(error, text, size) != 0) snprintf(text, size, "error %d", error);
+    return text;
+#endif
+}
+
+/* Runs as each file finishes loading; its chunks go straight to the pool */
+static void file_loaded(RiftIngestBuffer* buffer, void* user_data) {
+    BatchJob* job = (BatchJob*)user_data;
+    BatchFile* file = &job->files[buffer->index];
+
+    file->loaded = buffer;
+    if (buffer->error != 0) {
+        file->error = describe_errno(buffer->error, file->error_text,
+                                     sizeof(file->error_text));
+        finish_file(file);
+        return;
+    }
+    file->content = buffer->data;
+    file->size = buffer->size;
+
+    file->chunk_count = plan_chunks(file, job->chunk_size, NULL);
+    if (file->chunk_count == 0) {
+        finish_file(file);
+        return;
+    }
+
+    file->chunks = calloc(file->chunk_count, sizeof(BatchChunk));
+    if (!file->chunks) {
+        file->chunk_count = 0;
+        file->error = "out of memory";
+        finish_file(file);
+        return;
+    }
+    plan_chunks(file, job->chunk_size, file->chunks);
+    atomic_store(&file->chunks_left, file->chunk_count);
+
+    /* From a reader worker these land on its own deque for idle workers
+     * to steal; from the io_uring caller they are spread round-robin */
+    for (size_t i = 0; i < file->chunk_count; i++) {
+        if (rift_workpool_submit(job->workers, &job->group,
+                                 tokenize_chunk_task, &file->chunks[i]) != 0) {
+            tokenize_chunk_task(&file->chunks[i]);
+        }
+    }
+}
+
+/* =================================================================
+ * BATCH EXECUTION
+ * =================================================================
+ */
+
+/* After the pool is destroyed, so no worker still holds one */
+static void free_local_contexts(BatchJob* job, size_t threads) {
+    if (!job->local_contexts) return;
+    for (size_t i = 0; i < threads; i++) {
+        rift_stage0_destroy(job->local_contexts[i]);
+    }
+    free(job->local_contexts);
+    job->local_contexts = NULL;
+}
+
+static size_t resolve_thread_count(int requested) {
+    if (requested > 0) return (size_t)requested;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (size_t)cpus : 1;
+}
+
+int rift_batch_tokenize(const char* const* paths, size_t count,
+                        const RiftBatchOptions* options,
+                        RiftBatchSummary* summary) {
+    if ((!paths && count > 0) || !options) return -1;
+
+    BatchJob job;
+    memset(&job, 0, sizeof(job));
+    job.options = options;
+    job.chunk_size = options->chunk_size ? options->chunk_size
+                                         : RIFT_BATCH_DEFAULT_CHUNK_SIZE;
+    job.count = count;
+
+    size_t threads = resolve_thread_count(options->thread_count);
+    bool local = options->placement.node_local_memory;
+
+    /* The waiting thread helps run tasks, so it needs a context too */
+    RiftContextPoolConfig pool_config = {
+        .max_contexts = local ? 1 : threads + 1,
+        .prewarm = 0,
+        .token_capacity = RIFT_TOKENIZER_MAX_TOKENS,
+        .token_cache = NULL,
+    };
+
+    RiftWorkPoolConfig worker_config = {
+        .worker_count = threads,
+        .placement = options->placement,
+        .on_worker_start = local ? create_local_context : NULL,
+        .user_data = &job,
+    };
+
+    job.files = calloc(count ? count : 1, sizeof(BatchFile));
+    if (local) job.local_contexts = calloc(threads, sizeof(RiftStage0Context*));
+    job.workers = (!local || job.local_contexts)
+                      ? rift_workpool_create_with_config(&worker_config) : NULL;
+    job.contexts = rift_context_pool_create(&pool_config);
+
+    /* Reads go through io_uring where available, else onto the workers */
+    RiftIngestConfig ingest_config = {
+        .max_file_size = CLI_MAX_FILE_SIZE,
+        .readers = job.workers,
+    };
+    job.ingest = rift_ingest_create(&ingest_config);
+    if (!job.files || !job.workers || !job.contexts || !job.ingest) {
+        if (!job.workers && options->placement.cpu_list[0]) {
+            RIFT_LOG_ERROR("batch: no usable CPUs in \"%s\"", options->placement.cpu_list);
+        }
+        rift_ingest_destroy(job.ingest);
+        rift_context_pool_destroy(job.contexts);
+        rift_workpool_destroy(job.workers);
+        free_local_contexts(&job, threads);
+        free(job.files);
+        return -1;
+    }
+
+    pthread_mutex_init(&job.emit_lock, NULL);
+    rift_task_group_init(&job.group);
+
+    double start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        BatchFile* file = &job.files[i];
+        file->job = &job;
+        file->path = paths[i];
+        atomic_init(&file->done, false);
+        atomic_init(&file->chunks_left, 0);
+    }
+    /* Per-file errors are reported through file->error */
+    rift_ingest_run(job.ingest, paths, count, file_loaded, &job);
+    rift_workpool_wait(job.workers, &job.group);
+    double elapsed = now_seconds() - start;
+
+    RiftBatchSummary totals = { 0 };
+    totals.elapsed = elapsed;
+    for (size_t i = 0; i < count; i++) {
+        BatchFile* file = &job.files[i];
+        totals.files++;
+        if (file->error) totals.failed++;
+        totals.chunks += file->chunk_count;
+        totals.bytes += file->size;
+        totals.tokens += file->tokens;
+        free(file->chunks);
+    }
+
+    RiftWorkPoolStats stats;
+    rift_workpool_get_stats(job.workers, &stats);
+    RIFT_LOG_DEBUG("batch: %zu tasks on %zu workers, %zu stolen, %s ingestion",
+                   stats.executed, stats.worker_count, stats.stolen,
+                   rift_ingest_backend(job.ingest));
+    totals.node_count = rift_workpool_get_node_stats(job.workers, totals.nodes,
+                                                     RIFT_WORKPOOL_MAX_NODES);
+
+    rift_task_group_destroy(&job.group);
+    pthread_mutex_destroy(&job.emit_lock);
+    rift_ingest_destroy(job.ingest);
+    rift_context_pool_destroy(job.contexts);
+    rift_workpool_destroy(job.workers);
+    free_local_contexts(&job, threads);
+    free(job.files);
+
+    if (summary) *summary = totals;
+    return totals.failed == 0 ? 0 : -1;
+}
+
+static void print_summary(const RiftBatchSummary* s, size_t threads, bool per_node) {
+    double seconds = s->elapsed > 0.0 ? s->elapsed : 1e-9;
+    fprintf(stderr, "%zu files (%zu failed), %zu chunks, %zu bytes, %zu tokens "
+            "in %.3f s on %zu threads: %.1f MB/s\n",
+            s->files, s->failed, s->chunks, s->bytes, s->tokens, s->elapsed,
+            threads, (double)s->bytes / seconds / (1024.0 * 1024.0));
+
+    for (size_t i = 0; per_node && i < s->node_count; i++) {
+        fprintf(stderr, "  node %d\t%zu workers\t%zu tasks\t%zu remote\n",
+                s->nodes[i].node, s->nodes[i].workers, s->nodes[i].executed,
+                s->nodes[i].remote);
+    }
+}
+
+/* =================================================================
+ * TESTING AND BENCHMARKING
+ * =================================================================
+ */
+
+int benchmark_tokenization(const char** test_files, int file_count, int thread_count) {
+    if (!test_files || file_count < 0) return -1;
+
+    RiftBatchOptions options = { thread_count, 0, false, NULL, { PIN_NONE, "", false } };
+    RiftBatchSummary summary = { 0 };
+    int result = rift_batch_tokenize(test_files, (size_t)file_count, &options, &summary);
+
+    print_summary(&summary, resolve_thread_count(thread_count), false);
+    return result;
+}
+
+typedef struct {
+    RiftContextPool* contexts;
+    const char* data;
+    size_t length;
+    ssize_t expected;
+    atomic_size_t* mismatches;
+} ConcurrentProbe;
+
+static void concurrent_probe_task(void* arg) {
+    ConcurrentProbe* probe = (ConcurrentProbe*)arg;
+
+    RiftStage0Context* ctx = rift_context_pool_acquire(probe->contexts);
+    ssize_t result = -1;
+    if (ctx) {
+        result = rift_tokenizer_process_with_flags(ctx->tokenizer, probe->data,
+                                                   probe->length, TOKEN_FLAG_NONE);
+        rift_context_pool_release(probe->contexts, ctx);
+    }
+
+    if (result != probe->expected) {
+        atomic_fetch_add(probe->mismatches, 1);
+    }
+}
+
+int test_concurrent_tokenization(int thread_count, const char* test_data, int iterations) {
+    if (!test_data || iterations <= 0) return -1;
+
+    size_t threads = resolve_thread_count(thread_count);
+    size_t length = strlen(test_data);
+
+    /* Single-threaded reference result */
+    RiftStage0Context* reference = rift_stage0_create_with_capacity(RIFT_TOKENIZER_MAX_TOKENS);
+    if (!reference) return -1;
+    ssize_t expected = rift_tokenizer_process_with_flags(reference->tokenizer, test_data,
+                                                         length, TOKEN_FLAG_NONE);
+    rift_stage0_destroy(reference);
+
+    RiftContextPoolConfig pool_config = {
+        .max_contexts = threads + 1,
+        .prewarm = 0,
+        .token_capacity = RIFT_TOKENIZER_MAX_TOKENS,
+        .token_cache = NULL,
+    };
+    RiftContextPool* contexts = rift_context_pool_create(&pool_config);
+    RiftWorkPool* workers = rift_workpool_create(threads);
+    if (!contexts || !workers) {
+        rift_workpool_destroy(workers);
+        rift_context_pool_destroy(contexts);
+        return -1;
+    }
+
+    atomic_size_t mismatches;
+    atomic_init(&mismatches, 0);
+    ConcurrentProbe probe = { contexts, test_data, length, expected, &mismatches };
+
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+    size_t total = (size_t)iterations * threads;
+    for (size_t i = 0; i < total; i++) {
+        if (rift_workpool_submit(workers, &group, concurrent_probe_task, &probe) != 0) {
+            concurrent_probe_task(&probe);
+        }
+    }
+    rift_workpool_wait(workers, &group);
+    rift_task_group_destroy(&group);
+
+    rift_workpool_destroy(workers);
+    rift_context_pool_destroy(contexts);
+
+    size_t failures = atomic_load(&mismatches);
+    if (failures > 0) {
+        fprintf(stderr, "Concurrent tokenization: %zu of %zu runs diverged\n",
+                failures, total);
+        return -1;
+    }
+    return 0;
+}
+
+/* =================================================================
+ * COMMAND ENTRY POINT
+ * =================================================================
+ */
+
+static void print_batch_usage(void) {
+    printf("Usage: riftlang batch [-j N] [-v] [--chunk-size BYTES] <dir|@list|file>...\n");
+    printf("  -j, --threads N         Worker threads (default: online CPUs)\n");
+    printf("  -v, --verbose           Report per-chunk token counts\n");
+    printf("  --chunk-size BYTES      Split files larger than this (default %d)\n",
+           RIFT_BATCH_DEFAULT_CHUNK_SIZE);
+    printf("  --pin MODE              none, node, core or scatter (default none)\n");
+    printf("  --cpus LIST             Restrict workers to CPUs, e.g. 0-7,16-23\n");
+}
+
+static bool parse_pin_policy(const char* text, rift_pin_policy_t* policy) {
+    static const struct { const char* name; rift_pin_policy_t policy; } modes[] = {
+        { "none", PIN_NONE },
+        { "node", PIN_NODE },
+        { "core", PIN_CORE_COMPACT },
+        { "scatter", PIN_CORE_SCATTER },
+    };
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        if (strcmp(text, modes[i].name) == 0) {
+            *policy = modes[i].policy;
+            return true;
+        }
+    }
+    return false;
+}
+
+int batch_command_main(int argc, char** argv) {
+    CLIConfiguration config;
+    memset(&config, 0, sizeof(config));
+    config.thread_count = (int)resolve_thread_count(0);
+
+    RiftBatchOptions options = { 0, 0, false, stdout, { PIN_NONE, "", false } };
+
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-'; i++) {
+        if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--threads") == 0) &&
+            i + 1 < argc) {
+            config.thread_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
+            options.verbose = true;
+        } else if (strcmp(argv[i], "--chunk-size") == 0 && i + 1 < argc) {
+            options.chunk_size = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--pin") == 0 && i + 1 < argc &&
+                   parse_pin_policy(argv[i + 1], &options.placement.pin_policy)) {
+            i++;
+            /* Pinned workers also build their buffers on their own node */
+            options.placement.node_local_memory = options.placement.pin_policy != PIN_NONE;
+        } else if (strcmp(argv[i], "--cpus") == 0 && i + 1 < argc &&
+                   strlen(argv[i + 1]) < sizeof(options.placement.cpu_list)) {
+            strcpy(options.placement.cpu_list, argv[++i]);
+        } else {
+            print_batch_usage();
+            return CLI_ERROR_ARGS;
+        }
+    }
+
+    if (i >= argc) {
+        print_batch_usage();
+        return CLI_ERROR_ARGS;
+    }
+
+    char** paths = NULL;
+    size_t count = 0;
+    if (rift_batch_collect_paths(argv + i, argc - i, &paths, &count) != 0) {
+        return CLI_ERROR_FILE;
+    }
+
+    options.thread_count = EFFECTIVE_THREAD_COUNT(&config);
+
+    RiftBatchSummary summary = { 0 };
+    int result = rift_batch_tokenize((const char* const*)paths, count, &options, &summary);
+    fflush(stdout);
+    print_summary(&summary, (size_t)options.thread_count, options.verbose);
+
+    rift_batch_free_paths(paths, count);
+    return result == 0 ? CLI_SUCCESS : CLI_ERROR_TOKENIZER;
+}
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include "rift-0/core/rift-0.h"
+#include "rift-0/core/lexer/token_cache.h"
+#include "rift-0/core/rift_log.h"
+#include "rift-0/cli/command/batch_command.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -141,7 +144,11 @@ void print_usage() {
     printf("  uml-parse <pattern> <source>   Parse UML relationship\n");
     printf("  uml-validate <pattern> <source> Validate UML governance\n");
     printf("  uml-generate <pattern> <source> Generate UML code\n");
+    printf("  batch [-j N] <dir|@list|file>...  Tokenize many files in parallel\n");
     printf("  (no command)            Run Stage-0 tokenizer on stdin\n");
+    printf("Options:\n");
+    printf("  --cache-dir <dir>       Reuse token streams cached in <dir>\n");
+    printf("  --log-level <level>     trace|debug|info|warn|error|off (default warn)\n");
     printf("  --help                  Show this help message\n");
 }
 /**
@@ -152,25 +159,46 @@ void print_usage() {
  */
 
 int main(int argc, char* argv[]) {
-    if (argc < 2 || strcmp(argv[1], "--help") == 0) {
+    const char* cache_dir = NULL;
+    while (argc >= 3 && strncmp(argv[1], "--", 2) == 0) {
+        if (strcmp(argv[1], "--cache-dir") == 0) {
+            cache_dir = argv[2];
+        } else if (strcmp(argv[1], "--log-level") == 0) {
+            RiftLogLevel level = rift_log_level_from_string(argv[2]);
+            if (level < 0) {
+                fprintf(stderr, "Unknown log level: %s\n", argv[2]);
+                return 1;
+            }
+            rift_log_set_level(level);
+        } else {
+            break;
+        }
+        argv += 2;
+        argc -= 2;
+    }
+
+    const char* command = (argc >= 2) ? argv[1] : "";
+    if ((argc < 2 && !cache_dir) || strcmp(command, "--help") == 0) {
         print_usage();
         return 0;
     }
 
     // If a CLI command is given, handle it; otherwise, process stdin as input
-    if (strcmp(argv[1], "token-type") == 0 && argc >= 3) {
+    if (strcmp(command, "batch") == 0) {
+        return batch_command_main(argc - 1, argv + 1);
+    } else if (strcmp(command, "token-type") == 0 && argc >= 3) {
         // TODO: Call token type analytics (stub)
         printf("[token-type] Not yet implemented. Input: %s\n", argv[2]);
         return 0;
-    } else if (strcmp(argv[1], "token-mem") == 0 && argc >= 3) {
+    } else if (strcmp(command, "token-mem") == 0 && argc >= 3) {
         // TODO: Call token memory analytics (stub)
         printf("[token-mem] Not yet implemented. Input: %s\n", argv[2]);
         return 0;
-    } else if (strcmp(argv[1], "token-value") == 0 && argc >= 3) {
+    } else if (strcmp(command, "token-value") == 0 && argc >= 3) {
         // TODO: Call token value analytics (stub)
         printf("[token-value] Not yet implemented. Input: %s\n", argv[2]);
         return 0;
-    } else if (strcmp(argv[1], "uml-parse") == 0 && argc >= 4) {
+    } else if (strcmp(command, "uml-parse") == 0 && argc >= 4) {
         uml_relationship_t* rel = parse_uml_relationship(argv[2], argv[3]);
         if (rel) {
             printf("UML relationship parsed successfully.\n");
@@ -180,7 +208,7 @@ int main(int argc, char* argv[]) {
             printf("Failed to parse UML relationship.\n");
         }
         return 0;
-    } else if (strcmp(argv[1], "uml-validate") == 0 && argc >= 4) {
+    } else if (strcmp(command, "uml-validate") == 0 && argc >= 4) {
         uml_relationship_t* rel = parse_uml_relationship(argv[2], argv[3]);
         if (rel) {
             bool valid = validate_uml_governance(rel);
@@ -190,7 +218,7 @@ int main(int argc, char* argv[]) {
             printf("Failed to parse UML relationship.\n");
         }
         return 0;
-    } else if (strcmp(argv[1], "uml-generate") == 0 && argc >= 4) {
+    } else if (strcmp(command, "uml-generate") == 0 && argc >= 4) {
         uml_relationship_t* rel = parse_uml_relationship(argv[2], argv[3]);
         if (rel) {
             char buffer[1024];
@@ -210,6 +238,16 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    RiftTokenCache* cache = NULL;
+    if (cache_dir) {
+        RiftTokenCacheConfig cache_config = { cache_dir, 0 };
+        cache = rift_token_cache_open(&cache_config);
+        if (!cache) {
+            fprintf(stderr, "Failed to open token cache at %s\n", cache_dir);
+        }
+        rift_stage0_set_token_cache(ctx, cache);
+    }
+
     // Read all of stdin into a buffer
     char* input = NULL;
     size_t input_size = 0;
@@ -218,6 +256,7 @@ int main(int argc, char* argv[]) {
     if (!input) {
         fprintf(stderr, "Failed to allocate input buffer\n");
         rift_stage0_destroy(ctx);
+        rift_token_cache_close(cache);
         return 1;
     }
     size_t len = 0;
@@ -230,6 +269,7 @@ int main(int argc, char* argv[]) {
                 fprintf(stderr, "Failed to reallocate input buffer\n");
                 free(input);
                 rift_stage0_destroy(ctx);
+                rift_token_cache_close(cache);
                 return 1;
             }
             input = new_input;
@@ -238,25 +278,27 @@ int main(int argc, char* argv[]) {
     }
     input[len] = '\0';
 
-    DualChannelOutput* output = process_stage0(ctx, input);
-    if (!output) {
+    // Tokenize through rift_tokenize_input so an attached cache is used
+    TokenTriplet* tokens = calloc(RIFT_TOKENIZER_MAX_TOKENS, sizeof(TokenTriplet));
+    int token_count = tokens ? rift_tokenize_input(ctx, input, tokens, RIFT_TOKENIZER_MAX_TOKENS) : -1;
+    if (token_count < 0) {
         fprintf(stderr, "Stage-0 processing failed\n");
+        free(tokens);
         free(input);
         rift_stage0_destroy(ctx);
+        rift_token_cache_close(cache);
         return 1;
     }
 
-    // Output classic channel to stdout, quantum channel to stderr
-    if (output->classic_channel) {
-        fwrite(output->classic_channel, 1, output->classic_size, stdout);
-    }
-    if (output->quantum_channel && output->quantum_size > 0) {
-        fwrite(output->quantum_channel, 1, output->quantum_size, stderr);
+    for (int i = 0; i < token_count; i++) {
+        printf("Token[%d]: type=%u, pos=%u, value=%u\n", i,
+               tokens[i].type, tokens[i].mem_ptr, tokens[i].value);
     }
 
-    free_dual_channel_output(output);
+    free(tokens);
     free(input);
     rift_stage0_destroy(ctx);
+    rift_token_cache_close(cache);
     return 0;
 }
 
@@ -0,0 +1,531 @@
+/*
+ * =================================================================
+ * gov_cache.c - RIFT-0 Governance Configuration Cache
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ *
+ * Cache file layout: GovCacheFileHeader, then entry_count records of
+ * GovCacheFileEntry, path bytes and the record, then a hash of all
+ * that precedes it. Files are only ever replaced by rename(2).
+ * =================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/* Project headers */
+#include "rift-0/core/gov/gov_cache.h"
+#include "rift-0/core/rift_hash.h"
+
+#define GOV_CACHE_MAGIC "RGC0"
+#define GOV_CACHE_MAX_PATH 4096
+
+/* Content is hashed twice with independent seeds, as the token cache
+ * does, so one collision cannot pass for unchanged bytes */
+#define GOV_CACHE_SEED_HASH  0
+#define GOV_CACHE_SEED_CHECK (~(uint64_t)0)
+
+typedef struct {
+    char* path;
+    size_t path_length;
+    uint64_t path_hash;
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    int64_t verified_sec;       /* Clock second before the last read */
+    uint64_t content_hash;
+    uint64_t content_check;
+    unsigned char* record;
+} GovCacheEntry;
+
+typedef struct {
+    char magic[4];
+    uint32_t format;
+    uint32_t record_version;
+    uint32_t reserved;
+    uint64_t record_size;
+    uint64_t entry_count;
+} GovCacheFileHeader;
+
+typedef struct {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    int64_t verified_sec;
+    uint64_t content_hash;
+    uint64_t content_check;
+    uint64_t path_length;
+} GovCacheFileEntry;
+
+struct RiftGovCache {
+    pthread_mutex_t lock;
+    size_t record_size;
+    uint32_t record_version;
+    RiftGovValidateFn validate;
+    void* validate_data;
+
+    /* A handful of configurations per project; searched linearly */
+    GovCacheEntry* entries;
+    size_t count;
+    size_t capacity;
+
+    uint64_t* loaded_files;     /* Path hashes of cache files read */
+    size_t loaded_count;
+    size_t loaded_capacity;
+    bool dirty;                 /* Changed since the last load or save */
+
+    size_t stat_hits;
+    size_t content_hits;
+    size_t parses;
+    size_t rejected;
+};
+
+/* =================================================================
+ * LIFECYCLE
+ * =================================================================
+ */
+
+RiftGovCache* rift_gov_cache_create(size_t record_size, uint32_t record_version) {
+    if (record_size == 0) return NULL;
+
+    RiftGovCache* cache = calloc(1, sizeof(RiftGovCache));
+    if (!cache) return NULL;
+
+    cache->record_size = record_size;
+    cache->record_version = record_version;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+void rift_gov_cache_destroy(RiftGovCache* cache) {
+    if (!cache) return;
+
+    for (size_t i = 0; i < cache->count; i++) {
+        free(cache->entries[i].path);
+        free(cache->entries[i].record);
+    }
+    free(cache->entries);
+    free(cache->loaded_files);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+void rift_gov_cache_set_validator(RiftGovCache* cache,
+                                  RiftGovValidateFn validate,
+                                  void* user_data) {
+    if (!cache) return;
+
+    pthread_mutex_lock(&cache->lock);
+    cache->validate = validate;
+    cache->validate_data = user_data;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+/* =================================================================
+ * ENTRIES
+ * =================================================================
+ */
+
+static GovCacheEntry* find_entry(RiftGovCache* cache, const char* path,
+                                 size_t path_length, uint64_t path_hash) {
+    for (size_t i = 0; i < cache->count; i++) {
+        GovCacheEntry* entry = &cache->entries[i];
+        if (entry->path_hash == path_hash && entry->path_length == path_length &&
+            memcmp(entry->path, path, path_length) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static GovCacheEntry* add_entry(RiftGovCache* cache, const char* path,
+                                size_t path_length, uint64_t path_hash) {
+    if (cache->count == cache->capacity) {
+        size_t capacity = cache->capacity ? cache->capacity * 2 : 16;
+        GovCacheEntry* entries = realloc(cache->entries, capacity * sizeof(GovCacheEntry));
+        if (!entries) return NULL;
+        cache->entries = entries;
+        cache->capacity = capacity;
+    }
+
+    GovCacheEntry* entry = &cache->entries[cache->count];
+    memset(entry, 0, sizeof(*entry));
+    entry->path = malloc(path_length + 1);
+    entry->record = malloc(cache->record_size);
+    if (!entry->path || !entry->record) {
+        free(entry->path);
+        free(entry->record);
+        return NULL;
+    }
+    memcpy(entry->path, path, path_length);
+    entry->path[path_length] = '\0';
+    entry->path_length = path_length;
+    entry->path_hash = path_hash;
+    cache->count++;
+    return entry;
+}
+
+static void set_file_stat(GovCacheEntry* entry, const struct stat* st) {
+    entry->dev = (uint64_t)st->st_dev;
+    entry->ino = (uint64_t)st->st_ino;
+    entry->size = (uint64_t)st->st_size;
+    entry->mtime_sec = (int64_t)st->st_mtim.tv_sec;
+    entry->mtime_nsec = (int64_t)st->st_mtim.tv_nsec;
+}
+
+/* The stat alone vouches for the entry only if it matches and the file
+ * was last written more than a second before the contents were read:
+ * an edit in the same second as a read can leave mtime unchanged. */
+static bool stat_is_current(const GovCacheEntry* entry, const struct stat* st) {
+    return entry->dev == (uint64_t)st->st_dev &&
+           entry->ino == (uint64_t)st->st_ino &&
+           entry->size == (uint64_t)st->st_size &&
+           entry->mtime_sec == (int64_t)st->st_mtim.tv_sec &&
+           entry->mtime_nsec == (int64_t)st->st_mtim.tv_nsec &&
+           entry->mtime_sec < entry->verified_sec - 1;
+}
+
+/* Whole file, NUL-terminated; st is filled from the open descriptor */
+static char* read_file(const char* path, struct stat* st, size_t* length) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return NULL;
+
+    struct stat local;
+    if (!st) st = &local;
+    if (fstat(fd, st) != 0 || st->st_size < 0) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t)st->st_size;
+    char* content = malloc(size + 1);
+    if (!content) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = read(fd, content + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    close(fd);
+
+    content[done] = '\0';
+    *length = done;
+    return content;
+}
+
+/* =================================================================
+ * LOOKUP
+ * =================================================================
+ */
+
+int rift_gov_cache_get(RiftGovCache* cache,
+                       const char* path,
+                       RiftGovParseFn parse,
+                       void* user_data,
+                       void* record) {
+    if (!cache || !path || !parse || !record) return -1;
+
+    size_t path_length = strlen(path);
+    uint64_t path_hash = rift_hash64(path, path_length, 0);
+
+    struct stat st;
+    if (stat(path, &st) != 0) return -1;
+
+    pthread_mutex_lock(&cache->lock);
+    GovCacheEntry* entry = find_entry(cache, path, path_length, path_hash);
+    if (entry && stat_is_current(entry, &st)) {
+        memcpy(record, entry->record, cache->record_size);
+        cache->stat_hits++;
+        pthread_mutex_unlock(&cache->lock);
+        return 0;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    /* Taken before the read, so a write during it is never trusted */
+    int64_t now = (int64_t)time(NULL);
+
+    size_t length = 0;
+    char* content = read_file(path, &st, &length);
+    if (!content) return -1;
+
+    uint64_t hash = rift_hash64(content, length, GOV_CACHE_SEED_HASH);
+    uint64_t check = rift_hash64(content, length, GOV_CACHE_SEED_CHECK);
+
+    pthread_mutex_lock(&cache->lock);
+    entry = find_entry(cache, path, path_length, path_hash);
+    if (entry && entry->size == length &&
+        entry->content_hash == hash && entry->content_check == check) {
+        set_file_stat(entry, &st);
+        entry->size = length;
+        entry->verified_sec = now;
+        cache->dirty = true;
+        memcpy(record, entry->record, cache->record_size);
+        cache->content_hits++;
+        pthread_mutex_unlock(&cache->lock);
+        free(content);
+        return 0;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    int result = parse(content, length, record, user_data);
+    free(content);
+    if (result != 0) return result;
+
+    pthread_mutex_lock(&cache->lock);
+    cache->parses++;
+    entry = find_entry(cache, path, path_length, path_hash);
+    if (!entry) entry = add_entry(cache, path, path_length, path_hash);
+    if (entry) {
+        /* Size as read, so a file that grew mid-read never matches */
+        set_file_stat(entry, &st);
+        entry->size = length;
+        entry->verified_sec = now;
+        entry->content_hash = hash;
+        entry->content_check = check;
+        memcpy(entry->record, record, cache->record_size);
+        cache->dirty = true;
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return 0;
+}
+
+/* =================================================================
+ * CACHE FILE
+ * =================================================================
+ */
+
+/* Note a cache file as read; false if it already was. Caller holds
+ * the lock. */
+static bool mark_loaded(RiftGovCache* cache, uint64_t file_hash) {
+    for (size_t i = 0; i < cache->loaded_count; i++) {
+        if (cache->loaded_files[i] == file_hash) return false;
+    }
+    if (cache->loaded_count == cache->loaded_capacity) {
+        size_t capacity = cache->loaded_capacity ? cache->loaded_capacity * 2 : 4;
+        uint64_t* files = realloc(cache->loaded_files, capacity * sizeof(uint64_t));
+        if (!files) return true;
+        cache->loaded_files = files;
+        cache->loaded_capacity = capacity;
+    }
+    cache->loaded_files[cache->loaded_count++] = file_hash;
+    return true;
+}
+
+static uint64_t file_seed(const RiftGovCache* cache) {
+    return rift_hash64_combine((uint64_t)cache->record_version, (uint64_t)cache->record_size);
+}
+
+static int load_entries(RiftGovCache* cache, const char* data, size_t length) {
+    if (length < sizeof(GovCacheFileHeader) + sizeof(uint64_t)) return -1;
+
+    size_t body = length - sizeof(uint64_t);
+    uint64_t stored;
+    memcpy(&stored, data + body, sizeof(stored));
+    if (stored != rift_hash64(data, body, file_seed(cache))) return -1;
+
+    GovCacheFileHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, GOV_CACHE_MAGIC, 4) != 0 ||
+        header.format != RIFT_GOV_CACHE_FORMAT ||
+        header.record_version != cache->record_version ||
+        header.record_size != (uint64_t)cache->record_size) {
+        return -1;
+    }
+
+    /* Records are checked in scratch space before they reach the table */
+    unsigned char* scratch = malloc(cache->record_size);
+    if (!scratch) return -1;
+
+    size_t at = sizeof(header);
+    int added = 0;
+    for (uint64_t i = 0; i < header.entry_count; i++) {
+        GovCacheFileEntry saved;
+        if (body - at < sizeof(saved)) {
+            added = -1;
+            break;
+        }
+        memcpy(&saved, data + at, sizeof(saved));
+        at += sizeof(saved);
+
+        if (saved.path_length == 0 || saved.path_length >= GOV_CACHE_MAX_PATH ||
+            body - at < saved.path_length + cache->record_size) {
+            added = -1;
+            break;
+        }
+        const char* path = data + at;
+        size_t path_length = (size_t)saved.path_length;
+        at += path_length;
+        const char* record = data + at;
+        at += cache->record_size;
+
+        /* What this process has seen is at least as recent */
+        uint64_t path_hash = rift_hash64(path, path_length, 0);
+        if (find_entry(cache, path, path_length, path_hash)) continue;
+
+        memcpy(scratch, record, cache->record_size);
+        if (cache->validate && !cache->validate(scratch, cache->validate_data)) {
+            cache->rejected++;
+            continue;
+        }
+
+        GovCacheEntry* entry = add_entry(cache, path, path_length, path_hash);
+        if (!entry) break;
+        entry->dev = saved.dev;
+        entry->ino = saved.ino;
+        entry->size = saved.size;
+        entry->mtime_sec = saved.mtime_sec;
+        entry->mtime_nsec = saved.mtime_nsec;
+        entry->verified_sec = saved.verified_sec;
+        entry->content_hash = saved.content_hash;
+        entry->content_check = saved.content_check;
+        memcpy(entry->record, scratch, cache->record_size);
+        added++;
+    }
+    free(scratch);
+    return added;
+}
+
+int rift_gov_cache_load(RiftGovCache* cache, const char* file) {
+    if (!cache || !file) return -1;
+
+    pthread_mutex_lock(&cache->lock);
+
+    if (!mark_loaded(cache, rift_hash64(file, strlen(file), 0))) {
+        pthread_mutex_unlock(&cache->lock);
+        return 0;
+    }
+
+    size_t length = 0;
+    char* data = read_file(file, NULL, &length);
+    int added = data ? load_entries(cache, data, length) : -1;
+    free(data);
+
+    pthread_mutex_unlock(&cache->lock);
+    return added;
+}
+
+static int write_all(int fd, const void* data, size_t size) {
+    const char* p = (const char*)data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += written;
+        size -= (size_t)written;
+    }
+    return 0;
+}
+
+int rift_gov_cache_save(RiftGovCache* cache, const char* file) {
+    if (!cache || !file) return -1;
+
+    pthread_mutex_lock(&cache->lock);
+
+    if (!cache->dirty) {
+        pthread_mutex_unlock(&cache->lock);
+        return 0;
+    }
+
+    size_t length = sizeof(GovCacheFileHeader) + sizeof(uint64_t);
+    for (size_t i = 0; i < cache->count; i++) {
+        length += sizeof(GovCacheFileEntry) + cache->entries[i].path_length + cache->record_size;
+    }
+
+    char* data = malloc(length);
+    if (!data) {
+        pthread_mutex_unlock(&cache->lock);
+        return -1;
+    }
+
+    GovCacheFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GOV_CACHE_MAGIC, 4);
+    header.format = RIFT_GOV_CACHE_FORMAT;
+    header.record_version = cache->record_version;
+    header.record_size = cache->record_size;
+    header.entry_count = cache->count;
+    memcpy(data, &header, sizeof(header));
+
+    size_t at = sizeof(header);
+    for (size_t i = 0; i < cache->count; i++) {
+        const GovCacheEntry* entry = &cache->entries[i];
+        GovCacheFileEntry saved = {
+            .dev = entry->dev,
+            .ino = entry->ino,
+            .size = entry->size,
+            .mtime_sec = entry->mtime_sec,
+            .mtime_nsec = entry->mtime_nsec,
+            .verified_sec = entry->verified_sec,
+            .content_hash = entry->content_hash,
+            .content_check = entry->content_check,
+            .path_length = entry->path_length,
+        };
+        memcpy(data + at, &saved, sizeof(saved));
+        at += sizeof(saved);
+        memcpy(data + at, entry->path, entry->path_length);
+        at += entry->path_length;
+        memcpy(data + at, entry->record, cache->record_size);
+        at += cache->record_size;
+    }
+    uint64_t sum = rift_hash64(data, at, file_seed(cache));
+    memcpy(data + at, &sum, sizeof(sum));
+
+    char tmp_path[GOV_CACHE_MAX_PATH];
+    int result = -1;
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp-%ld", file, (long)getpid()) <
+        (int)sizeof(tmp_path)) {
+        int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd >= 0) {
+            bool written = write_all(fd, data, length) == 0;
+            if (close(fd) == 0 && written && rename(tmp_path, file) == 0) {
+                result = 0;
+            } else {
+                unlink(tmp_path);
+            }
+        }
+    }
+    free(data);
+
+    if (result == 0) {
+        cache->dirty = false;
+        mark_loaded(cache, rift_hash64(file, strlen(file), 0));
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+    return result;
+}
+
+void rift_gov_cache_get_stats(RiftGovCache* cache, RiftGovCacheStats* stats) {
+    if (!cache || !stats) return;
+
+    pthread_mutex_lock(&cache->lock);
+    stats->stat_hits = cache->stat_hits;
+    stats->content_hits = cache->content_hits;
+    stats->parses = cache->parses;
+    stats->entries = cache->count;
+    stats->rejected = cache->rejected;
+    pthread_mutex_unlock(&cache->lock);
+}
@@ -91,8 +91,41 @@ char* strdup(const char* s);
 #include <unistd.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <pthread.h>
 #include <cjson/cJSON.h>
 #include "rift-0/core/gov/rift-gov.0.h"
+#include "rift-0/core/gov/gov_cache.h"
+#include "rift-0/core/rift_log.h"
+
+/* Parsed stage configurations, kept across runs in the project root */
+#define GOVERNANCE_CACHE_FILE ".riftgov.cache"
+
+/* Cache record: the configuration plus its timestamp, parsed once */
+typedef struct {
+    governance_config_t config;
+    time_t config_time;
+    int timestamp_valid;
+} cached_stage_config_t;
+
+/* Bump when governance_config_t or the record above changes.
+ * 2: config_time is UTC (timegm), not local time. */
+#define GOVERNANCE_CACHE_RECORD_VERSION 2
+
+static RiftGovCache *g_governance_cache = NULL;
+static pthread_once_t g_governance_cache_once = PTHREAD_ONCE_INIT;
+
+static bool validate_cached_stage_config(void *record, void *user_data);
+
+static void governance_cache_init(void) {
+    g_governance_cache = rift_gov_cache_create(sizeof(cached_stage_config_t),
+                                               GOVERNANCE_CACHE_RECORD_VERSION);
+    rift_gov_cache_set_validator(g_governance_cache, validate_cached_stage_config, NULL);
+}
+
+static RiftGovCache *governance_cache(void) {
+    pthread_once(&g_governance_cache_once, governance_cache_init);
+    return g_governance_cache;
+}
 
 
 /**
@@ -116,7 +149,7 @@ validation_result_t rift_validation_init(validation_context_t *ctx, const char *
     
     ctx->validation_log = fopen(log_path, "a");
     if (!ctx->validation_log) {
-        fprintf(stderr, "[AEGIS] Warning: Could not open validation log at %s\n", log_path);
+        RIFT_LOG_WARN("[AEGIS] Could not open validation log at %s", log_path);
         ctx->validation_log = stderr;  // Fallback to stderr
     }
     
@@ -124,6 +157,8 @@ validation_result_t rift_validation_init(validation_context_t *ctx, const char *
     return VALIDATION_SUCCESS;
 }
 
+static validation_result_t parse_governance_content(const char *json_content, governance_config_t *config);
+
 /**
  * @brief Parse JSON governance configuration file
  * @param file_path Path to governance file
@@ -151,9 +186,19 @@ validation_result_t parse_governance_file(const char *file_path, governance_conf
     json_content[file_size] = '\0';
     fclose(file);
     
-    // Parse JSON
-    cJSON *json = cJSON_Parse(json_content);
+    validation_result_t result = parse_governance_content(json_content, config);
     free(json_content);
+    return result;
+}
+
+/**
+ * @brief Parse a JSON governance configuration held in memory
+ * @param json_content NUL-terminated JSON text
+ * @param config Output governance configuration
+ * @return validation_result_t Parsing result
+ */
+static validation_result_t parse_governance_content(const char *json_content, governance_config_t *config) {
+    cJSON *json = cJSON_Parse(json_content);
     
     if (!json) {
         return VALIDATION_SCHEMA_VIOLATION;
@@ -206,6 +251,30 @@ validation_result_t parse_governance_file(const char *file_path, governance_conf
     return VALIDATION_SUCCESS;
 }
 
+static int parse_timestamp(const char *timestamp, time_t *config_time) {
+    // Basic timestamp parsing (assumes format: YYYY-MM-DDTHH:MM:SSZ)
+    struct tm timestamp_tm = {0};
+    if (strptime(timestamp, "%Y-%m-%dT%H:%M:%SZ", &timestamp_tm) == NULL) {
+        return 0;
+    }
+    
+    // The trailing Z means UTC; mktime would apply the local zone
+    *config_time = timegm(&timestamp_tm);
+    return 1;
+}
+
+/* The window is relative to now, so it is checked on every run */
+static validation_result_t check_timestamp_expiry(time_t config_time) {
+    time_t current_time = time(NULL);
+    time_t expiry_threshold = current_time - (GOVERNANCE_EXPIRY_DAYS * 24 * 60 * 60);
+    
+    if (config_time < expiry_threshold) {
+        return VALIDATION_EXPIRED_GOVERNANCE;
+    }
+    
+    return VALIDATION_SUCCESS;
+}
+
 /**
  * @brief Validate timestamp freshness (90-day expiration window)
  * @param timestamp ISO 8601 timestamp string
@@ -213,24 +282,63 @@ validation_result_t parse_governance_file(const char *file_path, governance_conf
  */
 validation_result_t validate_timestamp_freshness(const char *timestamp) {
     // Simplified timestamp validation - production implementation would use proper ISO 8601 parsing
-    time_t current_time = time(NULL);
-    time_t expiry_threshold = current_time - (GOVERNANCE_EXPIRY_DAYS * 24 * 60 * 60);
-    
-    // Basic timestamp parsing (assumes format: YYYY-MM-DDTHH:MM:SSZ)
-    struct tm timestamp_tm = {0};
-    if (strptime(timestamp, "%Y-%m-%dT%H:%M:%SZ", &timestamp_tm) == NULL) {
+    time_t config_time;
+    if (!parse_timestamp(timestamp, &config_time)) {
         return VALIDATION_SCHEMA_VIOLATION;
     }
     
-    time_t config_time = mktime(&timestamp_tm);
-    
-    if (config_time < expiry_threshold) {
-        return VALIDATION_EXPIRED_GOVERNANCE;
+    return check_timestamp_expiry(config_time);
+}
+
+/* RiftGovParseFn: builds the cached record for a stage configuration */
+static int parse_cached_stage_config(const char *content, size_t length, void *record, void *user_data) {
+    cached_stage_config_t *cached = (cached_stage_config_t *)record;
+    (void)length;
+    (void)user_data;
+    
+    memset(cached, 0, sizeof(*cached));
+    validation_result_t result = parse_governance_content(content, &cached->config);
+    if (result != VALIDATION_SUCCESS) {
+        return result;
     }
     
+    cached->timestamp_valid = parse_timestamp(cached->config.timestamp, &cached->config_time);
     return VALIDATION_SUCCESS;
 }
 
+#define TERMINATE_FIELD(field) ((field)[sizeof(field) - 1] = '\0')
+
+/* RiftGovValidateFn: records loaded from the cache file are untrusted input */
+static bool validate_cached_stage_config(void *record, void *user_data) {
+    cached_stage_config_t *cached = (cached_stage_config_t *)record;
+    governance_config_t *config = &cached->config;
+    (void)user_data;
+    
+    // Strings end up in %s, strcmp and the NLink command line
+    TERMINATE_FIELD(config->package_name);
+    TERMINATE_FIELD(config->version);
+    TERMINATE_FIELD(config->timestamp);
+    TERMINATE_FIELD(config->entry_point);
+    
+    if (config->stage_type != STAGE_TYPE_LEGACY &&
+        config->stage_type != STAGE_TYPE_EXPERIMENTAL &&
+        config->stage_type != STAGE_TYPE_STABLE) {
+        return false;
+    }
+    if ((config->authorized_stakeholders &
+         ~(STAKEHOLDER_USER | STAKEHOLDER_DEVELOPER | STAKEHOLDER_VENDOR)) != 0) {
+        return false;
+    }
+    config->semverx_lock = config->semverx_lock != 0;
+    config->nlink_enabled = config->nlink_enabled != 0;
+    
+    // Derived from the timestamp again instead of taken from the file
+    cached->timestamp_valid = parse_timestamp(config->timestamp, &cached->config_time);
+    return true;
+}
+
+#undef TERMINATE_FIELD
+
 /**
  * @brief Validate SemVerX compliance through NLink integration
  * @param ctx Validation context
@@ -319,8 +427,21 @@ validation_result_t validate_stage_governance(validation_context_t *ctx, int sta
     char primary_config_path[MAX_PATH_LENGTH];
     snprintf(primary_config_path, sizeof(primary_config_path), "%s/.riftrc.%d", ctx->project_root, stage_id);
     
-    governance_config_t stage_config;
-    validation_result_t result = parse_governance_file(primary_config_path, &stage_config);
+    // Unchanged configurations are answered from the governance cache
+    cached_stage_config_t cached;
+    validation_result_t result;
+    RiftGovCache *cache = governance_cache();
+    if (cache) {
+        int status = rift_gov_cache_get(cache, primary_config_path, parse_cached_stage_config, NULL, &cached);
+        result = status < 0 ? VALIDATION_MISSING_GOVERNANCE : (validation_result_t)status;
+    } else {
+        memset(&cached, 0, sizeof(cached));
+        result = parse_governance_file(primary_config_path, &cached.config);
+        if (result == VALIDATION_SUCCESS) {
+            cached.timestamp_valid = parse_timestamp(cached.config.timestamp, &cached.config_time);
+        }
+    }
+    governance_config_t stage_config = cached.config;
     
     if (result != VALIDATION_SUCCESS) {
         fprintf(ctx->validation_log, "[STAGE%d] Primary configuration validation failed: %d\n", stage_id, result);
@@ -328,7 +449,7 @@ validation_result_t validate_stage_governance(validation_context_t *ctx, int sta
     }
     
     // Timestamp freshness validation
-    result = validate_timestamp_freshness(stage_config.timestamp);
+    result = cached.timestamp_valid ? check_timestamp_expiry(cached.config_time) : VALIDATION_SCHEMA_VIOLATION;
     if (result != VALIDATION_SUCCESS) {
         fprintf(ctx->validation_log, "[STAGE%d] Timestamp validation failed\n", stage_id);
         return result;
@@ -377,6 +498,13 @@ validation_result_t validate_complete_pipeline(validation_context_t *ctx) {
     
     fprintf(ctx->validation_log, "[PIPELINE] Starting complete pipeline validation\n");
     
+    char cache_path[MAX_PATH_LENGTH];
+    snprintf(cache_path, sizeof(cache_path), "%s/%s", ctx->project_root, GOVERNANCE_CACHE_FILE);
+    RiftGovCache *cache = governance_cache();
+    if (cache) {
+        rift_gov_cache_load(cache, cache_path);
+    }
+    
     for (int stage_id = 0; stage_id < MAX_STAGE_COUNT; stage_id++) {
         validation_result_t stage_result = validate_stage_governance(ctx, stage_id);
         
@@ -385,6 +513,9 @@ validation_result_t validate_complete_pipeline(validation_context_t *ctx) {
             case VALIDATION_EXPIRED_GOVERNANCE:
                 // Critical failures halt the build
                 fprintf(ctx->validation_log, "[PIPELINE] Critical failure at stage %d: %d\n", stage_id, stage_result);
+                if (cache) {
+                    rift_gov_cache_save(cache, cache_path);
+                }
                 return stage_result;
                 
             case VALIDATION_MISSING_GOVERNANCE:
@@ -413,6 +544,10 @@ validation_result_t validate_complete_pipeline(validation_context_t *ctx) {
         }
     }
     
+    if (cache && rift_gov_cache_save(cache, cache_path) != 0) {
+        fprintf(ctx->validation_log, "[PIPELINE] Could not write governance cache %s\n", cache_path);
+    }
+    
     fprintf(ctx->validation_log, "[PIPELINE] Validation completed with result: %d\n", overall_result);
     return overall_result;
 }
@@ -0,0 +1,391 @@
+/*
+ * =================================================================
+ * heap_queue.c - RIFT-0 Concurrent Priority Queue
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "rift-0/core/lexer/heap_queue.h"
+
+#define HQ_EMPTY_TOP LLONG_MAX
+#define HQ_MIN_SHARD_CAPACITY 16
+
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    Item* heap;
+    size_t size;
+    size_t capacity;
+    atomic_llong top;           /* Lowest priority held, HQ_EMPTY_TOP if none */
+} HeapShard;
+
+struct HeapQueue {
+    HeapShard* shards;
+    size_t shard_count;         /* Power of two */
+
+    atomic_size_t count;
+    atomic_size_t waiters;
+    atomic_bool closed;
+
+    pthread_mutex_t wait_lock;
+    pthread_cond_t wait_cond;
+};
+
+static _Thread_local unsigned int t_seed;
+
+static unsigned int next_random(void) {
+    unsigned int x = t_seed;
+    if (x == 0) {
+        x = (unsigned int)(uintptr_t)&t_seed ^ 0x9E3779B9u;
+    }
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t_seed = x;
+    return x;
+}
+
+/* =================================================================
+ * SHARD HEAP OPERATIONS (caller holds the shard lock)
+ * =================================================================
+ */
+
+static int shard_reserve(HeapShard* shard, size_t extra) {
+    if (shard->size + extra <= shard->capacity) return 0;
+
+    size_t capacity = shard->capacity ? shard->capacity : HQ_MIN_SHARD_CAPACITY;
+    while (capacity < shard->size + extra) capacity *= 2;
+
+    Item* heap = realloc(shard->heap, capacity * sizeof(Item));
+    if (!heap) return -1;
+    shard->heap = heap;
+    shard->capacity = capacity;
+    return 0;
+}
+
+static void shard_push(HeapShard* shard, Item item) {
+    size_t i = shard->size++;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (shard->heap[parent].priority <= item.priority) break;
+        shard->heap[i] = shard->heap[parent];
+        i = parent;
+    }
+    shard->heap[i] = item;
+}
+
+static Item shard_pop(HeapShard* shard) {
+    Item root = shard->heap[0];
+    Item last = shard->heap[--shard->size];
+    size_t n = shard->size;
+    size_t i = 0;
+    size_t child = 1;
+
+    while (child < n) {
+        if (child + 1 < n && shard->heap[child + 1].priority < shard->heap[child].priority) {
+            child++;
+        }
+        if (last.priority <= shard->heap[child].priority) break;
+        shard->heap[i] = shard->heap[child];
+        i = child;
+        child = 2 * i + 1;
+    }
+    if (n > 0) shard->heap[i] = last;
+
+    return root;
+}
+
+static void shard_publish(HeapShard* shard) {
+    atomic_store_explicit(&shard->top,
+                          shard->size ? (long long)shard->heap[0].priority : HQ_EMPTY_TOP,
+                          memory_order_relaxed);
+}
+
+static long long shard_top(const HeapQueue* hq, size_t index) {
+    return atomic_load_explicit(&hq->shards[index].top, memory_order_relaxed);
+}
+
+/* =================================================================
+ * WAKEUPS
+ * =================================================================
+ */
+
+static void wake_consumers(HeapQueue* hq, size_t count) {
+    if (atomic_load(&hq->waiters) == 0) return;
+
+    pthread_mutex_lock(&hq->wait_lock);
+    if (count > 1) {
+        pthread_cond_broadcast(&hq->wait_cond);
+    } else {
+        pthread_cond_signal(&hq->wait_cond);
+    }
+    pthread_mutex_unlock(&hq->wait_lock);
+}
+
+/* =================================================================
+ * LIFECYCLE
+ * =================================================================
+ */
+
+static size_t default_shard_count(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t target = cpus > 0 ? (size_t)cpus * 2 : 2;
+    return target > HQ_MAX_SHARDS ? HQ_MAX_SHARDS : target;
+}
+
+HeapQueue* hq_create_sharded(int capacity, int shard_count) {
+    if (capacity < 0 || shard_count < 1) return NULL;
+
+    size_t shards = 1;
+    while (shards < (size_t)shard_count) shards <<= 1;
+
+    HeapQueue* hq = calloc(1, sizeof(HeapQueue));
+    if (!hq) return NULL;
+
+    hq->shards = aligned_alloc(_Alignof(HeapShard), shards * sizeof(HeapShard));
+    if (!hq->shards) {
+        free(hq);
+        return NULL;
+    }
+    memset(hq->shards, 0, shards * sizeof(HeapShard));
+    hq->shard_count = shards;
+
+    size_t per_shard = (size_t)capacity / shards;
+    if (per_shard < HQ_MIN_SHARD_CAPACITY) per_shard = HQ_MIN_SHARD_CAPACITY;
+
+    for (size_t i = 0; i < shards; i++) {
+        HeapShard* shard = &hq->shards[i];
+        pthread_mutex_init(&shard->lock, NULL);
+        atomic_init(&shard->top, HQ_EMPTY_TOP);
+        if (shard_reserve(shard, per_shard) != 0) {
+            hq_destroy(hq);
+            return NULL;
+        }
+    }
+
+    atomic_init(&hq->count, 0);
+    atomic_init(&hq->waiters, 0);
+    atomic_init(&hq->closed, false);
+    pthread_mutex_init(&hq->wait_lock, NULL);
+    pthread_cond_init(&hq->wait_cond, NULL);
+
+    return hq;
+}
+
+HeapQueue* hq_create(int capacity) {
+    return hq_create_sharded(capacity, (int)default_shard_count());
+}
+
+void hq_destroy(HeapQueue* hq) {
+    if (!hq) return;
+
+    for (size_t i = 0; i < hq->shard_count; i++) {
+        pthread_mutex_destroy(&hq->shards[i].lock);
+        free(hq->shards[i].heap);
+    }
+    pthread_cond_destroy(&hq->wait_cond);
+    pthread_mutex_destroy(&hq->wait_lock);
+    free(hq->shards);
+    free(hq);
+}
+
+/* =================================================================
+ * ENQUEUE
+ * =================================================================
+ */
+
+/* Lock the first shard that is free, starting at a random one */
+static HeapShard* lock_any_shard(HeapQueue* hq) {
+    size_t mask = hq->shard_count - 1;
+    size_t start = next_random() & mask;
+
+    for (size_t i = 0; i < hq->shard_count; i++) {
+        HeapShard* shard = &hq->shards[(start + i) & mask];
+        if (pthread_mutex_trylock(&shard->lock) == 0) return shard;
+    }
+
+    HeapShard* shard = &hq->shards[start];
+    pthread_mutex_lock(&shard->lock);
+    return shard;
+}
+
+int hq_enqueue(HeapQueue* hq, int priority, int value) {
+    Item item = { priority, value };
+    return hq_enqueue_batch(hq, &item, 1);
+}
+
+int hq_enqueue_batch(HeapQueue* hq, const Item* items, size_t count) {
+    if (!hq || (!items && count > 0)) return -1;
+    if (atomic_load(&hq->closed)) return -1;
+    if (count == 0) return 0;
+
+    /* Count the items before a consumer can see them: every pop
+     * decrements count, which must not go below zero */
+    HeapShard* shard = lock_any_shard(hq);
+    atomic_fetch_add(&hq->count, count);
+    if (shard_reserve(shard, count) != 0) {
+        atomic_fetch_sub(&hq->count, count);
+        pthread_mutex_unlock(&shard->lock);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        shard_push(shard, items[i]);
+    }
+    shard_publish(shard);
+    pthread_mutex_unlock(&shard->lock);
+
+    wake_consumers(hq, count);
+    return 0;
+}
+
+/* =================================================================
+ * DEQUEUE
+ * =================================================================
+ */
+
+static bool pop_from(HeapQueue* hq, HeapShard* shard, Item* out) {
+    bool found = false;
+    if (shard->size > 0) {
+        *out = shard_pop(shard);
+        shard_publish(shard);
+        found = true;
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (found) atomic_fetch_sub(&hq->count, 1);
+    return found;
+}
+
+bool hq_try_dequeue(HeapQueue* hq, Item* out) {
+    if (!hq || !out) return false;
+    if (atomic_load(&hq->count) == 0) return false;
+
+    size_t mask = hq->shard_count - 1;
+
+    /* Two random choices, take the better published minimum */
+    size_t a = next_random() & mask;
+    size_t b = next_random() & mask;
+    size_t best = shard_top(hq, b) < shard_top(hq, a) ? b : a;
+    if (shard_top(hq, best) != HQ_EMPTY_TOP &&
+        pthread_mutex_trylock(&hq->shards[best].lock) == 0 &&
+        pop_from(hq, &hq->shards[best], out)) {
+        return true;
+    }
+
+    /* Sparse or contended: sweep every shard that claims an item */
+    for (size_t i = 0; i < hq->shard_count; i++) {
+        HeapShard* shard = &hq->shards[(best + i) & mask];
+        if (atomic_load_explicit(&shard->top, memory_order_relaxed) == HQ_EMPTY_TOP) continue;
+        pthread_mutex_lock(&shard->lock);
+        if (pop_from(hq, shard, out)) return true;
+    }
+
+    return false;
+}
+
+Item hq_dequeue(HeapQueue* hq) {
+    Item item = { 0, 0 };
+    hq_try_dequeue(hq, &item);
+    return item;
+}
+
+int hq_dequeue_timed(HeapQueue* hq, Item* out, int timeout_ms) {
+    if (!hq || !out) return -1;
+
+    struct timespec deadline;
+    if (timeout_ms > 0) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    for (;;) {
+        if (hq_try_dequeue(hq, out)) return 0;
+        if (timeout_ms == 0) return -1;
+
+        /* Register as a waiter before re-checking so enqueue cannot miss us */
+        int rc = 0;
+        pthread_mutex_lock(&hq->wait_lock);
+        atomic_fetch_add(&hq->waiters, 1);
+        while (atomic_load(&hq->count) == 0 && !atomic_load(&hq->closed) && rc == 0) {
+            if (timeout_ms < 0) {
+                rc = pthread_cond_wait(&hq->wait_cond, &hq->wait_lock);
+            } else {
+                rc = pthread_cond_timedwait(&hq->wait_cond, &hq->wait_lock, &deadline);
+            }
+        }
+        atomic_fetch_sub(&hq->waiters, 1);
+        pthread_mutex_unlock(&hq->wait_lock);
+
+        if (atomic_load(&hq->count) == 0 && (rc == ETIMEDOUT || atomic_load(&hq->closed))) {
+            return hq_try_dequeue(hq, out) ? 0 : -1;
+        }
+    }
+}
+
+size_t hq_dequeue_batch(HeapQueue* hq, Item* out, size_t max) {
+    if (!hq || !out) return 0;
+
+    size_t taken = 0;
+    while (taken < max && atomic_load(&hq->count) > 0) {
+        /* Drain the shard with the lowest minimum, but only down to the
+         * runner-up's minimum so the batch stays close to sorted. */
+        size_t best = 0;
+        long long best_top = HQ_EMPTY_TOP;
+        long long next_top = HQ_EMPTY_TOP;
+        for (size_t i = 0; i < hq->shard_count; i++) {
+            long long top = shard_top(hq, i);
+            if (top < best_top) {
+                next_top = best_top;
+                best_top = top;
+                best = i;
+            } else if (top < next_top) {
+                next_top = top;
+            }
+        }
+        if (best_top == HQ_EMPTY_TOP) break;
+
+        HeapShard* shard = &hq->shards[best];
+        size_t popped = 0;
+        pthread_mutex_lock(&shard->lock);
+        while (taken < max && shard->size > 0 &&
+               (popped == 0 || shard->heap[0].priority <= next_top)) {
+            out[taken++] = shard_pop(shard);
+            popped++;
+        }
+        shard_publish(shard);
+        pthread_mutex_unlock(&shard->lock);
+
+        if (popped > 0) atomic_fetch_sub(&hq->count, popped);
+    }
+
+    return taken;
+}
+
+void hq_close(HeapQueue* hq) {
+    if (!hq) return;
+
+    pthread_mutex_lock(&hq->wait_lock);
+    atomic_store(&hq->closed, true);
+    pthread_cond_broadcast(&hq->wait_cond);
+    pthread_mutex_unlock(&hq->wait_lock);
+}
+
+size_t hq_size(const HeapQueue* hq) {
+    return hq ? atomic_load(&((HeapQueue*)hq)->count) : 0;
+}
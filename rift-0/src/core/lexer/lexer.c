@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <sys/types.h>
 #include <errno.h>
+#include <stdatomic.h>
 
 /* Project headers */
 #include "rift-0/core/lexer/tokenizer_types.h"
@@ -91,9 +92,9 @@ char* strdup(const char* s);
 
 
 // Helper functions
-static size_t next_id = 1;
+static atomic_size_t next_id = 1;
 static size_t generate_id(void) {
-    return next_id++;
+    return atomic_fetch_add_explicit(&next_id, 1, memory_order_relaxed);
 }
 
 // State functions
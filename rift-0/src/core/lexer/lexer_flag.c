@@ -9,6 +9,10 @@
 
 /* Project headers */
 #include "rift-0/core/lexer/tokenizer_types.h"
+#include "rift-0/core/rift_common.h"
+#include "rift-0/core/rift_log.h"
+#include "rift-0/core/rift_scheduler.h"
+#include "rift-0/core/rift_telemetry.h"
 
 
 
@@ -86,69 +90,6 @@ char* strdup(const char* s);
 
 
 
-// --- Thread-safe HeapQueue implementation ---
-HeapQueue* hq_create(int capacity) {
-    HeapQueue* hq = (HeapQueue*)malloc(sizeof(HeapQueue));
-    hq->capacity = capacity;
-    hq->size = 0;
-    hq->heap = (Item*)malloc(capacity * sizeof(Item));
-    pthread_mutex_init(&hq->lock, NULL);
-    return hq;
-}
-
-void hq_destroy(HeapQueue* hq) {
-    if (!hq) return;
-    free(hq->heap);
-    pthread_mutex_destroy(&hq->lock);
-    free(hq);
-}
-
-void hq_enqueue(HeapQueue* hq, int priority, int value) {
-    pthread_mutex_lock(&hq->lock);
-    if (hq->size == hq->capacity) {
-        fprintf(stderr, "HeapQueue is full. Cannot enqueue.\n");
-        pthread_mutex_unlock(&hq->lock);
-        return;
-    }
-    Item item = { priority, value };
-    int i = hq->size++;
-    int parent = (i - 1) / 2;
-    while (i > 0 && hq->heap[parent].priority > item.priority) {
-        hq->heap[i] = hq->heap[parent];
-        i = parent;
-        parent = (i - 1) / 2;
-    }
-    hq->heap[i] = item;
-    pthread_mutex_unlock(&hq->lock);
-}
-
-Item hq_dequeue(HeapQueue* hq) {
-    pthread_mutex_lock(&hq->lock);
-    if (hq->size == 0) {
-        fprintf(stderr, "HeapQueue is empty. Cannot dequeue.\n");
-        pthread_mutex_unlock(&hq->lock);
-        return (Item){0, 0};
-    }
-    Item root = hq->heap[0];
-    Item last = hq->heap[--hq->size];
-    int i = 0;
-    int child = 1;
-    while (child < hq->size) {
-        if (child + 1 < hq->size && hq->heap[child + 1].priority < hq->heap[child].priority) {
-            child++;
-        }
-        if (last.priority <= hq->heap[child].priority) {
-            break;
-        }
-        hq->heap[i] = hq->heap[child];
-        i = child;
-        child = 2 * i + 1;
-    }
-    hq->heap[i] = last;
-    pthread_mutex_unlock(&hq->lock);
-    return root;
-}
-
 // --- Lexer flag management ---
 void lexer_set_flag(LexerContext* ctx, LexerFlags flag) {
     ctx->flags |= flag;
@@ -458,10 +399,13 @@ void rift_envelope_destroy(rift_token_access_envelope_t* envelope);
     do { \
         int _checkpoint_result = rift_governance_checkpoint(job_ctx, checkpoint_name); \
         if (_checkpoint_result != 0) { \
-            fprintf(stderr, "[GOVERNANCE] Checkpoint failed: %s (error %d)\n", \
+            RIFT_LOG_ERROR("[GOVERNANCE] Checkpoint failed: %s (error %d)", \
                     checkpoint_name, _checkpoint_result); \
             return _checkpoint_result; \
         } \
+        if ((job_ctx)->yield_requested || rift_job_should_yield()) { \
+            RIFT_COOPERATIVE_YIELD(job_ctx); \
+        } \
     } while(0)
 
 /**
@@ -477,12 +421,17 @@ void rift_envelope_destroy(rift_token_access_envelope_t* envelope);
 
 /**
  * @brief Macro for cooperative yield with governance state preservation
+ *
+ * Inside a rift_scheduler job this switches to the next ready job in
+ * user space; elsewhere it falls back to sched_yield.
  */
 #define RIFT_COOPERATIVE_YIELD(job_ctx) \
     do { \
         clock_gettime(CLOCK_MONOTONIC, &(job_ctx)->last_yield_time); \
         (job_ctx)->yield_requested = false; \
-        pthread_yield(); \
+        (job_ctx)->job_state = JOB_STATE_DISPATCHED; \
+        rift_job_yield(); \
+        (job_ctx)->job_state = JOB_STATE_EXECUTING; \
     } while(0)
 
 #endif // TOKEN_ACCESS_ENVELOPE_H
@@ -511,133 +460,3 @@ void rift_envelope_destroy(rift_token_access_envelope_t* envelope);
  * ��� Makefile.master             # Master build coordination
  */
 
-// =============================================================================
-// COMMON DEFINITIONS - rift_common.h
-// =============================================================================
-
-#ifndef RIFT_COMMON_H
-#define RIFT_COMMON_H
-
-
-// Maximum hierarchy constraints per RIFT governance
-#define RIFT_MAX_CHILDREN_PER_PROCESS 32
-#define RIFT_MAX_HIERARCHY_DEPTH 8
-#define RIFT_MAX_THREAD_COUNT 256
-
-// Telemetry and tracking structures
-typedef struct {
-    pid_t process_id;               // System process ID
-    pthread_t thread_id;            // Thread ID (if applicable)
-    uint64_t rift_thread_id;        // Internal RIFT thread identifier
-    pid_t parent_process_id;        // Parent process PID
-    uint64_t parent_rift_id;        // Parent RIFT thread ID
-    struct timespec spawn_time;     // Thread/process creation timestamp
-    char spawn_location[128];       // Where in code this was spawned
-    uint32_t hierarchy_depth;       // Depth in parent-child tree
-    uint32_t child_count;           // Number of children spawned
-    bool is_daemon;                 // Daemon thread flag
-} rift_spawn_telemetry_t;
-
-// Governance policy structure (shared between modules)
-typedef enum {
-    CONCURRENCY_SIMULATED,          // Single-thread cooperative
-    CONCURRENCY_TRUE_THREAD,        // Multi-thread within process
-    CONCURRENCY_TRUE_PROCESS        // Multi-process hierarchy
-} rift_concurrency_mode_t;
-
-typedef enum {
-    DESTROY_CASCADE,                // Cascade destruction to children
-    DESTROY_KEEP_ALIVE,            // Allow children to survive
-    DESTROY_GRACEFUL,              // Graceful shutdown signal
-    DESTROY_IMMEDIATE              // Immediate termination
-} rift_destroy_policy_t;
-
-typedef struct {
-    uint64_t rift_id;              // Internal RIFT identifier
-    rift_concurrency_mode_t mode;  // Concurrency execution mode
-    rift_destroy_policy_t destroy_policy; // Child destruction policy
-    uint32_t max_children;         // Maximum children allowed
-    uint32_t max_execution_time_ms; // Execution time limit
-    bool trace_capped;             // Enable hierarchy depth limits
-    uint32_t max_hierarchy_depth;  // Maximum tree depth
-    bool daemon_mode;              // Daemon thread flag
-    bool keep_alive;               // Survival policy flag
-} rift_governance_policy_t;
-
-// Thread context structure (shared between modules)
-typedef struct {
-    rift_spawn_telemetry_t telemetry;     // Spawn tracking and telemetry
-    rift_governance_policy_t policy;      // Governance and policy constraints
-    struct timespec last_heartbeat;       // Last activity timestamp
-    uint32_t context_switches;            // Context switch counter
-    volatile bool should_terminate;       // Termination signal
-    void* module_specific_data;           // Module-specific context
-} rift_thread_context_t;
-
-// Memory token for resource governance
-typedef struct {
-    uint64_t token_id;             // Unique token identifier
-    uint64_t owner_rift_id;        // Owning RIFT thread ID
-    pid_t owner_process_id;        // Owning process ID
-    uint32_t access_mask;          // Permission bit mask (R/W/X)
-    char resource_name[64];        // Resource identifier
-    struct timespec acquisition_time; // When token was acquired
-    uint32_t validation_bits;      // Token state validation
-    bool is_transferable;          // Can be transferred between threads
-} rift_memory_token_t;
-
-#endif // RIFT_COMMON_H
-
-// =============================================================================
-// TELEMETRY IMPLEMENTATION - rift_telemetry.h
-// =============================================================================
-
-#ifndef RIFT_TELEMETRY_H
-#define RIFT_TELEMETRY_H
-
-/* RIFT_CLEANUP: Commented out missing header
- * #include "rift_common.h"
- */
-
-/**
- * @brief Initialize telemetry subsystem
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_init(void);
-
-/**
- * @brief Register new thread/process spawn with telemetry
- * @param context Thread context to register
- * @param spawn_location Source location where spawn occurred
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* spawn_location);
-
-/**
- * @brief Update heartbeat for thread/process
- * @param rift_id RIFT thread identifier
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_heartbeat(uint64_t rift_id);
-
-/**
- * @brief Get spawn telemetry for specific thread
- * @param rift_id RIFT thread identifier
- * @return Pointer to telemetry data, NULL if not found
- */
-rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id);
-
-/**
- * @brief Print comprehensive telemetry report
- */
-void rift_telemetry_print_report(void);
-
-/**
- * @brief Validate hierarchy constraints for new spawn
- * @param parent_rift_id Parent RIFT thread ID
- * @param proposed_policy Proposed governance policy
- * @return true if spawn allowed, false if violates constraints
- */
-bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy);
-
-#endif // RIFT_TELEMETRY_H
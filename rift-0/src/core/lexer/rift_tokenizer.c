@@ -9,6 +9,7 @@
 
 /* Project headers */
 #include "rift-0/core/lexer/tokenizer_types.h"
+#include "rift-0/core/rift_log.h"
 
 /*
  * =================================================================
@@ -103,6 +104,10 @@ char* strdup(const char* s);
 
 
 
+/* Compile-time stringification for constant tables */
+#define RIFT_STRINGIFY_IMPL(x) #x
+#define RIFT_STRINGIFY(x) RIFT_STRINGIFY_IMPL(x)
+
 /* Provide strdup if not available */
 #ifndef HAVE_STRDUP
 static char* rift_strdup(const char* s) {
@@ -117,12 +122,20 @@ static char* rift_strdup(const char* s) {
 
 
 /* =================================================================
- * THREAD POOL & MUTEX MANAGEMENT
+ * CONCURRENCY MODEL
  * =================================================================
+ *
+ * Every context owns its buffers, counters and context_mutex; there is
+ * no file-level mutable state. Independent contexts on different
+ * threads never contend. context_mutex is only taken when a single
+ * context is shared between threads (thread_safe_mode). The tables
+ * below (token names, version string) are const after load.
  */
 
-/* Thread pool for dual-mode processing */
-static pthread_mutex_t stage_mutex = PTHREAD_MUTEX_INITIALIZER;
+static const char rift_tokenizer_version_string[] =
+    "RIFT-0 Tokenizer v" RIFT_STRINGIFY(RIFT_TOKENIZER_VERSION_MAJOR)
+    "." RIFT_STRINGIFY(RIFT_TOKENIZER_VERSION_MINOR)
+    "." RIFT_STRINGIFY(RIFT_TOKENIZER_VERSION_PATCH) " (AEGIS)";
 
 /* =================================================================
  * AEGIS FRAMEWORK LIFECYCLE MANAGEMENT
@@ -145,6 +158,12 @@ rift_tokenizer_context_t* rift_tokenizer_init(rift_tokenizer_config_t *config) {
     ctx->dual_mode_enabled = true;
     ctx->aegis_compliant = true;
     
+    /* Per-context lock; only used when the context is shared */
+    if (pthread_mutex_init(&ctx->context_mutex, NULL) != 0) {
+        free(ctx);
+        return NULL;
+    }
+    
     /* Apply configuration settings if provided */
     if (config) {
         if (config->processing_flags & 0x01) {
@@ -152,10 +171,10 @@ rift_tokenizer_context_t* rift_tokenizer_init(rift_tokenizer_config_t *config) {
         }
         if (config->trust_tagging_enabled) {
             /* Enable trust tagging for bytecode stages */
-            printf("Trust tagging enabled for AEGIS compliance\n");
+            RIFT_LOG_DEBUG("Trust tagging enabled for AEGIS compliance");
         }
         if (config->preserve_matched_state) {
-            printf("State preservation enabled for DFA processing\n");
+            RIFT_LOG_DEBUG("State preservation enabled for DFA processing");
         }
     }
     
@@ -163,11 +182,11 @@ rift_tokenizer_context_t* rift_tokenizer_init(rift_tokenizer_config_t *config) {
     ctx->stage_data = NULL;
     ctx->next_stage_input = NULL;
     
-    printf("Initialized RIFT tokenization stage (rift-0)\n");
-    printf("  Version: 0x%08x\n", ctx->version);
-    printf("  Thread Count: %u\n", ctx->thread_count);
-    printf("  Dual Mode: %s\n", ctx->dual_mode_enabled ? "enabled" : "disabled");
-    printf("  AEGIS Compliant: %s\n", ctx->aegis_compliant ? "yes" : "no");
+    RIFT_LOG_INFO("Initialized RIFT tokenization stage (rift-0): version 0x%08x, "
+                  "threads %u, dual mode %s, AEGIS compliant %s",
+                  ctx->version, ctx->thread_count,
+                  ctx->dual_mode_enabled ? "enabled" : "disabled",
+                  ctx->aegis_compliant ? "yes" : "no");
     
     return ctx;
 }
@@ -193,14 +212,19 @@ rift_tokenizer_result_t rift_tokenizer_process(
         return RIFT_TOKENIZER_ERROR_INVALID_INPUT;
     }
     
-    pthread_mutex_lock(&stage_mutex);
+    bool shared = ctx->thread_safe_mode;
+    if (shared) {
+        pthread_mutex_lock(&ctx->context_mutex);
+    }
     
-    printf("Processing tokenization stage: %zu bytes input\n", input_size);
+    RIFT_LOG_DEBUG("Processing tokenization stage: %zu bytes input", input_size);
     
     /* Allocate output buffer with metadata space */
     *output = malloc(input_size + 1024);
     if (!*output) {
-        pthread_mutex_unlock(&stage_mutex);
+        if (shared) {
+            pthread_mutex_unlock(&ctx->context_mutex);
+        }
         return RIFT_TOKENIZER_ERROR_MEMORY;
     }
     
@@ -224,9 +248,11 @@ rift_tokenizer_result_t rift_tokenizer_process(
     
     *output_size += metadata_len;
     
-    printf("Tokenization processing complete: %zu bytes output\n", *output_size);
+    RIFT_LOG_DEBUG("Tokenization processing complete: %zu bytes output", *output_size);
     
-    pthread_mutex_unlock(&stage_mutex);
+    if (shared) {
+        pthread_mutex_unlock(&ctx->context_mutex);
+    }
     return RIFT_TOKENIZER_SUCCESS;
 }
 
@@ -240,27 +266,27 @@ rift_tokenizer_result_t rift_tokenizer_validate(rift_tokenizer_context_t *ctx) {
         return RIFT_TOKENIZER_ERROR_INVALID_INPUT;
     }
     
-    printf("Validating tokenization stage configuration...\n");
+    RIFT_LOG_DEBUG("Validating tokenization stage configuration");
     
     /* AEGIS methodology compliance validation */
     if (!ctx->aegis_compliant) {
-        printf("Warning: AEGIS compliance not enabled\n");
+        RIFT_LOG_WARN("AEGIS compliance not enabled");
         return RIFT_TOKENIZER_ERROR_VALIDATION;
     }
     
     /* Validate version compatibility */
     if (ctx->version != RIFT_TOKENIZER_VERSION) {
-        printf("Warning: Version mismatch detected\n");
+        RIFT_LOG_WARN("Version mismatch detected");
         return RIFT_TOKENIZER_ERROR_VALIDATION;
     }
     
     /* Validate thread configuration */
     if (ctx->thread_count == 0 || ctx->thread_count > 128) {
-        printf("Warning: Invalid thread count configuration\n");
+        RIFT_LOG_WARN("Invalid thread count configuration");
         return RIFT_TOKENIZER_ERROR_VALIDATION;
     }
     
-    printf("Tokenization validation passed - AEGIS compliant\n");
+    RIFT_LOG_DEBUG("Tokenization validation passed - AEGIS compliant");
     return RIFT_TOKENIZER_SUCCESS;
 }
 
@@ -271,7 +297,7 @@ rift_tokenizer_result_t rift_tokenizer_validate(rift_tokenizer_context_t *ctx) {
 void rift_tokenizer_cleanup(rift_tokenizer_context_t *ctx) {
     if (!ctx) return;
     
-    printf("Cleaning up tokenization stage (rift-0)\n");
+    RIFT_LOG_DEBUG("Cleaning up tokenization stage (rift-0)");
     
     /* Free stage-specific data */
     if (ctx->stage_data) {
@@ -289,6 +315,7 @@ void rift_tokenizer_cleanup(rift_tokenizer_context_t *ctx) {
     ctx->aegis_compliant = false;
     ctx->version = 0;
     
+    pthread_mutex_destroy(&ctx->context_mutex);
     free(ctx);
 }
 
@@ -306,7 +333,7 @@ void rift_tokenizer_cleanup(rift_tokenizer_context_t *ctx) {
 rift_tokenizer_result_t rift_tokenizer_set_pattern(rift_tokenizer_context_t *ctx, const char *pattern) {
     if (!ctx || !pattern) return RIFT_TOKENIZER_ERROR_INVALID_INPUT;
     
-    printf("Setting tokenization pattern: %s\n", pattern);
+    RIFT_LOG_DEBUG("Setting tokenization pattern: %s", pattern);
     
     /* Pattern validation and compilation would go here */
     /* For now, we'll just store the pattern reference */
@@ -323,7 +350,7 @@ rift_tokenizer_result_t rift_tokenizer_set_pattern(rift_tokenizer_context_t *ctx
 rift_tokenizer_result_t rift_tokenizer_tokenize_input(rift_tokenizer_context_t *ctx, const char *input) {
     if (!ctx || !input) return RIFT_TOKENIZER_ERROR_INVALID_INPUT;
     
-    printf("Tokenizing input: %.50s...\n", input);
+    RIFT_LOG_DEBUG("Tokenizing input: %.50s...", input);
     
     /* Actual tokenization logic would be implemented here */
     /* This would include DFA processing, pattern matching, etc. */
@@ -360,7 +387,12 @@ TokenizerContext* rift_tokenizer_create(size_t initial_capacity) {
     ctx->has_error = false;
     ctx->thread_safe_mode = false;
     
-    printf("Created enhanced tokenizer context with capacity: %zu\n", ctx->token_capacity);
+    if (pthread_mutex_init(&ctx->context_mutex, NULL) != 0) {
+        free(ctx->token_buffer);
+        free(ctx);
+        return NULL;
+    }
+    
     return ctx;
 }
 
@@ -389,6 +421,7 @@ void rift_tokenizer_destroy(TokenizerContext* ctx) {
         rift_dfa_destroy_states(ctx->dfa_root);
     }
     
+    pthread_mutex_destroy(&ctx->context_mutex);
     free(ctx);
 }
 
@@ -421,7 +454,7 @@ bool rift_tokenizer_reset(TokenizerContext* ctx) {
  * @return String representation of token type
  */
 const char* rift_token_type_name(TokenType type) {
-    static const char* token_names[] = {
+    static const char* const token_names[] = {
         "UNKNOWN", "IDENTIFIER", "KEYWORD", "LITERAL_NUMBER",
         "LITERAL_STRING", "OPERATOR", "PUNCTUATION", "WHITESPACE",
         "COMMENT", "EOF", "ERROR", "REGEX_START", "REGEX_END",
@@ -440,13 +473,7 @@ const char* rift_token_type_name(TokenType type) {
  * @return Version string
  */
 const char* rift_tokenizer_version(void) {
-    static char version_str[64];
-    snprintf(version_str, sizeof(version_str), 
-             "RIFT-0 Tokenizer v%d.%d.%d (AEGIS)",
-             RIFT_TOKENIZER_VERSION_MAJOR,
-             RIFT_TOKENIZER_VERSION_MINOR,
-             RIFT_TOKENIZER_VERSION_PATCH);
-    return version_str;
+    return rift_tokenizer_version_string;
 }
 
 /**
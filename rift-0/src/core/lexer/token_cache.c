@@ -0,0 +1,419 @@
+/*
+ * =================================================================
+ * token_cache.c - RIFT-0 Content-Addressed Tokenization Cache
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ *
+ * Entry layout: RiftTokenCacheHeader followed by token_count raw
+ * TokenTriplet records. Entries are only ever created by rename(2),
+ * so readers never observe a partially written file.
+ * =================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/* Project headers */
+#include "rift-0/core/lexer/token_cache.h"
+#include "rift-0/core/rift_hash.h"
+
+#define TOKEN_CACHE_MAGIC "RTC0"
+#define TOKEN_CACHE_TOKENIZER_VERSION \
+    ((uint32_t)((RIFT_TOKENIZER_VERSION_MAJOR << 16) | \
+                (RIFT_TOKENIZER_VERSION_MINOR << 8) | \
+                 RIFT_TOKENIZER_VERSION_PATCH))
+
+/* On-disk entry header */
+typedef struct {
+    char magic[4];
+    uint32_t format;
+    uint32_t tokenizer_version;
+    uint32_t triplet_size;
+    uint64_t input_hash;        /* Key hash; also names the file */
+    uint64_t input_check;       /* Independent hash guarding collisions */
+    uint64_t input_length;
+    uint64_t ruleset_hash;
+    uint64_t token_count;
+} RiftTokenCacheHeader;
+
+struct RiftTokenCache {
+    char* directory;
+    size_t max_bytes;
+
+    atomic_size_t bytes_on_disk;
+    atomic_size_t hits;
+    atomic_size_t misses;
+    atomic_size_t stores;
+    atomic_size_t evictions;
+    atomic_uint tmp_sequence;
+
+    pthread_mutex_t evict_lock;
+};
+
+/* Eviction trims to 90% of the budget so stores don't evict every time */
+#define TOKEN_CACHE_LOW_WATERMARK(max) ((max) - (max) / 10)
+
+/* =================================================================
+ * KEYING
+ * =================================================================
+ */
+
+static uint64_t cache_seed(uint64_t ruleset_hash) {
+    return rift_hash64_combine(ruleset_hash, TOKEN_CACHE_TOKENIZER_VERSION);
+}
+
+static void cache_entry_path(const RiftTokenCache* cache, uint64_t key,
+                             char* buffer, size_t size) {
+    snprintf(buffer, size, "%s/%016" PRIx64 RIFT_TOKEN_CACHE_SUFFIX,
+             cache->directory, key);
+}
+
+uint64_t rift_token_cache_ruleset_hash(const TokenizerContext* tokenizer) {
+    uint64_t h = rift_hash64(NULL, 0, TOKEN_CACHE_TOKENIZER_VERSION);
+    if (!tokenizer) return h;
+
+    h = rift_hash64_combine(h, (uint64_t)tokenizer->global_flags);
+    h = rift_hash64_combine(h, (uint64_t)tokenizer->pattern_count);
+
+    for (size_t i = 0; i < tokenizer->pattern_count; i++) {
+        const RegexComposition* rule = tokenizer->regex_patterns
+                                     ? tokenizer->regex_patterns[i] : NULL;
+        if (!rule || !rule->pattern) continue;
+        h = rift_hash64_combine(h, rift_hash64(rule->pattern,
+                                               strlen(rule->pattern), 0));
+        h = rift_hash64_combine(h, (uint64_t)rule->flags);
+    }
+
+    return h;
+}
+
+/* =================================================================
+ * LIFECYCLE
+ * =================================================================
+ */
+
+static int make_directories(const char* path) {
+    char buffer[4096];
+    size_t len = strlen(path);
+    if (len == 0 || len >= sizeof(buffer)) return -1;
+
+    memcpy(buffer, path, len + 1);
+    for (char* p = buffer + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        if (mkdir(buffer, 0755) != 0 && errno != EEXIST) return -1;
+        *p = '/';
+    }
+    if (mkdir(buffer, 0755) != 0 && errno != EEXIST) return -1;
+    return 0;
+}
+
+RiftTokenCache* rift_token_cache_open(const RiftTokenCacheConfig* config) {
+    if (!config || !config->directory) return NULL;
+
+    if (make_directories(config->directory) != 0) return NULL;
+
+    RiftTokenCache* cache = calloc(1, sizeof(RiftTokenCache));
+    if (!cache) return NULL;
+
+    cache->directory = strdup(config->directory);
+    if (!cache->directory) {
+        free(cache);
+        return NULL;
+    }
+
+    cache->max_bytes = config->max_bytes ? config->max_bytes
+                                         : RIFT_TOKEN_CACHE_DEFAULT_BYTES;
+    pthread_mutex_init(&cache->evict_lock, NULL);
+
+    /* Initial scan establishes bytes_on_disk and enforces the budget */
+    rift_token_cache_evict(cache);
+
+    return cache;
+}
+
+void rift_token_cache_close(RiftTokenCache* cache) {
+    if (!cache) return;
+
+    pthread_mutex_destroy(&cache->evict_lock);
+    free(cache->directory);
+    free(cache);
+}
+
+/* =================================================================
+ * LOOKUP
+ * =================================================================
+ */
+
+bool rift_token_cache_lookup(RiftTokenCache* cache,
+                             const char* input,
+                             size_t length,
+                             uint64_t ruleset_hash,
+                             RiftTokenCacheHit* hit) {
+    if (!cache || !input || !hit) return false;
+
+    memset(hit, 0, sizeof(*hit));
+
+    uint64_t seed = cache_seed(ruleset_hash);
+    uint64_t key = rift_hash64(input, length, seed);
+
+    char path[4096];
+    cache_entry_path(cache, key, path, sizeof(path));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        atomic_fetch_add(&cache->misses, 1);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(RiftTokenCacheHeader)) {
+        close(fd);
+        atomic_fetch_add(&cache->misses, 1);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        atomic_fetch_add(&cache->misses, 1);
+        return false;
+    }
+
+    const RiftTokenCacheHeader* header = (const RiftTokenCacheHeader*)map;
+    bool valid = memcmp(header->magic, TOKEN_CACHE_MAGIC, 4) == 0 &&
+                 header->format == RIFT_TOKEN_CACHE_FORMAT &&
+                 header->tokenizer_version == TOKEN_CACHE_TOKENIZER_VERSION &&
+                 header->triplet_size == sizeof(TokenTriplet) &&
+                 header->input_hash == key &&
+                 header->input_length == (uint64_t)length &&
+                 header->ruleset_hash == ruleset_hash &&
+                 header->token_count <= (size - sizeof(*header)) / sizeof(TokenTriplet) &&
+                 size == sizeof(*header) + header->token_count * sizeof(TokenTriplet);
+
+    /* The second hash is only computed once everything cheap agrees */
+    if (valid) {
+        valid = header->input_check == rift_hash64(input, length, ~seed);
+    }
+
+    if (!valid) {
+        munmap(map, size);
+        close(fd);
+        atomic_fetch_add(&cache->misses, 1);
+        return false;
+    }
+
+    /* Touch for LRU ordering; mtime is reliable where atime is not */
+    futimens(fd, NULL);
+    close(fd);
+
+    hit->tokens = (const TokenTriplet*)((const char*)map + sizeof(*header));
+    hit->count = (size_t)header->token_count;
+    hit->mapping = map;
+    hit->mapping_size = size;
+
+    atomic_fetch_add(&cache->hits, 1);
+    return true;
+}
+
+void rift_token_cache_release(RiftTokenCacheHit* hit) {
+    if (!hit || !hit->mapping) return;
+
+    munmap(hit->mapping, hit->mapping_size);
+    memset(hit, 0, sizeof(*hit));
+}
+
+/* =================================================================
+ * STORE
+ * =================================================================
+ */
+
+static int write_all(int fd, const void* data, size_t size) {
+    const char* p = (const char*)data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += written;
+        size -= (size_t)written;
+    }
+    return 0;
+}
+
+int rift_token_cache_store(RiftTokenCache* cache,
+                           const char* input,
+                           size_t length,
+                           uint64_t ruleset_hash,
+                           const TokenTriplet* tokens,
+                           size_t count) {
+    if (!cache || !input || (!tokens && count > 0)) return -1;
+
+    uint64_t seed = cache_seed(ruleset_hash);
+
+    RiftTokenCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TOKEN_CACHE_MAGIC, 4);
+    header.format = RIFT_TOKEN_CACHE_FORMAT;
+    header.tokenizer_version = TOKEN_CACHE_TOKENIZER_VERSION;
+    header.triplet_size = sizeof(TokenTriplet);
+    header.input_hash = rift_hash64(input, length, seed);
+    header.input_check = rift_hash64(input, length, ~seed);
+    header.input_length = length;
+    header.ruleset_hash = ruleset_hash;
+    header.token_count = count;
+
+    char path[4096];
+    char tmp_path[4096];
+    cache_entry_path(cache, header.input_hash, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s/.tmp-%ld-%u",
+             cache->directory, (long)getpid(),
+             atomic_fetch_add(&cache->tmp_sequence, 1));
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) return -1;
+
+    size_t payload = count * sizeof(TokenTriplet);
+    if (write_all(fd, &header, sizeof(header)) != 0 ||
+        (payload > 0 && write_all(fd, tokens, payload) != 0)) {
+        close(fd);
+        unlink(tmp_path);
+        return -1;
+    }
+
+    if (close(fd) != 0 || rename(tmp_path, path) != 0) {
+        unlink(tmp_path);
+        return -1;
+    }
+
+    atomic_fetch_add(&cache->stores, 1);
+    size_t on_disk = atomic_fetch_add(&cache->bytes_on_disk,
+                                      sizeof(header) + payload)
+                   + sizeof(header) + payload;
+
+    if (on_disk > cache->max_bytes) {
+        rift_token_cache_evict(cache);
+    }
+
+    return 0;
+}
+
+/* =================================================================
+ * LRU EVICTION
+ * =================================================================
+ */
+
+typedef struct {
+    char name[64];
+    struct timespec mtime;
+    size_t size;
+} CacheEntryInfo;
+
+static int compare_entry_age(const void* a, const void* b) {
+    const CacheEntryInfo* ea = (const CacheEntryInfo*)a;
+    const CacheEntryInfo* eb = (const CacheEntryInfo*)b;
+    if (ea->mtime.tv_sec != eb->mtime.tv_sec) {
+        return ea->mtime.tv_sec < eb->mtime.tv_sec ? -1 : 1;
+    }
+    if (ea->mtime.tv_nsec != eb->mtime.tv_nsec) {
+        return ea->mtime.tv_nsec < eb->mtime.tv_nsec ? -1 : 1;
+    }
+    return 0;
+}
+
+static bool is_cache_entry(const char* name) {
+    size_t len = strlen(name);
+    size_t suffix = strlen(RIFT_TOKEN_CACHE_SUFFIX);
+    return len > suffix && len < sizeof(((CacheEntryInfo*)0)->name) &&
+           strcmp(name + len - suffix, RIFT_TOKEN_CACHE_SUFFIX) == 0;
+}
+
+size_t rift_token_cache_evict(RiftTokenCache* cache) {
+    if (!cache) return 0;
+
+    pthread_mutex_lock(&cache->evict_lock);
+
+    DIR* dir = opendir(cache->directory);
+    if (!dir) {
+        pthread_mutex_unlock(&cache->evict_lock);
+        return 0;
+    }
+
+    CacheEntryInfo* entries = NULL;
+    size_t entry_count = 0;
+    size_t entry_capacity = 0;
+    size_t total = 0;
+
+    struct dirent* de;
+    while ((de = readdir(dir)) != NULL) {
+        if (!is_cache_entry(de->d_name)) continue;
+
+        struct stat st;
+        if (fstatat(dirfd(dir), de->d_name, &st, 0) != 0) continue;
+
+        if (entry_count == entry_capacity) {
+            size_t new_capacity = entry_capacity ? entry_capacity * 2 : 256;
+            CacheEntryInfo* grown = realloc(entries, new_capacity * sizeof(*entries));
+            if (!grown) break;
+            entries = grown;
+            entry_capacity = new_capacity;
+        }
+
+        CacheEntryInfo* info = &entries[entry_count++];
+        memcpy(info->name, de->d_name, strlen(de->d_name) + 1);
+        info->mtime = st.st_mtim;
+        info->size = (size_t)st.st_size;
+        total += info->size;
+    }
+
+    size_t evicted = 0;
+    if (total > cache->max_bytes && entry_count > 0) {
+        size_t target = TOKEN_CACHE_LOW_WATERMARK(cache->max_bytes);
+        qsort(entries, entry_count, sizeof(*entries), compare_entry_age);
+
+        for (size_t i = 0; i < entry_count && total > target; i++) {
+            if (unlinkat(dirfd(dir), entries[i].name, 0) == 0) {
+                total -= entries[i].size;
+                evicted++;
+            }
+        }
+    }
+
+    closedir(dir);
+    free(entries);
+
+    atomic_store(&cache->bytes_on_disk, total);
+    atomic_fetch_add(&cache->evictions, evicted);
+
+    pthread_mutex_unlock(&cache->evict_lock);
+    return evicted;
+}
+
+void rift_token_cache_get_stats(const RiftTokenCache* cache,
+                                RiftTokenCacheStats* stats) {
+    if (!cache || !stats) return;
+
+    RiftTokenCache* c = (RiftTokenCache*)cache;
+    stats->hits = atomic_load(&c->hits);
+    stats->misses = atomic_load(&c->misses);
+    stats->stores = atomic_load(&c->stores);
+    stats->evictions = atomic_load(&c->evictions);
+    stats->bytes_on_disk = atomic_load(&c->bytes_on_disk);
+}
@@ -0,0 +1,187 @@
+/*
+ * =================================================================
+ * block_prescan.c - RIFT-0 Top-Level Block Prescan
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "rift-0/core/parser/block_prescan.h"
+
+typedef enum {
+    SCAN_CODE,
+    SCAN_STRING,
+    SCAN_LINE_COMMENT,
+    SCAN_BLOCK_COMMENT
+} ScanState;
+
+typedef struct {
+    const char* input;
+    size_t length;
+    RiftBlockList* list;
+    ScanState state;
+    size_t depth;
+    size_t skip_until;          /* Bytes consumed by a two-byte token */
+    size_t block_start;
+    bool closed;                /* A top-level block closed on this line */
+    bool failed;
+} Scanner;
+
+static bool is_structural(unsigned char c) {
+    return c == '{' || c == '}' || c == '"' || c == '/' ||
+           c == '*' || c == '\\' || c == '\n';
+}
+
+static void push_span(Scanner* scan, size_t start, size_t end) {
+    RiftBlockList* list = scan->list;
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 64;
+        RiftBlockSpan* spans = realloc(list->spans, capacity * sizeof(RiftBlockSpan));
+        if (!spans) {
+            scan->failed = true;
+            return;
+        }
+        list->spans = spans;
+        list->capacity = capacity;
+    }
+    list->spans[list->count++] = (RiftBlockSpan){ start, end };
+}
+
+/* End the current block at a line start; never at the input's end */
+static void cut(Scanner* scan, size_t at) {
+    if (at <= scan->block_start || at >= scan->length) return;
+    push_span(scan, scan->block_start, at);
+    scan->block_start = at;
+}
+
+/* Newline at top level: end the block if one closed on this line, or
+ * if the next line is a '!' directive */
+static void line_end(Scanner* scan, size_t at) {
+    if (scan->depth != 0) return;
+
+    bool directive = false;
+    if (!scan->closed) {
+        size_t next = at + 1;
+        while (next < scan->length && (scan->input[next] == ' ' || scan->input[next] == '\t')) {
+            next++;
+        }
+        directive = next < scan->length && scan->input[next] == '!';
+    }
+    if (scan->closed || directive) {
+        cut(scan, at + 1);
+        scan->closed = false;
+    }
+}
+
+static void step(Scanner* scan, size_t at) {
+    if (at < scan->skip_until) return;
+
+    char c = scan->input[at];
+    char next = at + 1 < scan->length ? scan->input[at + 1] : '\0';
+
+    switch (scan->state) {
+    case SCAN_CODE:
+        if (c == '{') {
+            scan->depth++;
+        } else if (c == '}') {
+            if (scan->depth > 0 && --scan->depth == 0) scan->closed = true;
+        } else if (c == '"') {
+            scan->state = SCAN_STRING;
+        } else if (c == '/' && next == '/') {
+            scan->state = SCAN_LINE_COMMENT;
+            scan->skip_until = at + 2;
+        } else if (c == '/' && next == '*') {
+            scan->state = SCAN_BLOCK_COMMENT;
+            scan->skip_until = at + 2;
+        } else if (c == '\n') {
+            line_end(scan, at);
+        }
+        break;
+
+    case SCAN_STRING:
+        if (c == '\\') {
+            scan->skip_until = at + 2;
+        } else if (c == '"') {
+            scan->state = SCAN_CODE;
+        } else if (c == '\n') {
+            /* Strings do not span lines; recover from a stray quote */
+            scan->state = SCAN_CODE;
+            line_end(scan, at);
+        }
+        break;
+
+    case SCAN_LINE_COMMENT:
+        if (c == '\n') {
+            scan->state = SCAN_CODE;
+            line_end(scan, at);
+        }
+        break;
+
+    case SCAN_BLOCK_COMMENT:
+        if (c == '*' && next == '/') {
+            scan->state = SCAN_CODE;
+            scan->skip_until = at + 2;
+        }
+        break;
+    }
+}
+
+int rift_block_prescan(const char* input, size_t length, RiftBlockList* list) {
+    if (!list || (!input && length > 0)) return -1;
+    list->count = 0;
+
+    Scanner scan = { .input = input, .length = length, .list = list };
+    size_t at = 0;
+
+#if defined(__SSE2__)
+    const __m128i open = _mm_set1_epi8('{');
+    const __m128i close = _mm_set1_epi8('}');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i star = _mm_set1_epi8('*');
+    const __m128i escape = _mm_set1_epi8('\\');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    for (; at + 16 <= length && !scan.failed; at += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(input + at));
+        __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, open), _mm_cmpeq_epi8(bytes, close)),
+                         _mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, slash))),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, star), _mm_cmpeq_epi8(bytes, escape)),
+                         _mm_cmpeq_epi8(bytes, newline)));
+
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hits);
+        while (mask) {
+            step(&scan, at + (size_t)__builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; at < length && !scan.failed; at++) {
+        if (is_structural((unsigned char)input[at])) step(&scan, at);
+    }
+
+    /* The last block runs to the end of the input */
+    if (!scan.failed && length > scan.block_start) {
+        push_span(&scan, scan.block_start, length);
+    }
+    return scan.failed ? -1 : 0;
+}
+
+void rift_block_list_free(RiftBlockList* list) {
+    if (!list) return;
+    free(list->spans);
+    list->spans = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
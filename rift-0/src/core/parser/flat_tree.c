@@ -0,0 +1,191 @@
+/*
+ * =================================================================
+ * flat_tree.c - RIFT-0 Flat Parse Tree
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rift-0/core/parser/flat_tree.h"
+
+#define FLAT_TREE_DEFAULT_CAPACITY 256
+
+FlatTree* flat_tree_create(uint32_t initial_capacity) {
+    FlatTree* tree = calloc(1, sizeof(FlatTree));
+    if (!tree) return NULL;
+
+    tree->capacity = initial_capacity ? initial_capacity : FLAT_TREE_DEFAULT_CAPACITY;
+    tree->nodes = malloc(tree->capacity * sizeof(FlatTreeNode));
+    tree->kinds = malloc(tree->capacity * sizeof(uint32_t));
+    if (!tree->nodes || !tree->kinds) {
+        flat_tree_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+void flat_tree_destroy(FlatTree* tree) {
+    if (!tree) return;
+    free(tree->nodes);
+    free(tree->kinds);
+    free(tree);
+}
+
+void flat_tree_clear(FlatTree* tree) {
+    if (!tree) return;
+    tree->count = 0;
+    tree->finished = false;
+}
+
+static bool flat_tree_grow(FlatTree* tree) {
+    if (tree->capacity > (FLAT_TREE_NONE - 1) / 2) return false;
+
+    uint32_t capacity = tree->capacity * 2;
+    FlatTreeNode* nodes = realloc(tree->nodes, capacity * sizeof(FlatTreeNode));
+    if (!nodes) return false;
+    tree->nodes = nodes;
+
+    uint32_t* kinds = realloc(tree->kinds, capacity * sizeof(uint32_t));
+    if (!kinds) return false;
+    tree->kinds = kinds;
+
+    tree->capacity = capacity;
+    return true;
+}
+
+uint32_t flat_tree_append(FlatTree* tree,
+                          uint32_t kind,
+                          uint32_t subtree_size,
+                          uint32_t first_token,
+                          uint32_t end_token) {
+    if (!tree || tree->finished || subtree_size == 0) return FLAT_TREE_NONE;
+    if (subtree_size - 1 > tree->count) return FLAT_TREE_NONE;
+
+    /* The children must be whole subtrees ending at the current top */
+    uint32_t start = tree->count - (subtree_size - 1);
+    uint32_t cursor = tree->count;
+    while (cursor > start) {
+        cursor -= tree->nodes[cursor - 1].subtree_size;
+    }
+    if (cursor != start) return FLAT_TREE_NONE;
+
+    if (tree->count == tree->capacity && !flat_tree_grow(tree)) return FLAT_TREE_NONE;
+
+    uint32_t index = tree->count++;
+    tree->nodes[index] = (FlatTreeNode){ subtree_size, FLAT_TREE_NONE, first_token, end_token };
+    tree->kinds[index] = kind;
+    return index;
+}
+
+bool flat_tree_finish(FlatTree* tree) {
+    if (!tree) return false;
+    if (tree->finished || tree->count == 0) {
+        tree->finished = true;
+        return true;
+    }
+
+    uint32_t n = tree->count;
+    uint32_t* pre = malloc(n * sizeof(uint32_t));
+    FlatTreeNode* nodes = malloc(tree->capacity * sizeof(FlatTreeNode));
+    uint32_t* kinds = malloc(tree->capacity * sizeof(uint32_t));
+    if (!pre || !nodes || !kinds) {
+        free(pre);
+        free(nodes);
+        free(kinds);
+        return false;
+    }
+
+    /* A node's children are the whole subtrees just before it, last
+     * child first. Everything between the start of a node's subtree and
+     * the start of a child's subtree precedes that child in pre-order,
+     * so one pass from the end places every node after its parent. */
+    for (uint32_t root = n; root > 0; root -= tree->nodes[root - 1].subtree_size) {
+        pre[root - 1] = root - tree->nodes[root - 1].subtree_size;
+        nodes[pre[root - 1]].parent = FLAT_TREE_NONE;
+    }
+    for (uint32_t p = n; p-- > 0;) {
+        uint32_t p_start = p + 1 - tree->nodes[p].subtree_size;
+        for (uint32_t c = p; c > p_start; c -= tree->nodes[c - 1].subtree_size) {
+            uint32_t child = c - 1;
+            uint32_t c_start = c - tree->nodes[child].subtree_size;
+            pre[child] = pre[p] + 1 + (c_start - p_start);
+            nodes[pre[child]].parent = pre[p];
+        }
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        FlatTreeNode* node = &nodes[pre[i]];
+        node->subtree_size = tree->nodes[i].subtree_size;
+        node->first_token = tree->nodes[i].first_token;
+        node->end_token = tree->nodes[i].end_token;
+        kinds[pre[i]] = tree->kinds[i];
+    }
+
+    free(pre);
+    free(tree->nodes);
+    free(tree->kinds);
+    tree->nodes = nodes;
+    tree->kinds = kinds;
+    tree->finished = true;
+    return true;
+}
+
+bool flat_tree_splice(FlatTree* tree, const FlatTree* forest, uint32_t token_offset) {
+    if (!tree || !forest || !forest->finished) return false;
+    if (!tree->finished && tree->count > 0) return false;
+    if (forest->count > FLAT_TREE_NONE - 1 - tree->count) return false;
+
+    uint32_t base = tree->count;
+    while (tree->capacity - tree->count < forest->count) {
+        if (!flat_tree_grow(tree)) return false;
+    }
+
+    /* Pre-order forests concatenate; only indices move */
+    for (uint32_t i = 0; i < forest->count; i++) {
+        FlatTreeNode node = forest->nodes[i];
+        if (node.parent != FLAT_TREE_NONE) node.parent += base;
+        node.first_token += token_offset;
+        node.end_token += token_offset;
+        tree->nodes[base + i] = node;
+    }
+    memcpy(tree->kinds + base, forest->kinds, forest->count * sizeof(uint32_t));
+    tree->count += forest->count;
+    tree->finished = true;
+    return true;
+}
+
+void flat_tree_visit(const FlatTree* tree,
+                     uint32_t root,
+                     FlatTreeEnterFn enter,
+                     FlatTreeLeaveFn leave,
+                     void* user_data) {
+    if (!tree || !tree->finished || root >= tree->count) return;
+
+    uint32_t end = root + tree->nodes[root].subtree_size;
+    uint32_t node = root;
+    while (node < end) {
+        FlatTreeVisit visit = enter ? enter(tree, node, user_data) : FLAT_TREE_CONTINUE;
+        if (visit == FLAT_TREE_STOP) return;
+
+        uint32_t subtree_end = node + tree->nodes[node].subtree_size;
+        uint32_t next = visit == FLAT_TREE_SKIP ? subtree_end : node + 1;
+
+        /* Leave this node once its subtree is behind us, then every
+         * ancestor whose subtree ends at the same place */
+        if (leave && next == subtree_end) {
+            uint32_t closing = node;
+            leave(tree, closing, user_data);
+            while (closing != root) {
+                uint32_t parent = tree->nodes[closing].parent;
+                if (parent + tree->nodes[parent].subtree_size != next) break;
+                closing = parent;
+                leave(tree, closing, user_data);
+            }
+        }
+        node = next;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * =================================================================
+ * packrat_memo.c - RIFT-0 Packrat Memo Table
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rift-0/core/parser/packrat_memo.h"
+
+/* Cell layout: key + 1 in the high 40 bits (0 marks an empty cell),
+ * then 0 for a failed match or length + 1 in the low 24 bits */
+#define CELL_RESULT_BITS    24
+#define CELL_RESULT_MASK    ((UINT64_C(1) << CELL_RESULT_BITS) - 1)
+#define CELL_KEY_LIMIT      ((UINT64_C(1) << (64 - CELL_RESULT_BITS)) - 1)
+
+PackratMemo* packrat_memo_create(size_t rule_count, size_t window) {
+    if (rule_count == 0) return NULL;
+
+    PackratMemo* memo = calloc(1, sizeof(PackratMemo));
+    if (!memo) return NULL;
+
+    size_t size = 1;
+    while (size < (window ? window : PACKRAT_DEFAULT_WINDOW)) size <<= 1;
+
+    memo->rule_count = rule_count;
+    memo->window = size;
+    memo->cells = calloc(rule_count * size, sizeof(*memo->cells));
+    if (!memo->cells) {
+        free(memo);
+        return NULL;
+    }
+    return memo;
+}
+
+void packrat_memo_destroy(PackratMemo* memo) {
+    if (!memo) return;
+    free(memo->cells);
+    free(memo);
+}
+
+void packrat_memo_begin(PackratMemo* memo, size_t length) {
+    if (!memo) return;
+
+    /* Each input gets fresh keys, so nothing is cleared between inputs
+     * until the key space runs out */
+    memo->base += memo->span;
+    memo->span = (uint64_t)length + 1;
+    if (memo->span >= CELL_KEY_LIMIT - memo->base) {
+        memset(memo->cells, 0, memo->rule_count * memo->window * sizeof(*memo->cells));
+        memo->base = 0;
+        if (memo->span >= CELL_KEY_LIMIT) memo->span = 0;
+    }
+}
+
+static _Atomic(uint64_t)* memo_cell(const PackratMemo* memo, size_t rule, uint64_t key) {
+    return &memo->cells[rule * memo->window + (key & (memo->window - 1))];
+}
+
+PackratResult packrat_memo_lookup(const PackratMemo* memo,
+                                  size_t rule,
+                                  size_t offset,
+                                  size_t* length) {
+    if (!memo || rule >= memo->rule_count || offset >= memo->span) return PACKRAT_UNKNOWN;
+
+    uint64_t key = memo->base + offset;
+    uint64_t cell = atomic_load_explicit(memo_cell(memo, rule, key), memory_order_relaxed);
+    if ((cell >> CELL_RESULT_BITS) != key + 1) return PACKRAT_UNKNOWN;
+
+    uint64_t result = cell & CELL_RESULT_MASK;
+    if (result == 0) return PACKRAT_FAIL;
+    if (length) *length = (size_t)(result - 1);
+    return PACKRAT_MATCH;
+}
+
+void packrat_memo_store(PackratMemo* memo,
+                        size_t rule,
+                        size_t offset,
+                        bool matched,
+                        size_t length) {
+    if (!memo || rule >= memo->rule_count || offset >= memo->span) return;
+    if (matched && length > PACKRAT_MAX_LENGTH) return;
+
+    uint64_t key = memo->base + offset;
+    uint64_t result = matched ? (uint64_t)length + 1 : 0;
+    atomic_store_explicit(memo_cell(memo, rule, key),
+                          ((key + 1) << CELL_RESULT_BITS) | result,
+                          memory_order_relaxed);
+}
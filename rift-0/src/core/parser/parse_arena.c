@@ -0,0 +1,99 @@
+/*
+ * =================================================================
+ * parse_arena.c - RIFT-0 Parse Arena
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdalign.h>
+
+#include "rift-0/core/parser/parse_arena.h"
+
+#define ARENA_ALIGN alignof(max_align_t)
+
+struct ParseArenaChunk {
+    ParseArenaChunk* next;
+    size_t size;
+    alignas(max_align_t) unsigned char data[];
+};
+
+static ParseArenaChunk* chunk_create(size_t size) {
+    ParseArenaChunk* chunk = malloc(sizeof(ParseArenaChunk) + size);
+    if (!chunk) return NULL;
+    chunk->next = NULL;
+    chunk->size = size;
+    return chunk;
+}
+
+ParseArena* parse_arena_create(size_t chunk_size) {
+    ParseArena* arena = calloc(1, sizeof(ParseArena));
+    if (!arena) return NULL;
+
+    arena->chunk_size = chunk_size ? chunk_size : PARSE_ARENA_DEFAULT_CHUNK;
+    arena->head = chunk_create(arena->chunk_size);
+    if (!arena->head) {
+        free(arena);
+        return NULL;
+    }
+    arena->current = arena->head;
+    return arena;
+}
+
+void parse_arena_destroy(ParseArena* arena) {
+    if (!arena) return;
+
+    ParseArenaChunk* chunk = arena->head;
+    while (chunk) {
+        ParseArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+void* parse_arena_alloc(ParseArena* arena, size_t size) {
+    if (!arena || size > SIZE_MAX - ARENA_ALIGN) return NULL;
+
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if (size > arena->current->size - arena->used) {
+        /* Reuse the chunks a previous parse grew, skipping any too small */
+        ParseArenaChunk* chunk = arena->current;
+        while (chunk->next && chunk->next->size < size) {
+            chunk = chunk->next;
+        }
+        if (chunk->next) {
+            arena->current = chunk->next;
+        } else {
+            ParseArenaChunk* fresh = chunk_create(size > arena->chunk_size ? size : arena->chunk_size);
+            if (!fresh) return NULL;
+            chunk->next = fresh;
+            arena->current = fresh;
+        }
+        arena->used = 0;
+    }
+
+    void* block = arena->current->data + arena->used;
+    arena->used += size;
+    return block;
+}
+
+char* parse_arena_strndup(ParseArena* arena, const char* text, size_t length) {
+    if (!text || length == SIZE_MAX) return NULL;
+
+    char* copy = parse_arena_alloc(arena, length + 1);
+    if (!copy) return NULL;
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+void parse_arena_reset(ParseArena* arena) {
+    if (!arena) return;
+    arena->current = arena->head;
+    arena->used = 0;
+}
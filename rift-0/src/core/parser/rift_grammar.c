@@ -0,0 +1,1290 @@
+/*
+ * =================================================================
+ * rift_grammar.c - RIFT-0 LALR(1) Grammar Engine
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "rift-0/core/parser/rift_grammar.h"
+#include "rift-0/core/rift_hash.h"
+
+/* =================================================================
+ * GRAMMAR DEFINITION
+ * =================================================================
+ */
+
+typedef struct {
+    char* name;
+    bool bound;                 /* Terminal bound to a token type */
+    uint32_t token_type;
+    bool defined;               /* Appears left of ':' */
+    uint32_t id;                /* Internal symbol id, valid once built */
+} GrammarSymbol;
+
+typedef struct {
+    uint32_t lhs;               /* Index into symbols */
+    uint32_t* rhs;
+    uint32_t length;
+} GrammarRule;
+
+struct RiftGrammar {
+    GrammarSymbol* symbols;
+    size_t symbol_count;
+    size_t symbol_capacity;
+
+    GrammarRule* rules;
+    size_t rule_count;
+    size_t rule_capacity;
+
+    char error[256];
+
+    /* Built tables; internal symbols are terminals [0, T) with 0 the
+     * end marker, then nonterminals [T, T + N) with T the augmented
+     * start. Internal production 0 is $accept -> start. */
+    bool built;
+    size_t terminal_count;
+    size_t nonterminal_count;
+    size_t production_count;
+    size_t state_count;
+    uint32_t* prod_lhs;
+    uint32_t* prod_len;
+
+    int32_t* term_of_type;      /* Token type -> terminal, -1 if unbound */
+    size_t type_limit;
+
+    /* Actions: > 0 shift to state - 1, < 0 reduce production -a - 1,
+     * 0 error. Reducing production 0 accepts. */
+    int32_t* action_default;
+    int32_t* action_base;
+    int32_t* action_next;
+    int32_t* action_check;
+    size_t action_size;
+
+    int32_t* goto_default;
+    int32_t* goto_base;
+    int32_t* goto_next;
+    int32_t* goto_check;
+    size_t goto_size;
+
+    size_t sr_conflicts;
+    size_t rr_conflicts;
+};
+
+static void set_error(RiftGrammar* g, const char* fmt, const char* detail, size_t length) {
+    char name[128];
+    size_t n = length < sizeof(name) - 1 ? length : sizeof(name) - 1;
+    memcpy(name, detail ? detail : "", detail ? n : 0);
+    name[detail ? n : 0] = '\0';
+    snprintf(g->error, sizeof(g->error), fmt, name);
+}
+
+static void free_tables(RiftGrammar* g) {
+    free(g->prod_lhs);
+    free(g->prod_len);
+    free(g->term_of_type);
+    free(g->action_default);
+    free(g->action_base);
+    free(g->action_next);
+    free(g->action_check);
+    free(g->goto_default);
+    free(g->goto_base);
+    free(g->goto_next);
+    free(g->goto_check);
+
+    g->prod_lhs = g->prod_len = NULL;
+    g->term_of_type = NULL;
+    g->action_default = g->action_base = g->action_next = g->action_check = NULL;
+    g->goto_default = g->goto_base = g->goto_next = g->goto_check = NULL;
+    g->built = false;
+}
+
+static int32_t intern_symbol(RiftGrammar* g, const char* name, size_t length) {
+    for (size_t i = 0; i < g->symbol_count; i++) {
+        if (strlen(g->symbols[i].name) == length &&
+            memcmp(g->symbols[i].name, name, length) == 0) {
+            return (int32_t)i;
+        }
+    }
+
+    if (g->symbol_count == g->symbol_capacity) {
+        size_t capacity = g->symbol_capacity ? g->symbol_capacity * 2 : 32;
+        GrammarSymbol* symbols = realloc(g->symbols, capacity * sizeof(GrammarSymbol));
+        if (!symbols) return -1;
+        g->symbols = symbols;
+        g->symbol_capacity = capacity;
+    }
+
+    GrammarSymbol* symbol = &g->symbols[g->symbol_count];
+    memset(symbol, 0, sizeof(*symbol));
+    symbol->name = strndup(name, length);
+    if (!symbol->name) return -1;
+    return (int32_t)g->symbol_count++;
+}
+
+RiftGrammar* rift_grammar_create(void) {
+    return calloc(1, sizeof(RiftGrammar));
+}
+
+void rift_grammar_destroy(RiftGrammar* g) {
+    if (!g) return;
+
+    free_tables(g);
+    for (size_t i = 0; i < g->symbol_count; i++) free(g->symbols[i].name);
+    for (size_t i = 0; i < g->rule_count; i++) free(g->rules[i].rhs);
+    free(g->symbols);
+    free(g->rules);
+    free(g);
+}
+
+int rift_grammar_add_terminal(RiftGrammar* g, const char* name, uint32_t token_type) {
+    if (!g || !name || !*name || token_type > RIFT_GRAMMAR_MAX_TOKEN_TYPE) return -1;
+
+    int32_t index = intern_symbol(g, name, strlen(name));
+    if (index < 0) return -1;
+
+    GrammarSymbol* symbol = &g->symbols[index];
+    if (symbol->bound && symbol->token_type != token_type) {
+        set_error(g, "terminal '%s' is already bound", name, strlen(name));
+        return -1;
+    }
+    symbol->bound = true;
+    symbol->token_type = token_type;
+    free_tables(g);
+    return 0;
+}
+
+/* =================================================================
+ * BNF READER
+ * =================================================================
+ */
+
+typedef enum {
+    BNF_IDENT,
+    BNF_COLON,
+    BNF_BAR,
+    BNF_SEMI,
+    BNF_END
+} BnfKind;
+
+typedef struct {
+    BnfKind kind;
+    const char* text;
+    size_t length;
+} BnfToken;
+
+static BnfToken bnf_next(const char** cursor) {
+    const char* p = *cursor;
+    while (isspace((unsigned char)*p)) p++;
+
+    BnfToken token = { BNF_END, p, 0 };
+    if (*p == '\0') {
+        *cursor = p;
+        return token;
+    }
+
+    if (isalpha((unsigned char)*p) || *p == '_') {
+        const char* start = p;
+        while (isalnum((unsigned char)*p) || *p == '_') p++;
+        token.kind = BNF_IDENT;
+        token.length = (size_t)(p - start);
+    } else if (strncmp(p, "::=", 3) == 0) {
+        token.kind = BNF_COLON;
+        token.length = 3;
+        p += 3;
+    } else if (*p == ':' || *p == '|' || *p == ';') {
+        token.kind = *p == ':' ? BNF_COLON : *p == '|' ? BNF_BAR : BNF_SEMI;
+        token.length = 1;
+        p++;
+    } else {
+        /* Unknown character; reported by the caller */
+        token.kind = BNF_END;
+        token.length = 1;
+    }
+
+    *cursor = p;
+    return token;
+}
+
+static bool add_rule(RiftGrammar* g, uint32_t lhs, const uint32_t* rhs, uint32_t length) {
+    if (g->rule_count == g->rule_capacity) {
+        size_t capacity = g->rule_capacity ? g->rule_capacity * 2 : 32;
+        GrammarRule* rules = realloc(g->rules, capacity * sizeof(GrammarRule));
+        if (!rules) return false;
+        g->rules = rules;
+        g->rule_capacity = capacity;
+    }
+
+    GrammarRule* rule = &g->rules[g->rule_count];
+    rule->lhs = lhs;
+    rule->length = length;
+    rule->rhs = NULL;
+    if (length > 0) {
+        rule->rhs = malloc(length * sizeof(uint32_t));
+        if (!rule->rhs) return false;
+        memcpy(rule->rhs, rhs, length * sizeof(uint32_t));
+    }
+    g->rule_count++;
+    return true;
+}
+
+int rift_grammar_add_rules(RiftGrammar* g, const char* bnf) {
+    if (!g || !bnf) return -1;
+
+    size_t first_rule = g->rule_count;
+    size_t first_symbol = g->symbol_count;
+    uint32_t* rhs = NULL;
+    size_t rhs_capacity = 0;
+
+    const char* cursor = bnf;
+    BnfToken token = bnf_next(&cursor);
+    g->error[0] = '\0';
+
+    while (token.kind != BNF_END) {
+        if (token.kind != BNF_IDENT) {
+            set_error(g, "expected a rule name at '%s'", token.text, token.length);
+            goto fail;
+        }
+        int32_t lhs = intern_symbol(g, token.text, token.length);
+        if (lhs < 0) goto fail;
+
+        token = bnf_next(&cursor);
+        if (token.kind != BNF_COLON) {
+            set_error(g, "expected ':' after '%s'", g->symbols[lhs].name,
+                      strlen(g->symbols[lhs].name));
+            goto fail;
+        }
+        g->symbols[lhs].defined = true;
+
+        /* Alternatives until ';', end of input, or the next "name :" */
+        token = bnf_next(&cursor);
+        for (;;) {
+            uint32_t length = 0;
+            while (token.kind == BNF_IDENT) {
+                const char* lookahead = cursor;
+                if (bnf_next(&lookahead).kind == BNF_COLON) break;
+
+                int32_t symbol = intern_symbol(g, token.text, token.length);
+                if (symbol < 0) goto fail;
+                if (length == rhs_capacity) {
+                    rhs_capacity = rhs_capacity ? rhs_capacity * 2 : 16;
+                    uint32_t* grown = realloc(rhs, rhs_capacity * sizeof(uint32_t));
+                    if (!grown) goto fail;
+                    rhs = grown;
+                }
+                rhs[length++] = (uint32_t)symbol;
+                token = bnf_next(&cursor);
+            }
+            if (!add_rule(g, (uint32_t)lhs, rhs, length)) goto fail;
+
+            if (token.kind != BNF_BAR) break;
+            token = bnf_next(&cursor);
+        }
+
+        if (token.kind == BNF_SEMI) {
+            token = bnf_next(&cursor);
+        } else if (token.kind == BNF_END && token.length > 0) {
+            set_error(g, "unexpected character '%s'", token.text, 1);
+            goto fail;
+        }
+    }
+    if (token.length > 0) {
+        set_error(g, "unexpected character '%s'", token.text, 1);
+        goto fail;
+    }
+
+    free(rhs);
+    free_tables(g);
+    return (int)(g->rule_count - first_rule);
+
+fail:
+    /* Leave the grammar as it was before the call */
+    free(rhs);
+    for (size_t i = first_rule; i < g->rule_count; i++) free(g->rules[i].rhs);
+    g->rule_count = first_rule;
+    for (size_t i = first_symbol; i < g->symbol_count; i++) free(g->symbols[i].name);
+    g->symbol_count = first_symbol;
+    for (size_t i = 0; i < g->symbol_count; i++) {
+        bool still_defined = false;
+        for (size_t r = 0; r < g->rule_count && !still_defined; r++) {
+            still_defined = g->rules[r].lhs == i;
+        }
+        g->symbols[i].defined = still_defined;
+    }
+    if (!g->error[0]) snprintf(g->error, sizeof(g->error), "out of memory");
+    return -1;
+}
+
+/* =================================================================
+ * LR(0) AUTOMATON
+ * =================================================================
+ */
+
+typedef struct {
+    uint32_t* data;
+    size_t size;
+    size_t capacity;
+} U32Vec;
+
+static bool vec_push(U32Vec* v, uint32_t value) {
+    if (v->size == v->capacity) {
+        size_t capacity = v->capacity ? v->capacity * 2 : 64;
+        uint32_t* data = realloc(v->data, capacity * sizeof(uint32_t));
+        if (!data) return false;
+        v->data = data;
+        v->capacity = capacity;
+    }
+    v->data[v->size++] = value;
+    return true;
+}
+
+typedef struct {
+    uint32_t kernel, kernel_len;        /* Into Build.kernels, sorted */
+    uint32_t closure, closure_len;      /* Into Build.closures, kernel first */
+    uint32_t trans, trans_len;          /* Into Build.trans_*, by symbol */
+} LRState;
+
+typedef struct {
+    size_t T, N, P, W;
+
+    uint32_t* lhs;
+    uint32_t* len;
+    uint32_t* rhs_start;
+    U32Vec rhs;
+
+    uint32_t* item_base;                /* Item id of (p, 0) */
+    uint32_t* item_prod;
+    size_t item_count;
+
+    uint32_t* nt_first;                 /* Productions of n: nt_prods[nt_first[n]..nt_first[n+1]) */
+    uint32_t* nt_prods;
+    bool* nullable;
+    uint64_t* first;                    /* N rows of W words */
+
+    LRState* states;
+    size_t state_count;
+    size_t state_capacity;
+    U32Vec kernels;
+    U32Vec closures;
+    U32Vec trans_symbol;
+    U32Vec trans_target;
+
+    int32_t* lookup;                    /* Kernel hash -> state, -1 empty */
+    size_t lookup_size;
+
+    uint64_t* la;                       /* One row of W words per closure item */
+} Build;
+
+static inline uint32_t item_symbol(const Build* b, uint32_t item) {
+    uint32_t p = b->item_prod[item];
+    uint32_t dot = item - b->item_base[p];
+    return dot < b->len[p] ? b->rhs.data[b->rhs_start[p] + dot] : UINT32_MAX;
+}
+
+static void build_free(Build* b) {
+    free(b->lhs);
+    free(b->len);
+    free(b->rhs_start);
+    free(b->rhs.data);
+    free(b->item_base);
+    free(b->item_prod);
+    free(b->nt_first);
+    free(b->nt_prods);
+    free(b->nullable);
+    free(b->first);
+    free(b->states);
+    free(b->kernels.data);
+    free(b->closures.data);
+    free(b->trans_symbol.data);
+    free(b->trans_target.data);
+    free(b->lookup);
+    free(b->la);
+}
+
+/* Map named symbols to internal ids and flatten the productions */
+static bool build_symbols(RiftGrammar* g, Build* b) {
+    if (g->rule_count == 0) {
+        snprintf(g->error, sizeof(g->error), "no productions");
+        return false;
+    }
+
+    b->T = 1;
+    b->N = 1;
+    for (size_t i = 0; i < g->symbol_count; i++) {
+        GrammarSymbol* s = &g->symbols[i];
+        if (s->bound && s->defined) {
+            set_error(g, "'%s' is both a terminal and a rule", s->name, strlen(s->name));
+            return false;
+        }
+        if (!s->bound && !s->defined) {
+            set_error(g, "undefined symbol '%s'", s->name, strlen(s->name));
+            return false;
+        }
+        if (s->bound) s->id = (uint32_t)b->T++;
+    }
+    for (size_t i = 0; i < g->symbol_count; i++) {
+        if (g->symbols[i].defined) g->symbols[i].id = (uint32_t)(b->T + b->N++);
+    }
+    b->W = (b->T + 63) / 64;
+    b->P = g->rule_count + 1;
+
+    b->lhs = malloc(b->P * sizeof(uint32_t));
+    b->len = malloc(b->P * sizeof(uint32_t));
+    b->rhs_start = malloc(b->P * sizeof(uint32_t));
+    b->item_base = malloc(b->P * sizeof(uint32_t));
+    if (!b->lhs || !b->len || !b->rhs_start || !b->item_base) return false;
+
+    b->lhs[0] = (uint32_t)b->T;
+    b->len[0] = 1;
+    b->rhs_start[0] = 0;
+    if (!vec_push(&b->rhs, g->symbols[g->rules[0].lhs].id)) return false;
+
+    for (size_t r = 0; r < g->rule_count; r++) {
+        const GrammarRule* rule = &g->rules[r];
+        b->lhs[r + 1] = g->symbols[rule->lhs].id;
+        b->len[r + 1] = rule->length;
+        b->rhs_start[r + 1] = (uint32_t)b->rhs.size;
+        for (uint32_t k = 0; k < rule->length; k++) {
+            if (!vec_push(&b->rhs, g->symbols[rule->rhs[k]].id)) return false;
+        }
+    }
+
+    for (size_t p = 0; p < b->P; p++) {
+        b->item_base[p] = (uint32_t)b->item_count;
+        b->item_count += b->len[p] + 1;
+    }
+    b->item_prod = malloc(b->item_count * sizeof(uint32_t));
+    if (!b->item_prod) return false;
+    for (size_t p = 0; p < b->P; p++) {
+        for (uint32_t d = 0; d <= b->len[p]; d++) b->item_prod[b->item_base[p] + d] = (uint32_t)p;
+    }
+
+    /* Group productions by left-hand side */
+    b->nt_first = calloc(b->N + 1, sizeof(uint32_t));
+    b->nt_prods = malloc(b->P * sizeof(uint32_t));
+    if (!b->nt_first || !b->nt_prods) return false;
+    for (size_t p = 0; p < b->P; p++) b->nt_first[b->lhs[p] - b->T + 1]++;
+    for (size_t n = 0; n < b->N; n++) b->nt_first[n + 1] += b->nt_first[n];
+    uint32_t* fill = malloc(b->N * sizeof(uint32_t));
+    if (!fill) return false;
+    memcpy(fill, b->nt_first, b->N * sizeof(uint32_t));
+    for (size_t p = 0; p < b->P; p++) b->nt_prods[fill[b->lhs[p] - b->T]++] = (uint32_t)p;
+    free(fill);
+    return true;
+}
+
+/* Add FIRST(symbols) to set; true if every symbol is nullable */
+static bool first_of_sequence(const Build* b, const uint32_t* symbols, size_t count, uint64_t* set) {
+    for (size_t k = 0; k < count; k++) {
+        uint32_t x = symbols[k];
+        if (x < b->T) {
+            set[x / 64] |= 1ull << (x % 64);
+            return false;
+        }
+        const uint64_t* f = &b->first[(x - b->T) * b->W];
+        for (size_t w = 0; w < b->W; w++) set[w] |= f[w];
+        if (!b->nullable[x - b->T]) return false;
+    }
+    return true;
+}
+
+static bool or_into(uint64_t* dst, const uint64_t* src, size_t words) {
+    bool changed = false;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t merged = dst[w] | src[w];
+        changed |= merged != dst[w];
+        dst[w] = merged;
+    }
+    return changed;
+}
+
+static bool build_first_sets(Build* b) {
+    b->nullable = calloc(b->N, sizeof(bool));
+    b->first = calloc(b->N * b->W, sizeof(uint64_t));
+    uint64_t* set = malloc(b->W * sizeof(uint64_t));
+    if (!b->nullable || !b->first || !set) {
+        free(set);
+        return false;
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t p = 0; p < b->P; p++) {
+            size_t n = b->lhs[p] - b->T;
+            memset(set, 0, b->W * sizeof(uint64_t));
+            if (first_of_sequence(b, &b->rhs.data[b->rhs_start[p]], b->len[p], set) &&
+                !b->nullable[n]) {
+                b->nullable[n] = true;
+                changed = true;
+            }
+            changed |= or_into(&b->first[n * b->W], set, b->W);
+        }
+    }
+
+    free(set);
+    return true;
+}
+
+static uint64_t kernel_hash(const uint32_t* items, size_t count) {
+    return rift_hash64(items, count * sizeof(uint32_t), 0);
+}
+
+static bool lookup_grow(Build* b) {
+    size_t size = b->lookup_size ? b->lookup_size * 2 : 256;
+    int32_t* lookup = malloc(size * sizeof(int32_t));
+    if (!lookup) return false;
+    for (size_t i = 0; i < size; i++) lookup[i] = -1;
+
+    for (size_t s = 0; s < b->state_count; s++) {
+        const LRState* st = &b->states[s];
+        size_t k = kernel_hash(&b->kernels.data[st->kernel], st->kernel_len) & (size - 1);
+        while (lookup[k] >= 0) k = (k + 1) & (size - 1);
+        lookup[k] = (int32_t)s;
+    }
+    free(b->lookup);
+    b->lookup = lookup;
+    b->lookup_size = size;
+    return true;
+}
+
+/* State whose kernel is items (sorted), adding it if new; -1 on OOM */
+static int32_t find_or_add_state(Build* b, const uint32_t* items, size_t count) {
+    if ((b->state_count + 1) * 2 > b->lookup_size && !lookup_grow(b)) return -1;
+
+    size_t k = kernel_hash(items, count) & (b->lookup_size - 1);
+    for (; b->lookup[k] >= 0; k = (k + 1) & (b->lookup_size - 1)) {
+        const LRState* st = &b->states[b->lookup[k]];
+        if (st->kernel_len == count &&
+            memcmp(&b->kernels.data[st->kernel], items, count * sizeof(uint32_t)) == 0) {
+            return b->lookup[k];
+        }
+    }
+
+    if (b->state_count == b->state_capacity) {
+        size_t capacity = b->state_capacity ? b->state_capacity * 2 : 64;
+        LRState* states = realloc(b->states, capacity * sizeof(LRState));
+        if (!states) return -1;
+        b->states = states;
+        b->state_capacity = capacity;
+    }
+
+    LRState* st = &b->states[b->state_count];
+    memset(st, 0, sizeof(*st));
+    st->kernel = (uint32_t)b->kernels.size;
+    st->kernel_len = (uint32_t)count;
+    for (size_t i = 0; i < count; i++) {
+        if (!vec_push(&b->kernels, items[i])) return -1;
+    }
+    b->lookup[k] = (int32_t)b->state_count;
+    return (int32_t)b->state_count++;
+}
+
+static int compare_pairs(const void* a, const void* b) {
+    const uint64_t x = *(const uint64_t*)a;
+    const uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static bool build_automaton(Build* b) {
+    uint32_t start = b->item_base[0];
+    if (find_or_add_state(b, &start, 1) < 0) return false;
+
+    uint32_t* seen = calloc(b->N, sizeof(uint32_t));
+    uint64_t* pairs = NULL;
+    size_t pair_capacity = 0;
+    U32Vec group = { 0 };
+    bool ok = false;
+    if (!seen) return false;
+
+    for (size_t s = 0; s < b->state_count; s++) {
+        /* LR(0) closure: the kernel, then (q, 0) for each nonterminal reached */
+        uint32_t closure = (uint32_t)b->closures.size;
+        for (uint32_t i = 0; i < b->states[s].kernel_len; i++) {
+            if (!vec_push(&b->closures, b->kernels.data[b->states[s].kernel + i])) goto done;
+        }
+        for (size_t i = closure; i < b->closures.size; i++) {
+            uint32_t x = item_symbol(b, b->closures.data[i]);
+            if (x == UINT32_MAX || x < b->T || seen[x - b->T] == s + 1) continue;
+            seen[x - b->T] = (uint32_t)s + 1;
+            for (uint32_t k = b->nt_first[x - b->T]; k < b->nt_first[x - b->T + 1]; k++) {
+                if (!vec_push(&b->closures, b->item_base[b->nt_prods[k]])) goto done;
+            }
+        }
+        size_t closure_len = b->closures.size - closure;
+
+        /* Group advanced items by the symbol after the dot */
+        size_t pair_count = 0;
+        if (closure_len > pair_capacity) {
+            pair_capacity = closure_len * 2;
+            uint64_t* grown = realloc(pairs, pair_capacity * sizeof(uint64_t));
+            if (!grown) goto done;
+            pairs = grown;
+        }
+        for (size_t i = 0; i < closure_len; i++) {
+            uint32_t item = b->closures.data[closure + i];
+            uint32_t x = item_symbol(b, item);
+            if (x != UINT32_MAX) pairs[pair_count++] = ((uint64_t)x << 32) | (item + 1);
+        }
+        qsort(pairs, pair_count, sizeof(uint64_t), compare_pairs);
+
+        uint32_t trans = (uint32_t)b->trans_symbol.size;
+        for (size_t i = 0; i < pair_count;) {
+            uint32_t x = (uint32_t)(pairs[i] >> 32);
+            group.size = 0;
+            for (; i < pair_count && (uint32_t)(pairs[i] >> 32) == x; i++) {
+                if (!vec_push(&group, (uint32_t)pairs[i])) goto done;
+            }
+            int32_t target = find_or_add_state(b, group.data, group.size);
+            if (target < 0 || !vec_push(&b->trans_symbol, x) ||
+                !vec_push(&b->trans_target, (uint32_t)target)) {
+                goto done;
+            }
+        }
+
+        LRState* st = &b->states[s];
+        st->closure = closure;
+        st->closure_len = (uint32_t)closure_len;
+        st->trans = trans;
+        st->trans_len = (uint32_t)(b->trans_symbol.size - trans);
+    }
+    ok = true;
+
+done:
+    free(seen);
+    free(pairs);
+    free(group.data);
+    return ok;
+}
+
+static uint32_t goto_state(const Build* b, const LRState* st, uint32_t symbol) {
+    uint32_t lo = st->trans, hi = st->trans + st->trans_len;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (b->trans_symbol.data[mid] < symbol) lo = mid + 1;
+        else hi = mid;
+    }
+    return b->trans_target.data[lo];
+}
+
+static uint32_t kernel_position(const Build* b, const LRState* st, uint32_t item) {
+    const uint32_t* kernel = &b->kernels.data[st->kernel];
+    uint32_t lo = 0, hi = st->kernel_len;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (kernel[mid] < item) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * LALR(1) lookaheads by propagation over the LR(0) automaton: each
+ * closure item carries a lookahead set; closure spreads FIRST of the
+ * remainder to (B -> .γ) items within a state, and goto carries the
+ * set to the advanced kernel item. Merging by LR(0) kernel is what
+ * makes the result LALR rather than canonical LR(1).
+ */
+static bool build_lookaheads(Build* b) {
+    size_t W = b->W;
+    b->la = calloc(b->closures.size * W, sizeof(uint64_t));
+    int32_t* nt_start = malloc(b->N * sizeof(int32_t));
+    uint64_t* rest = malloc(W * sizeof(uint64_t));
+    if (!b->la || !nt_start || !rest) {
+        free(nt_start);
+        free(rest);
+        return false;
+    }
+
+    b->la[b->states[0].closure * W] = 1;      /* $end after the start item */
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t s = 0; s < b->state_count; s++) {
+            const LRState* st = &b->states[s];
+            const uint32_t* items = &b->closures.data[st->closure];
+
+            /* Where each nonterminal's (B -> .γ) items begin in this closure */
+            for (size_t n = 0; n < b->N; n++) nt_start[n] = -1;
+            for (uint32_t i = st->kernel_len; i < st->closure_len; i++) {
+                size_t n = b->lhs[b->item_prod[items[i]]] - b->T;
+                if (nt_start[n] < 0) nt_start[n] = (int32_t)i;
+            }
+
+            bool inner = true;
+            while (inner) {
+                inner = false;
+                for (uint32_t i = 0; i < st->closure_len; i++) {
+                    uint32_t x = item_symbol(b, items[i]);
+                    if (x == UINT32_MAX || x < b->T) continue;
+
+                    uint32_t p = b->item_prod[items[i]];
+                    uint32_t dot = items[i] - b->item_base[p];
+                    memset(rest, 0, W * sizeof(uint64_t));
+                    if (first_of_sequence(b, &b->rhs.data[b->rhs_start[p] + dot + 1],
+                                          b->len[p] - dot - 1, rest)) {
+                        or_into(rest, &b->la[(st->closure + i) * W], W);
+                    }
+
+                    size_t n = x - b->T;
+                    uint32_t count = b->nt_first[n + 1] - b->nt_first[n];
+                    for (uint32_t k = 0; k < count; k++) {
+                        inner |= or_into(&b->la[(st->closure + nt_start[n] + k) * W], rest, W);
+                    }
+                }
+            }
+
+            for (uint32_t i = 0; i < st->closure_len; i++) {
+                uint32_t x = item_symbol(b, items[i]);
+                if (x == UINT32_MAX) continue;
+                const LRState* target = &b->states[goto_state(b, st, x)];
+                uint32_t k = kernel_position(b, target, items[i] + 1);
+                changed |= or_into(&b->la[(target->closure + k) * W],
+                                   &b->la[(st->closure + i) * W], W);
+            }
+        }
+    }
+
+    free(nt_start);
+    free(rest);
+    return true;
+}
+
+/* =================================================================
+ * TABLE PACKING
+ * =================================================================
+ */
+
+typedef struct {
+    int32_t* base;
+    int32_t* next;
+    int32_t* check;
+    size_t size;
+} PackedTable;
+
+static size_t row_entries(const int32_t* row, size_t width, int32_t skip_a, int32_t skip_b) {
+    size_t count = 0;
+    for (size_t c = 0; c < width; c++) count += row[c] != skip_a && row[c] != skip_b;
+    return count;
+}
+
+/*
+ * Row displacement: every row's non-default entries are laid into
+ * one shared next[] at base[row] + column, first fit, densest rows
+ * first; check[] records which row owns a slot.
+ */
+static bool pack_rows(const int32_t* dense, size_t rows, size_t width,
+                      const int32_t* defaults, int32_t absent, PackedTable* out) {
+    memset(out, 0, sizeof(*out));
+    out->base = calloc(rows ? rows : 1, sizeof(int32_t));
+    size_t* order = malloc((rows ? rows : 1) * sizeof(size_t));
+    size_t* counts = malloc((rows ? rows : 1) * sizeof(size_t));
+    if (!out->base || !order || !counts) goto fail;
+
+    for (size_t r = 0; r < rows; r++) {
+        order[r] = r;
+        counts[r] = row_entries(&dense[r * width], width, defaults[r], absent);
+    }
+    /* Insertion sort by entry count, descending; rows are few */
+    for (size_t i = 1; i < rows; i++) {
+        size_t r = order[i], j = i;
+        for (; j > 0 && counts[order[j - 1]] < counts[r]; j--) order[j] = order[j - 1];
+        order[j] = r;
+    }
+
+    size_t capacity = 0, used = 0, lowest_free = 0;
+    for (size_t i = 0; i < rows; i++) {
+        size_t r = order[i];
+        const int32_t* row = &dense[r * width];
+        if (counts[r] == 0) continue;
+
+        size_t first_column = 0;
+        while (row[first_column] == defaults[r] || row[first_column] == absent) first_column++;
+        size_t base = lowest_free > first_column ? lowest_free - first_column : 0;
+
+        for (;; base++) {
+            if (base + width > capacity) {
+                size_t grown = capacity ? capacity * 2 : width * 4;
+                while (grown < base + width) grown *= 2;
+                int32_t* next = realloc(out->next, grown * sizeof(int32_t));
+                if (!next) goto fail;
+                out->next = next;
+                int32_t* check = realloc(out->check, grown * sizeof(int32_t));
+                if (!check) goto fail;
+                out->check = check;
+                for (size_t k = capacity; k < grown; k++) out->check[k] = -1;
+                capacity = grown;
+            }
+
+            bool fits = true;
+            for (size_t c = first_column; c < width && fits; c++) {
+                if (row[c] == defaults[r] || row[c] == absent) continue;
+                fits = out->check[base + c] < 0;
+            }
+            if (fits) break;
+        }
+
+        out->base[r] = (int32_t)base;
+        for (size_t c = 0; c < width; c++) {
+            if (row[c] == defaults[r] || row[c] == absent) continue;
+            out->next[base + c] = row[c];
+            out->check[base + c] = (int32_t)r;
+        }
+        if (base + width > used) used = base + width;
+        while (lowest_free < capacity && out->check[lowest_free] >= 0) lowest_free++;
+    }
+
+    /* Every base + column must be addressable */
+    if (used < width) used = width;
+    if (used > capacity) {
+        int32_t* next = realloc(out->next, used * sizeof(int32_t));
+        if (!next) goto fail;
+        out->next = next;
+        int32_t* check = realloc(out->check, used * sizeof(int32_t));
+        if (!check) goto fail;
+        out->check = check;
+        for (size_t k = capacity; k < used; k++) out->check[k] = -1;
+    }
+    out->size = used;
+
+    free(order);
+    free(counts);
+    return true;
+
+fail:
+    free(order);
+    free(counts);
+    free(out->base);
+    free(out->next);
+    free(out->check);
+    memset(out, 0, sizeof(*out));
+    return false;
+}
+
+/* Most frequent value in [0, limit) after mapping, or fallback; tally is zeroed */
+static int32_t most_common(const int32_t* values, size_t count, int32_t offset, int32_t sign,
+                           size_t limit, uint32_t* tally, int32_t fallback) {
+    int32_t best = fallback;
+    uint32_t best_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        int32_t key = sign * values[i] - offset;
+        if (key < 0 || (size_t)key >= limit) continue;
+        if (++tally[key] > best_count) {
+            best_count = tally[key];
+            best = values[i];
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        int32_t key = sign * values[i] - offset;
+        if (key >= 0 && (size_t)key < limit) tally[key] = 0;
+    }
+    return best;
+}
+
+static bool build_tables(RiftGrammar* g, Build* b) {
+    size_t T = b->T, N = b->N, S = b->state_count, W = b->W;
+    int32_t* actions = calloc(S * T, sizeof(int32_t));
+    int32_t* gotos = malloc(N * S * sizeof(int32_t));
+    bool ok = false;
+    if (!actions || !gotos) goto done;
+    for (size_t i = 0; i < N * S; i++) gotos[i] = -1;
+
+    g->sr_conflicts = 0;
+    g->rr_conflicts = 0;
+
+    for (size_t s = 0; s < S; s++) {
+        const LRState* st = &b->states[s];
+        int32_t* row = &actions[s * T];
+
+        for (uint32_t t = 0; t < st->trans_len; t++) {
+            uint32_t x = b->trans_symbol.data[st->trans + t];
+            uint32_t target = b->trans_target.data[st->trans + t];
+            if (x < T) row[x] = (int32_t)target + 1;
+            else gotos[(x - T) * S + s] = (int32_t)target;
+        }
+
+        for (uint32_t i = 0; i < st->closure_len; i++) {
+            uint32_t item = b->closures.data[st->closure + i];
+            if (item_symbol(b, item) != UINT32_MAX) continue;
+
+            int32_t reduce = -(int32_t)b->item_prod[item] - 1;
+            const uint64_t* la = &b->la[(st->closure + i) * W];
+            for (size_t t = 0; t < T; t++) {
+                if (!(la[t / 64] >> (t % 64) & 1)) continue;
+                if (row[t] == 0) {
+                    row[t] = reduce;
+                } else if (row[t] > 0) {
+                    g->sr_conflicts++;          /* Keep the shift */
+                } else {
+                    g->rr_conflicts++;          /* Keep the earlier production */
+                    if (reduce > row[t]) row[t] = reduce;
+                }
+            }
+        }
+    }
+
+    /* Default reduction per state (never accept, which must see $end)
+     * and default target per nonterminal */
+    g->action_default = malloc(S * sizeof(int32_t));
+    g->goto_default = malloc(N * sizeof(int32_t));
+    uint32_t* tally = calloc(b->P > S ? b->P : S, sizeof(uint32_t));
+    if (!g->action_default || !g->goto_default || !tally) {
+        free(tally);
+        goto done;
+    }
+    for (size_t s = 0; s < S; s++) {
+        /* Reduce p is -(p + 1); plain reductions map to keys 0..P-2 */
+        g->action_default[s] = most_common(&actions[s * T], T, 2, -1, b->P - 1, tally, 0);
+    }
+    for (size_t n = 0; n < N; n++) {
+        g->goto_default[n] = most_common(&gotos[n * S], S, 0, 1, S, tally, 0);
+    }
+    free(tally);
+
+    PackedTable packed;
+    if (!pack_rows(actions, S, T, g->action_default, 0, &packed)) goto done;
+    g->action_base = packed.base;
+    g->action_next = packed.next;
+    g->action_check = packed.check;
+    g->action_size = packed.size;
+
+    if (!pack_rows(gotos, N, S, g->goto_default, -1, &packed)) goto done;
+    g->goto_base = packed.base;
+    g->goto_next = packed.next;
+    g->goto_check = packed.check;
+    g->goto_size = packed.size;
+    ok = true;
+
+done:
+    free(actions);
+    free(gotos);
+    return ok;
+}
+
+int rift_grammar_build(RiftGrammar* g) {
+    if (!g) return -1;
+
+    free_tables(g);
+    g->error[0] = '\0';
+
+    Build b;
+    memset(&b, 0, sizeof(b));
+    bool ok = build_symbols(g, &b) && build_first_sets(&b) && build_automaton(&b) &&
+              build_lookaheads(&b) && build_tables(g, &b);
+
+    if (ok) {
+        g->terminal_count = b.T;
+        g->nonterminal_count = b.N;
+        g->production_count = b.P;
+        g->state_count = b.state_count;
+        g->prod_lhs = b.lhs;
+        g->prod_len = b.len;
+        b.lhs = NULL;
+        b.len = NULL;
+
+        g->type_limit = 0;
+        for (size_t i = 0; i < g->symbol_count; i++) {
+            if (g->symbols[i].bound && g->symbols[i].token_type >= g->type_limit) {
+                g->type_limit = g->symbols[i].token_type + 1;
+            }
+        }
+        g->term_of_type = malloc(g->type_limit * sizeof(int32_t));
+        ok = g->term_of_type != NULL;
+        for (size_t t = 0; ok && t < g->type_limit; t++) g->term_of_type[t] = -1;
+        for (size_t i = 0; ok && i < g->symbol_count; i++) {
+            if (g->symbols[i].bound) {
+                g->term_of_type[g->symbols[i].token_type] = (int32_t)g->symbols[i].id;
+            }
+        }
+    }
+
+    build_free(&b);
+    if (!ok) {
+        free_tables(g);
+        if (!g->error[0]) snprintf(g->error, sizeof(g->error), "out of memory");
+        return -1;
+    }
+    g->built = true;
+    return 0;
+}
+
+bool rift_grammar_is_built(const RiftGrammar* g) {
+    return g && g->built;
+}
+
+const char* rift_grammar_error(const RiftGrammar* g) {
+    return g ? g->error : "";
+}
+
+const char* rift_grammar_production_name(const RiftGrammar* g, uint32_t production) {
+    if (!g || production >= g->rule_count) return NULL;
+    return g->symbols[g->rules[production].lhs].name;
+}
+
+void rift_grammar_get_stats(const RiftGrammar* g, RiftGrammarStats* stats) {
+    if (!g || !stats) return;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->productions = g->rule_count;
+    if (!g->built) return;
+
+    stats->terminals = g->terminal_count;
+    stats->nonterminals = g->nonterminal_count - 1;
+    stats->states = g->state_count;
+    stats->shift_reduce_conflicts = g->sr_conflicts;
+    stats->reduce_reduce_conflicts = g->rr_conflicts;
+    stats->table_entries = g->action_size + g->goto_size;
+}
+
+/* =================================================================
+ * SHIFT-REDUCE DRIVER
+ * =================================================================
+ */
+
+static inline int32_t lookup_action(const RiftGrammar* g, uint32_t state, uint32_t terminal) {
+    size_t i = (size_t)g->action_base[state] + terminal;
+    return g->action_check[i] == (int32_t)state ? g->action_next[i] : g->action_default[state];
+}
+
+static inline uint32_t lookup_goto(const RiftGrammar* g, uint32_t state, uint32_t nonterminal) {
+    size_t n = nonterminal - g->terminal_count;
+    size_t i = (size_t)g->goto_base[n] + state;
+    return (uint32_t)(g->goto_check[i] == (int32_t)n ? g->goto_next[i] : g->goto_default[n]);
+}
+
+typedef struct {
+    uint32_t state;
+    uint32_t node_start;        /* First tree node of the symbol's subtree */
+    size_t first;               /* Token span of the symbol in this slot */
+    size_t end;
+} StackSlot;
+
+/* Next token at or after *index that is a grammar terminal; 0 at the end */
+static inline uint32_t next_terminal(const RiftGrammar* g, const uint32_t* types,
+                                     size_t count, size_t* index) {
+    for (; *index < count; (*index)++) {
+        uint32_t type = types[*index];
+        if (type < g->type_limit && g->term_of_type[type] >= 0) {
+            return (uint32_t)g->term_of_type[type];
+        }
+    }
+    return 0;
+}
+
+int rift_grammar_parse(const RiftGrammar* g,
+                       const uint32_t* token_types,
+                       size_t count,
+                       RiftReduceFn on_reduce,
+                       void* user_data,
+                       size_t* error_token) {
+    return rift_grammar_parse_tree(g, token_types, count, on_reduce, user_data,
+                                   NULL, error_token);
+}
+
+int rift_grammar_parse_tree(const RiftGrammar* g,
+                            const uint32_t* token_types,
+                            size_t count,
+                            RiftReduceFn on_reduce,
+                            void* user_data,
+                            FlatTree* tree,
+                            size_t* error_token) {
+    if (!g || !g->built || (!token_types && count > 0)) return -1;
+    if (tree) {
+        if (count >= FLAT_TREE_NONE) return -1;
+        flat_tree_clear(tree);
+    }
+
+    StackSlot local[128];
+    StackSlot* stack = local;
+    size_t capacity = sizeof(local) / sizeof(local[0]);
+    size_t top = 0;
+    stack[0] = (StackSlot){ 0, 0, 0, 0 };
+
+    size_t index = 0;
+    uint32_t terminal = next_terminal(g, token_types, count, &index);
+    int result = -1;
+
+    for (;;) {
+        int32_t action = lookup_action(g, stack[top].state, terminal);
+
+        if (action == 0) {
+            if (error_token) *error_token = index;
+            break;
+        }
+
+        if (top + 1 == capacity) {
+            size_t grown = capacity * 2;
+            StackSlot* bigger = malloc(grown * sizeof(StackSlot));
+            if (!bigger) {
+                if (error_token) *error_token = index;
+                break;
+            }
+            memcpy(bigger, stack, (top + 1) * sizeof(StackSlot));
+            if (stack != local) free(stack);
+            stack = bigger;
+            capacity = grown;
+        }
+
+        if (action > 0) {
+            uint32_t leaf = 0;
+            if (tree) {
+                leaf = flat_tree_append(tree, FLAT_TREE_TERMINAL | token_types[index], 1,
+                                        (uint32_t)index, (uint32_t)index + 1);
+                if (leaf == FLAT_TREE_NONE) {
+                    if (error_token) *error_token = index;
+                    break;
+                }
+            }
+            stack[++top] = (StackSlot){ (uint32_t)action - 1, leaf, index, index + 1 };
+            index++;
+            terminal = next_terminal(g, token_types, count, &index);
+            continue;
+        }
+
+        uint32_t production = (uint32_t)(-action - 1);
+        if (production == 0) {
+            result = tree && !flat_tree_finish(tree) ? -1 : 0;
+            if (result != 0 && error_token) *error_token = index;
+            break;
+        }
+
+        uint32_t length = g->prod_len[production];
+        size_t first = length ? stack[top - length + 1].first : stack[top].end;
+        size_t end = stack[top].end;
+        if (on_reduce) on_reduce(production - 1, first, end, user_data);
+
+        /* The right-hand side's subtrees are the newest nodes, in order */
+        uint32_t node_start = 0;
+        if (tree) {
+            node_start = length ? stack[top - length + 1].node_start : tree->count;
+            if (flat_tree_append(tree, production - 1, tree->count - node_start + 1,
+                                 (uint32_t)first, (uint32_t)end) == FLAT_TREE_NONE) {
+                if (error_token) *error_token = index;
+                break;
+            }
+        }
+
+        top -= length;
+        uint32_t state = lookup_goto(g, stack[top].state, g->prod_lhs[production]);
+        stack[++top] = (StackSlot){ state, node_start, first, end };
+    }
+
+    if (stack != local) free(stack);
+    return result;
+}
+
+/* =================================================================
+ * PUSH-MODE DRIVER
+ * =================================================================
+ */
+
+struct RiftGrammarPush {
+    const RiftGrammar* grammar;
+    RiftReduceFn on_reduce;
+    void* user_data;
+    StackSlot* stack;
+    size_t top;
+    size_t capacity;
+    size_t index;               /* Tokens fed so far */
+    bool failed;
+    bool accepted;
+};
+
+RiftGrammarPush* rift_grammar_push_create(const RiftGrammar* g,
+                                          RiftReduceFn on_reduce,
+                                          void* user_data) {
+    if (!g || !g->built) return NULL;
+
+    RiftGrammarPush* push = calloc(1, sizeof(RiftGrammarPush));
+    if (!push) return NULL;
+
+    push->capacity = 128;
+    push->stack = malloc(push->capacity * sizeof(StackSlot));
+    if (!push->stack) {
+        free(push);
+        return NULL;
+    }
+    push->grammar = g;
+    push->on_reduce = on_reduce;
+    push->user_data = user_data;
+    push->stack[0] = (StackSlot){ 0, 0, 0, 0 };
+    return push;
+}
+
+void rift_grammar_push_destroy(RiftGrammarPush* push) {
+    if (!push) return;
+    free(push->stack);
+    free(push);
+}
+
+/* Reduce until the terminal is shifted or the input accepted */
+static bool push_terminal(RiftGrammarPush* push, uint32_t terminal) {
+    const RiftGrammar* g = push->grammar;
+
+    for (;;) {
+        int32_t action = lookup_action(g, push->stack[push->top].state, terminal);
+        if (action == 0) return false;
+
+        if (push->top + 1 == push->capacity) {
+            size_t grown = push->capacity * 2;
+            StackSlot* bigger = realloc(push->stack, grown * sizeof(StackSlot));
+            if (!bigger) return false;
+            push->stack = bigger;
+            push->capacity = grown;
+        }
+        StackSlot* stack = push->stack;
+
+        if (action > 0) {
+            stack[++push->top] = (StackSlot){ (uint32_t)action - 1, 0, push->index,
+                                              push->index + 1 };
+            return true;
+        }
+
+        uint32_t production = (uint32_t)(-action - 1);
+        if (production == 0) {
+            push->accepted = true;
+            return true;
+        }
+
+        uint32_t length = g->prod_len[production];
+        size_t top = push->top;
+        size_t first = length ? stack[top - length + 1].first : stack[top].end;
+        size_t end = stack[top].end;
+        if (push->on_reduce) push->on_reduce(production - 1, first, end, push->user_data);
+
+        top -= length;
+        uint32_t state = lookup_goto(g, stack[top].state, g->prod_lhs[production]);
+        stack[++top] = (StackSlot){ state, 0, first, end };
+        push->top = top;
+    }
+}
+
+int rift_grammar_push_token(RiftGrammarPush* push, uint32_t token_type) {
+    if (!push || push->failed || push->accepted) return -1;
+
+    const RiftGrammar* g = push->grammar;
+    if (token_type < g->type_limit && g->term_of_type[token_type] >= 0 &&
+        !push_terminal(push, (uint32_t)g->term_of_type[token_type])) {
+        push->failed = true;
+        return -1;
+    }
+    push->index++;
+    return 0;
+}
+
+int rift_grammar_push_finish(RiftGrammarPush* push, size_t* error_token) {
+    if (!push) return -1;
+    if (!push->failed && !push->accepted && !push_terminal(push, 0)) push->failed = true;
+    if (push->failed || !push->accepted) {
+        if (error_token) *error_token = push->index;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,338 @@
+/*
+ * =================================================================
+ * rift_pratt.c - RIFT-0 Operator-Precedence Expression Parser
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rift-0/core/parser/rift_pratt.h"
+
+/* =================================================================
+ * BINDING TABLE
+ * =================================================================
+ */
+
+#define ROLE_OPERAND    0x01
+#define ROLE_PREFIX     0x02
+#define ROLE_INFIX      0x04
+#define ROLE_POSTFIX    0x08
+#define ROLE_OPEN       0x10
+#define ROLE_CLOSE      0x20
+#define ROLE_SEPARATOR  0x40
+
+/* Binding powers: an operator on the stack is reduced when its right
+ * power exceeds the left power of the operator arriving. Level L maps
+ * to 2L or 2L + 1, so ties break by associativity; at equal levels a
+ * prefix operator reduces before an infix one and a postfix operator
+ * applies before a prefix one. */
+typedef struct {
+    uint8_t roles;
+    uint16_t prefix_right;
+    uint16_t infix_left;
+    uint16_t infix_right;
+    uint16_t postfix_left;
+    uint32_t close_key;             /* Bracket that ends this group */
+} PrattEntry;
+
+struct RiftPratt {
+    PrattEntry* entries;            /* Indexed by key */
+    uint32_t limit;
+};
+
+RiftPratt* rift_pratt_create(void) {
+    return calloc(1, sizeof(RiftPratt));
+}
+
+void rift_pratt_destroy(RiftPratt* pratt) {
+    if (!pratt) return;
+    free(pratt->entries);
+    free(pratt);
+}
+
+static PrattEntry* pratt_entry(RiftPratt* pratt, uint32_t key) {
+    if (!pratt || key > RIFT_PRATT_MAX_KEY) return NULL;
+
+    if (key >= pratt->limit) {
+        uint32_t limit = pratt->limit ? pratt->limit : 64;
+        while (limit <= key) limit *= 2;
+        PrattEntry* entries = realloc(pratt->entries, limit * sizeof(PrattEntry));
+        if (!entries) return NULL;
+        memset(entries + pratt->limit, 0, (limit - pratt->limit) * sizeof(PrattEntry));
+        pratt->entries = entries;
+        pratt->limit = limit;
+    }
+    return &pratt->entries[key];
+}
+
+static bool valid_level(uint16_t level) {
+    return level >= 1 && level <= RIFT_PRATT_MAX_LEVEL;
+}
+
+int rift_pratt_add_operand(RiftPratt* pratt, uint32_t key) {
+    PrattEntry* entry = pratt_entry(pratt, key);
+    if (!entry) return -1;
+    entry->roles |= ROLE_OPERAND;
+    return 0;
+}
+
+int rift_pratt_add_prefix(RiftPratt* pratt, uint32_t key, uint16_t level) {
+    if (!valid_level(level)) return -1;
+    PrattEntry* entry = pratt_entry(pratt, key);
+    if (!entry) return -1;
+    entry->roles |= ROLE_PREFIX;
+    entry->prefix_right = (uint16_t)(2 * level + 1);
+    return 0;
+}
+
+int rift_pratt_add_infix(RiftPratt* pratt, uint32_t key, uint16_t level, RiftPrattAssoc assoc) {
+    if (!valid_level(level)) return -1;
+    PrattEntry* entry = pratt_entry(pratt, key);
+    if (!entry) return -1;
+    entry->roles |= ROLE_INFIX;
+    entry->infix_left = (uint16_t)(2 * level + (assoc == RIFT_PRATT_RIGHT));
+    entry->infix_right = (uint16_t)(2 * level + (assoc == RIFT_PRATT_LEFT));
+    return 0;
+}
+
+int rift_pratt_add_postfix(RiftPratt* pratt, uint32_t key, uint16_t level) {
+    if (!valid_level(level)) return -1;
+    PrattEntry* entry = pratt_entry(pratt, key);
+    if (!entry) return -1;
+    entry->roles |= ROLE_POSTFIX;
+    entry->postfix_left = (uint16_t)(2 * level + 1);
+    return 0;
+}
+
+int rift_pratt_add_group(RiftPratt* pratt, uint32_t open_key, uint32_t close_key) {
+    PrattEntry* close = pratt_entry(pratt, close_key);
+    if (!close) return -1;
+    close->roles |= ROLE_CLOSE;
+
+    PrattEntry* open = pratt_entry(pratt, open_key);
+    if (!open) return -1;
+    open->roles |= ROLE_OPEN;
+    open->close_key = close_key;
+    return 0;
+}
+
+int rift_pratt_add_separator(RiftPratt* pratt, uint32_t key) {
+    PrattEntry* entry = pratt_entry(pratt, key);
+    if (!entry) return -1;
+    entry->roles |= ROLE_SEPARATOR;
+    return 0;
+}
+
+/* =================================================================
+ * PARSER
+ * =================================================================
+ */
+
+typedef struct {
+    uint32_t node_start;            /* First tree node of the subtree */
+    uint32_t root;                  /* Its root, the last node appended */
+    uint32_t first;                 /* Token span */
+    uint32_t end;
+} Operand;
+
+typedef struct {
+    uint32_t kind;                  /* Fixity | key; 0 for a group */
+    uint32_t token;
+    uint32_t close_key;
+    uint16_t right;
+} Operator;
+
+typedef struct {
+    const RiftPratt* pratt;
+    FlatTree* tree;
+
+    Operand* operands;
+    size_t operand_count;
+    size_t operand_capacity;
+    Operator* operators;
+    size_t operator_count;
+    size_t operator_capacity;
+    Operand operand_local[64];
+    Operator operator_local[64];
+} PrattRun;
+
+static bool grow(void** items, size_t* capacity, size_t size, void* local) {
+    size_t grown = *capacity * 2;
+    void* bigger = malloc(grown * size);
+    if (!bigger) return false;
+    memcpy(bigger, *items, *capacity * size);
+    if (*items != local) free(*items);
+    *items = bigger;
+    *capacity = grown;
+    return true;
+}
+
+static bool push_operand(PrattRun* run, Operand operand) {
+    if (run->operand_count == run->operand_capacity &&
+        !grow((void**)&run->operands, &run->operand_capacity, sizeof(Operand),
+              run->operand_local)) {
+        return false;
+    }
+    run->operands[run->operand_count++] = operand;
+    return true;
+}
+
+static bool push_operator(PrattRun* run, Operator op) {
+    if (run->operator_count == run->operator_capacity &&
+        !grow((void**)&run->operators, &run->operator_capacity, sizeof(Operator),
+              run->operator_local)) {
+        return false;
+    }
+    run->operators[run->operator_count++] = op;
+    return true;
+}
+
+/* Append an operator node over the operands' subtrees; the operand
+ * stack top becomes the new node */
+static bool build_node(PrattRun* run, uint32_t kind, size_t arity, uint32_t first, uint32_t end) {
+    if (run->operand_count < arity) return false;
+
+    Operand* lhs = &run->operands[run->operand_count - arity];
+    uint32_t node_start = lhs->node_start;
+    uint32_t size = run->tree->count - node_start + 1;
+    uint32_t root = flat_tree_append(run->tree, kind, size, first, end);
+    if (root == FLAT_TREE_NONE) return false;
+
+    run->operand_count -= arity;
+    run->operands[run->operand_count++] = (Operand){ node_start, root, first, end };
+    return true;
+}
+
+static bool reduce_top(PrattRun* run) {
+    if (run->operand_count == 0) return false;
+    Operator op = run->operators[--run->operator_count];
+    Operand* top = &run->operands[run->operand_count - 1];
+
+    if (RIFT_PRATT_FIXITY(op.kind) == RIFT_PRATT_PREFIX) {
+        return build_node(run, op.kind, 1, op.token, top->end);
+    }
+    if (run->operand_count < 2) return false;
+    return build_node(run, op.kind, 2, top[-1].first, top->end);
+}
+
+/* Reduce every operator that binds tighter than `left`, stopping at a
+ * group bracket */
+static bool reduce_while(PrattRun* run, uint16_t left) {
+    while (run->operator_count > 0) {
+        const Operator* top = &run->operators[run->operator_count - 1];
+        if (top->kind == 0 || top->right <= left) break;
+        if (!reduce_top(run)) return false;
+    }
+    return true;
+}
+
+/* Close the current expression as a root of the forest */
+static bool finish_expression(PrattRun* run) {
+    if (!reduce_while(run, 0)) return false;
+    if (run->operator_count > 0 || run->operand_count != 1) return false;
+    run->operand_count = 0;
+    return true;
+}
+
+int rift_pratt_parse(const RiftPratt* pratt,
+                     const uint32_t* keys,
+                     size_t count,
+                     FlatTree* tree,
+                     size_t* error_token) {
+    if (!pratt || !tree || (!keys && count > 0) || count >= FLAT_TREE_NONE) return -1;
+    flat_tree_clear(tree);
+
+    PrattRun run = { .pratt = pratt, .tree = tree };
+    run.operands = run.operand_local;
+    run.operand_capacity = sizeof(run.operand_local) / sizeof(run.operand_local[0]);
+    run.operators = run.operator_local;
+    run.operator_capacity = sizeof(run.operator_local) / sizeof(run.operator_local[0]);
+
+    bool expect_operand = true;
+    size_t failed = count;
+    size_t i = 0;
+    int result = -1;
+
+    while (i < count) {
+        uint32_t key = keys[i];
+        uint8_t roles = key < pratt->limit ? pratt->entries[key].roles : 0;
+        if (roles == 0) {
+            i++;
+            continue;
+        }
+        const PrattEntry* entry = &pratt->entries[key];
+        uint32_t token = (uint32_t)i;
+        bool ok = true;
+
+        if (expect_operand) {
+            if (roles & ROLE_OPERAND) {
+                uint32_t leaf = flat_tree_append(tree, FLAT_TREE_TERMINAL | key, 1, token, token + 1);
+                ok = leaf != FLAT_TREE_NONE &&
+                     push_operand(&run, (Operand){ leaf, leaf, token, token + 1 });
+                expect_operand = false;
+            } else if (roles & ROLE_PREFIX) {
+                ok = push_operator(&run, (Operator){ RIFT_PRATT_PREFIX | key, token, 0,
+                                                     entry->prefix_right });
+            } else if (roles & ROLE_OPEN) {
+                ok = push_operator(&run, (Operator){ 0, token, entry->close_key, 0 });
+            } else {
+                /* A separator may only stand between expressions */
+                ok = (roles & ROLE_SEPARATOR) && run.operator_count == 0;
+            }
+        } else if (roles & ROLE_INFIX) {
+            ok = reduce_while(&run, entry->infix_left) &&
+                 push_operator(&run, (Operator){ RIFT_PRATT_INFIX | key, token, 0,
+                                                 entry->infix_right });
+            expect_operand = true;
+        } else if (roles & ROLE_POSTFIX) {
+            ok = reduce_while(&run, entry->postfix_left) &&
+                 build_node(&run, RIFT_PRATT_POSTFIX | key, 1,
+                            run.operands[run.operand_count - 1].first, token + 1);
+        } else if (roles & ROLE_CLOSE) {
+            ok = reduce_while(&run, 0) && run.operator_count > 0;
+            if (ok) {
+                Operator open = run.operators[run.operator_count - 1];
+                ok = open.kind == 0 && open.close_key == key;
+                if (ok) {
+                    /* The bracketed expression's span takes in its brackets */
+                    Operand* inner = &run.operands[run.operand_count - 1];
+                    inner->first = open.token;
+                    inner->end = token + 1;
+                    tree->nodes[inner->root].first_token = inner->first;
+                    tree->nodes[inner->root].end_token = inner->end;
+                    run.operator_count--;
+                }
+            }
+        } else if (roles & ROLE_SEPARATOR) {
+            ok = finish_expression(&run);
+            expect_operand = true;
+        } else {
+            /* An operand where an operator was expected starts the next
+             * expression; the token is read again */
+            ok = finish_expression(&run);
+            expect_operand = true;
+            if (ok) continue;
+        }
+
+        if (!ok) {
+            failed = i;
+            goto done;
+        }
+        i++;
+    }
+
+    /* Input ended: a dangling operator or open bracket is incomplete */
+    if (expect_operand ? run.operator_count == 0 : finish_expression(&run)) {
+        result = flat_tree_finish(tree) ? 0 : -1;
+    }
+
+done:
+    if (result != 0 && error_token) *error_token = failed;
+    if (run.operands != run.operand_local) free(run.operands);
+    if (run.operators != run.operator_local) free(run.operators);
+    return result;
+}
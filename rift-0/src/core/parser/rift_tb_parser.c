@@ -52,190 +52,279 @@ char* strdup(const char* s);
 #include <fcntl.h>
 #include <assert.h>
 
+/* Top-down scheduling queue (grows instead of dropping work) */
+#include "rift-0/core/lexer/heap_queue.h"
+
 /* =================================================================
- * PRIORITY QUEUE FOR TOP-DOWN SCHEDULING
+ * DUAL-MODE PARSING ENGINE
  * =================================================================
  */
 
-typedef struct {
-    void* data;
-    int priority;
-} PQNode;
+/* Parse tree node for recursive descent; lives in td_state.arena
+ * until the next parse, and value points into the input */
+typedef struct ParseNode {
+    uint32_t type;
+    const char* value;
+    size_t start;
+    size_t end;
+    struct ParseNode* children;
+    size_t child_count;
+} ParseNode;
 
-typedef struct {
-    PQNode* nodes;
-    size_t size;
-    size_t capacity;
-} PriorityQueue;
+/* Output lexeme: a span into the input unless copies were asked for */
+static void* token_lexeme(const DualModeParser* parser, const char* input,
+                          size_t start, size_t end) {
+    if (parser->copy_lexemes) return strndup(input + start, end - start);
+    return (void*)(input + start);
+}
+
+/* Length of a match at pos that stays before end, -1 if none */
+static long bounded_match(const regex_t* regex, const char* input, size_t pos, size_t end) {
+    regmatch_t match;
+    int flags = 0;
+#ifdef REG_STARTEND
+    match.rm_so = 0;
+    match.rm_eo = (regoff_t)(end - pos);
+    flags = REG_STARTEND;
+#endif
+    if (regexec(regex, input + pos, 1, &match, flags) != 0 || match.rm_so != 0) return -1;
+    if ((size_t)match.rm_eo > end - pos) return -1;
+    return (long)match.rm_eo;
+}
 
-static PriorityQueue* pq_create(size_t capacity) {
-    PriorityQueue* pq = calloc(1, sizeof(PriorityQueue));
-    if (!pq) return NULL;
+/* Where a match at pos must end by: length, or with line matching the
+ * end of pos's line past its newline. Line matching restarts the token
+ * stream at every line start, so a line's tokens depend on that line
+ * alone. */
+static size_t match_limit(const DualModeParser* parser, const char* input,
+                          size_t pos, size_t length) {
+    if (!parser->line_matching) return length;
+    const char* newline = memchr(input + pos, '\n', length - pos);
+    return newline ? (size_t)(newline - input) + 1 : length;
+}
+
+static size_t line_start(const char* input, size_t pos) {
+    while (pos > 0 && input[pos - 1] != '\n') pos--;
+    return pos;
+}
+
+/* Length of pattern i's match at pos, ending by end, -1 if it does not
+ * match there. In packrat mode each (pattern, offset) is tried once per
+ * input; the passes compile separate but identical regexes, so either
+ * may answer for the other. */
+static long match_pattern(DualModeParser* parser,
+                          size_t i,
+                          const regex_t* regex,
+                          const char* input,
+                          size_t pos,
+                          size_t end) {
+    PackratMemo* memo = parser->td_state.memo;
+    size_t length = 0;
     
-    pq->nodes = calloc(capacity, sizeof(PQNode));
-    if (!pq->nodes) {
-        free(pq);
-        return NULL;
+    if (memo) {
+        PackratResult memoized = packrat_memo_lookup(memo, i, pos, &length);
+        if (memoized != PACKRAT_UNKNOWN) {
+            atomic_fetch_add_explicit(&parser->stats.memo_hits, 1, memory_order_relaxed);
+            return memoized == PACKRAT_MATCH ? (long)length : -1;
+        }
     }
     
-    pq->capacity = capacity;
-    pq->size = 0;
-    return pq;
+    long matched = bounded_match(regex, input, pos, end);
+    if (memo) packrat_memo_store(memo, i, pos, matched >= 0, matched >= 0 ? (size_t)matched : 0);
+    return matched;
 }
 
-static void pq_heapify_up(PriorityQueue* pq, size_t idx) {
-    while (idx > 0) {
-        size_t parent = (idx - 1) / 2;
-        if (pq->nodes[parent].priority >= pq->nodes[idx].priority) break;
+/* Top-down recursive descent parser; matches stop at end */
+static ParseNode* parse_top_down(DualModeParser* parser,
+                                const char* input,
+                                size_t* pos,
+                                size_t end) {
+    if (!parser || !input || *pos >= end) return NULL;
+    
+    /* Check recursion depth */
+    if (parser->td_state.recursion_depth >= parser->td_state.max_recursion) {
+        return NULL;
+    }
+    
+    parser->td_state.recursion_depth++;
+    atomic_fetch_add(&parser->stats.top_down_ops, 1);
+    
+    /* Try to match patterns in order */
+    for (size_t i = 0; i < parser->pattern_count; i++) {
+        RiftRegexPattern* pattern = parser->patterns[i];
         
-        /* Swap with parent */
-        PQNode temp = pq->nodes[parent];
-        pq->nodes[parent] = pq->nodes[idx];
-        pq->nodes[idx] = temp;
-        idx = parent;
+        /* Only use patterns marked for top-down or dual mode */
+        if (!(pattern->parse_mode & PARSE_MODE_TOP_DOWN)) continue;
+        
+        long matched = match_pattern(parser, i, pattern->td_regex, input, *pos, end);
+        if (matched >= 0) {  /* Match at current position */
+            ParseNode* node = parse_arena_alloc(parser->td_state.arena, sizeof(ParseNode));
+            if (!node) break;
+            *node = (ParseNode){
+                .type = i,  /* Pattern index as type */
+                .value = input + *pos,
+                .start = *pos,
+                .end = *pos + (size_t)matched,
+            };
+            *pos = node->end;
+            
+            parser->td_state.recursion_depth--;
+            return node;
+        }
     }
+    
+    /* No match found */
+    parser->td_state.recursion_depth--;
+    return NULL;
 }
 
-static bool pq_push(PriorityQueue* pq, void* data, int priority) {
-    if (!pq || pq->size >= pq->capacity) return false;
+bool rift_tb_set_packrat(DualModeParser* parser, bool enabled, size_t window) {
+    if (!parser) return false;
     
-    pq->nodes[pq->size].data = data;
-    pq->nodes[pq->size].priority = priority;
-    pq_heapify_up(pq, pq->size);
-    pq->size++;
+    pthread_mutex_lock(&parser->context_mutex);
+    
+    /* The table is sized on the next parse, once the patterns are known */
+    packrat_memo_destroy(parser->td_state.memo);
+    parser->td_state.memo = NULL;
+    parser->td_state.packrat_window = 0;
+    if (enabled) {
+        parser->td_state.packrat_window = window ? window : PACKRAT_DEFAULT_WINDOW;
+    }
+    
+    pthread_mutex_unlock(&parser->context_mutex);
     return true;
 }
 
+void rift_tb_set_copy_lexemes(DualModeParser* parser, bool enabled) {
+    if (!parser) return;
+    
+    pthread_mutex_lock(&parser->context_mutex);
+    parser->copy_lexemes = enabled;
+    pthread_mutex_unlock(&parser->context_mutex);
+}
+
 /* =================================================================
- * STACK IMPLEMENTATION FOR PARSING
+ * GRAMMAR RULES
  * =================================================================
  */
 
-typedef struct StackNode {
-    void* data;
-    struct StackNode* next;
-} StackNode;
-
-typedef struct {
-    StackNode* top;
-    size_t size;
-    pthread_mutex_t mutex;
-} ParseStack;
-
-static ParseStack* stack_create(void) {
-    ParseStack* stack = calloc(1, sizeof(ParseStack));
-    if (!stack) return NULL;
+bool rift_tb_add_terminal(DualModeParser* parser,
+                         const char* name,
+                         const char* pattern,
+                         const char* flags) {
+    if (!parser || !name || !pattern || !flags) return false;
     
-    pthread_mutex_init(&stack->mutex, NULL);
-    return stack;
+    pthread_mutex_lock(&parser->context_mutex);
+    
+    bool ok = false;
+    if (!parser->bu_state.grammar) parser->bu_state.grammar = rift_grammar_create();
+    if (parser->bu_state.grammar) {
+        int index = add_pattern_locked(parser, pattern, flags, false);
+        ok = index >= 0 &&
+             rift_grammar_add_terminal(parser->bu_state.grammar, name, (uint32_t)index) == 0;
+    }
+    
+    pthread_mutex_unlock(&parser->context_mutex);
+    return ok;
 }
 
-static bool stack_push(ParseStack* stack, void* data) {
-    if (!stack) return false;
+bool rift_tb_add_rule(DualModeParser* parser, const char* productions) {
+    if (!parser || !productions) return false;
     
-    pthread_mutex_lock(&stack->mutex);
+    pthread_mutex_lock(&parser->context_mutex);
     
-    StackNode* node = calloc(1, sizeof(StackNode));
-    if (!node) {
-        pthread_mutex_unlock(&stack->mutex);
-        return false;
-    }
+    if (!parser->bu_state.grammar) parser->bu_state.grammar = rift_grammar_create();
+    bool ok = parser->bu_state.grammar &&
+              rift_grammar_add_rules(parser->bu_state.grammar, productions) >= 0;
     
-    node->data = data;
-    node->next = stack->top;
-    stack->top = node;
-    stack->size++;
+    pthread_mutex_unlock(&parser->context_mutex);
+    return ok;
+}
+
+void rift_tb_set_reduce_handler(DualModeParser* parser,
+                               RiftReduceFn on_reduce,
+                               void* user_data) {
+    if (!parser) return;
     
-    pthread_mutex_unlock(&stack->mutex);
-    return true;
+    pthread_mutex_lock(&parser->context_mutex);
+    parser->bu_state.on_reduce = on_reduce;
+    parser->bu_state.reduce_data = user_data;
+    pthread_mutex_unlock(&parser->context_mutex);
 }
 
-static void* stack_pop(ParseStack* stack) {
-    if (!stack) return NULL;
+/* LALR(1) parse of a token stream; caller holds context_mutex */
+static int run_grammar(DualModeParser* parser, const TokenMemory* tokens, size_t count) {
+    RiftGrammar* grammar = parser->bu_state.grammar;
+    parser->bu_state.accepted = false;
+    parser->bu_state.error_token = 0;
     
-    pthread_mutex_lock(&stack->mutex);
+    /* Tables are built on first use after the rules change */
+    if (!grammar) return -1;
+    if (!rift_grammar_is_built(grammar) && rift_grammar_build(grammar) != 0) return -1;
     
-    if (!stack->top) {
-        pthread_mutex_unlock(&stack->mutex);
-        return NULL;
+    if (count > parser->bu_state.type_capacity) {
+        uint32_t* types = realloc(parser->bu_state.type_scratch, count * sizeof(uint32_t));
+        if (!types) return -1;
+        parser->bu_state.type_scratch = types;
+        parser->bu_state.type_capacity = count;
+    }
+    for (size_t i = 0; i < count; i++) {
+        parser->bu_state.type_scratch[i] = tokens[i].token_type;
     }
     
-    StackNode* node = stack->top;
-    void* data = node->data;
-    stack->top = node->next;
-    stack->size--;
-    free(node);
+    /* The tree keeps its storage across parses */
+    if (!parser->bu_state.tree) parser->bu_state.tree = flat_tree_create(0);
     
-    pthread_mutex_unlock(&stack->mutex);
-    return data;
+    int result = rift_grammar_parse_tree(grammar, parser->bu_state.type_scratch, count,
+                                         parser->bu_state.on_reduce,
+                                         parser->bu_state.reduce_data,
+                                         parser->bu_state.tree,
+                                         &parser->bu_state.error_token);
+    parser->bu_state.accepted = result == 0;
+    return result;
 }
 
-/* =================================================================
- * DUAL-MODE PARSING ENGINE
- * =================================================================
- */
-
-/* Parse tree node for recursive descent */
-typedef struct ParseNode {
-    uint32_t type;
-    void* value;
-    struct ParseNode* children;
-    size_t child_count;
-} ParseNode;
+const FlatTree* rift_tb_parse_tree(const DualModeParser* parser) {
+    if (!parser || !parser->bu_state.accepted) return NULL;
+    if (!parser->bu_state.tree || !parser->bu_state.tree->finished) return NULL;
+    return parser->bu_state.tree;
+}
 
-/* Top-down recursive descent parser */
-static ParseNode* parse_top_down(DualModeParser* parser,
-                                const char* input,
-                                size_t* pos,
-                                size_t length) {
-    if (!parser || !input || *pos >= length) return NULL;
+int rift_tb_parse_tokens(DualModeParser* parser,
+                        const TokenMemory* tokens,
+                        size_t count) {
+    if (!parser || (!tokens && count > 0)) return -1;
     
-    /* Check recursion depth */
-    if (parser->td_state.recursion_depth >= parser->td_state.max_recursion) {
-        return NULL;
-    }
-    
-    parser->td_state.recursion_depth++;
-    atomic_fetch_add(&parser->stats.top_down_ops, 1);
-    
-    ParseNode* node = calloc(1, sizeof(ParseNode));
-    if (!node) {
-        parser->td_state.recursion_depth--;
-        return NULL;
-    }
-    
-    /* Try to match patterns in order */
+    pthread_mutex_lock(&parser->context_mutex);
+    int result = run_grammar(parser, tokens, count);
+    pthread_mutex_unlock(&parser->context_mutex);
+    return result;
+}
+
+/* First bottom-up pattern matching at pos, ending by end: its length,
+ * -1 if none */
+static long bottom_up_step(DualModeParser* parser,
+                           const char* input,
+                           size_t pos,
+                           size_t end,
+                           uint32_t* type) {
     for (size_t i = 0; i < parser->pattern_count; i++) {
         RiftRegexPattern* pattern = parser->patterns[i];
         
-        /* Only use patterns marked for top-down or dual mode */
-        if (!(pattern->parse_mode & PARSE_MODE_TOP_DOWN)) continue;
+        /* Only use patterns marked for bottom-up or dual mode */
+        if (!(pattern->parse_mode & PARSE_MODE_BOTTOM_UP)) continue;
         
-        regmatch_t match;
-        if (regexec(pattern->compiled_regex, input + *pos, 1, &match, 0) == 0) {
-            if (match.rm_so == 0) {  /* Match at current position */
-                node->type = i;  /* Pattern index as type */
-                node->value = strndup(input + *pos, match.rm_eo - match.rm_so);
-                *pos += match.rm_eo;
-                
-                /* Push to parse stack for tracking */
-                if (parser->td_state.parse_stack) {
-                    stack_push((ParseStack*)parser->td_state.parse_stack, node);
-                }
-                
-                parser->td_state.recursion_depth--;
-                return node;
-            }
+        long matched = match_pattern(parser, i, pattern->compiled_regex, input, pos, end);
+        if (matched >= 0) {
+            *type = (uint32_t)i;
+            atomic_fetch_add(&parser->stats.bottom_up_ops, 1);
+            return matched;
         }
     }
-    
-    /* No match found */
-    free(node);
-    parser->td_state.recursion_depth--;
-    return NULL;
+    return -1;
 }
 
-/* Bottom-up shift-reduce parser */
+/* Bottom-up shift-reduce parser: tokenize, then reduce by the grammar */
 static bool parse_bottom_up(DualModeParser* parser,
                            const char* input,
                            size_t length,
@@ -243,56 +332,129 @@ static bool parse_bottom_up(DualModeParser* parser,
                            size_t* output_count) {
     if (!parser || !input || !output) return false;
     
-    ParseStack* reduce_stack = (ParseStack*)parser->bu_state.reduce_stack;
-    if (!reduce_stack) return false;
-    
     size_t pos = 0;
+    size_t end = 0;
     size_t token_idx = 0;
     
     while (pos < length && token_idx < parser->bu_state.memory_size) {
-        bool matched = false;
+        if (pos >= end) end = match_limit(parser, input, pos, length);
+        uint32_t type = 0;
+        long matched = bottom_up_step(parser, input, pos, end, &type);
         
-        /* Try each pattern */
-        for (size_t i = 0; i < parser->pattern_count; i++) {
-            RiftRegexPattern* pattern = parser->patterns[i];
+        if (matched >= 0) {
+            /* Store token with memory */
+            TokenMemory* token = &output[token_idx];
+            token->token_type = type;
+            token->token_value = (uint32_t)matched;
+            token->lexeme_start = pos;
+            token->lexeme_end = pos + (size_t)matched;
+            token->memory_value = token_lexeme(parser, input, pos, token->lexeme_end);
             
-            /* Only use patterns marked for bottom-up or dual mode */
-            if (!(pattern->parse_mode & PARSE_MODE_BOTTOM_UP)) continue;
-            
-            regmatch_t match;
-            if (regexec(pattern->compiled_regex, input + pos, 1, &match, 0) == 0) {
-                if (match.rm_so == 0) {
-                    /* Store token with memory */
-                    TokenMemory* token = &output[token_idx];
-                    token->token_type = i;
-                    token->token_value = (uint32_t)match.rm_eo;
-                    token->lexeme_start = pos;
-                    token->lexeme_end = pos + match.rm_eo;
-                    
-                    /* Allocate and store lexeme in memory */
-                    token->memory_value = strndup(input + pos, match.rm_eo);
-                    
-                    /* Push to reduce stack */
-                    stack_push(reduce_stack, token);
-                    
-                    pos += match.rm_eo;
-                    token_idx++;
-                    matched = true;
-                    
-                    atomic_fetch_add(&parser->stats.bottom_up_ops, 1);
-                    break;
-                }
-            }
-        }
-        
-        if (!matched) {
+            pos += (size_t)matched;
+            token_idx++;
+        } else {
             /* Skip unmatched character */
             pos++;
         }
     }
     
     *output_count = token_idx;
-    return true;
+    
+    /* Without rules the token stream is the result */
+    if (!parser->bu_state.grammar) return true;
+    return run_grammar(parser, output, token_idx) == 0;
+}
+
+/* =================================================================
+ * CONCURRENT PASSES AND CONSENSUS MERGE
+ * =================================================================
+ */
+
+/* Top-down pass over the whole input; each token is published with a
+ * release store so the merge can consume it while the pass continues */
+typedef struct {
+    DualModeParser* parser;
+    const char* input;
+    size_t length;
+    TokenMemory* tokens;
+    size_t capacity;
+    atomic_size_t published;
+    atomic_bool claimed;        /* Set by whichever thread runs the pass */
+    atomic_bool done;
+} TopDownPass;
+
+static void run_top_down_pass(TopDownPass* pass) {
+    size_t pos = 0;
+    size_t end = 0;
+    size_t count = 0;
+    
+    while (pos < pass->length && count < pass->capacity) {
+        if (pos >= end) end = match_limit(pass->parser, pass->input, pos, pass->length);
+        size_t start = pos;
+        ParseNode* node = parse_top_down(pass->parser, pass->input, &pos, end);
+        if (node && pos > start) {
+            /* Only compared against the bottom-up stream, so never copied */
+            TokenMemory* token = &pass->tokens[count];
+            token->token_type = node->type;
+            token->token_value = (uint32_t)(pos - start);
+            token->lexeme_start = start;
+            token->lexeme_end = pos;
+            token->memory_value = (void*)node->value;
+            atomic_store_explicit(&pass->published, ++count, memory_order_release);
+        } else {
+            /* Unmatched, or an empty match that would not advance */
+            pos = start + 1;
+        }
+    }
+    
+    atomic_store_explicit(&pass->done, true, memory_order_release);
+}
+
+static bool claim_top_down_pass(TopDownPass* pass) {
+    return !atomic_exchange(&pass->claimed, true);
+}
+
+static void top_down_pass_task(void* arg) {
+    TopDownPass* pass = (TopDownPass*)arg;
+    if (claim_top_down_pass(pass)) run_top_down_pass(pass);
+}
+
+/* Set the consensus bit of each bottom-up token the top-down pass
+ * produced identically. Both streams are ordered by lexeme_start, so
+ * one cursor walks the top-down tokens; it only waits when it has
+ * caught up with what is published. */
+static size_t merge_consensus(TopDownPass* td, const TokenMemory* bu, size_t bu_count,
+                              uint64_t* consensus) {
+    size_t cursor = 0;
+    size_t agreed = 0;
+    
+    if (consensus) memset(consensus, 0, YODA_BITMAP_WORDS(bu_count) * sizeof(uint64_t));
+    
+    for (size_t i = 0; i < bu_count; i++) {
+        for (;;) {
+            size_t published = atomic_load_explicit(&td->published, memory_order_acquire);
+            if (cursor < published) {
+                if (td->tokens[cursor].lexeme_start >= bu[i].lexeme_start) break;
+                cursor++;
+                continue;
+            }
+            if (atomic_load_explicit(&td->done, memory_order_acquire) &&
+                cursor >= atomic_load_explicit(&td->published, memory_order_acquire)) {
+                return agreed;
+            }
+            sched_yield();
+        }
+        
+        const TokenMemory* t = &td->tokens[cursor];
+        if (t->lexeme_start == bu[i].lexeme_start &&
+            t->lexeme_end == bu[i].lexeme_end &&
+            t->token_type == bu[i].token_type) {
+            if (consensus) consensus[i / 64] |= (uint64_t)1 << (i % 64);
+            agreed++;
+        }
+    }
+    
+    return agreed;
 }
 
 /* =================================================================
@@ -300,6 +462,23 @@ static bool parse_bottom_up(DualModeParser* parser,
  * =================================================================
  */
 
+/* Per-parse state reset; caller holds context_mutex */
+static void begin_parse_locked(DualModeParser* parser, size_t length) {
+    /* Nodes of the previous parse are dead */
+    parse_arena_reset(parser->td_state.arena);
+    
+    /* Patterns added since the memo was sized need their own columns */
+    if (parser->td_state.packrat_window) {
+        PackratMemo* memo = parser->td_state.memo;
+        if (!memo || memo->rule_count != parser->pattern_count) {
+            packrat_memo_destroy(memo);
+            parser->td_state.memo = packrat_memo_create(parser->pattern_count,
+                                                        parser->td_state.packrat_window);
+        }
+        packrat_memo_begin(parser->td_state.memo, length);
+    }
+}
+
 int rift_tb_parse_input(DualModeParser* parser,
                        const char* input,
                        size_t length,
@@ -308,6 +487,7 @@ int rift_tb_parse_input(DualModeParser* parser,
     if (!parser || !input || !output_tokens || !token_count) return -1;
     
     pthread_mutex_lock(&parser->context_mutex);
+    begin_parse_locked(parser, length);
     
     /* Allocate output buffer */
     *output_tokens = calloc(parser->bu_state.memory_size, sizeof(TokenMemory));
@@ -318,89 +498,83 @@ int rift_tb_parse_input(DualModeParser* parser,
     
     /* Determine parsing strategy based on mode */
     if (parser->current_mode == PARSE_MODE_DUAL && parser->dual_mode_enabled) {
-        /* Create thread contexts */
-        ThreadContext contexts[THREAD_PAIR_COUNT];
-        
-        /* Thread 0: Top-down parser */
-        contexts[0].eliminator = parser->parity_elim;
-        contexts[0].mode = PARSE_MODE_TOP_DOWN;
-        contexts[0].stack_trace = parser->td_state.parse_stack;
-        contexts[0].heap_queue = pq_create(1024);
-        contexts[0].thread_index = 0;
-        
-        /* Thread 1: Bottom-up parser */
-        contexts[1].eliminator = parser->parity_elim;
-        contexts[1].mode = PARSE_MODE_BOTTOM_UP;
-        contexts[1].stack_trace = NULL;
-        contexts[1].heap_queue = NULL;
-        contexts[1].thread_index = 1;
-        
-        /* Launch threads with tbtbbt pattern */
-        for (int i = 0; i < THREAD_PAIR_COUNT; i++) {
-            pthread_create(&parser->parity_elim->threads[i], NULL,
-                          thread_execute_pattern, &contexts[i]);
+        /* Top-down on the parser's worker, bottom-up on this thread; the
+         * input is only read, and each pass writes its own token buffer */
+        if (!parser->td_state.token_scratch) {
+            parser->td_state.token_scratch = malloc(parser->bu_state.memory_size *
+                                                    sizeof(TokenMemory));
         }
+        TopDownPass td = {
+            .parser = parser,
+            .input = input,
+            .length = length,
+            .tokens = parser->td_state.token_scratch,
+            .capacity = parser->bu_state.memory_size,
+        };
+        atomic_init(&td.published, 0);
+        atomic_init(&td.claimed, false);
+        atomic_init(&td.done, false);
         
-        /* Parse with both modes concurrently */
-        size_t td_pos = 0;
-        ParseNode* td_result = parse_top_down(parser, input, &td_pos, length);
+        RiftTaskGroup group;
+        rift_task_group_init(&group);
+        if (td.tokens && parser->workers) {
+            rift_workpool_submit(parser->workers, &group, top_down_pass_task, &td);
+        }
         
         size_t bu_count = 0;
         parse_bottom_up(parser, input, length, *output_tokens, &bu_count);
         
-        /* Wait for thread completion */
-        for (int i = 0; i < THREAD_PAIR_COUNT; i++) {
-            pthread_join(parser->parity_elim->threads[i], NULL);
+        if (td.tokens) {
+            /* Not picked up yet (or no worker): run it here */
+            if (claim_top_down_pass(&td)) run_top_down_pass(&td);
+            merge_consensus(&td, *output_tokens, bu_count, parser->consensus);
+            rift_workpool_wait(parser->workers, &group);
+        } else if (parser->consensus) {
+            memset(parser->consensus, 0, YODA_BITMAP_WORDS(bu_count) * sizeof(uint64_t));
         }
+        rift_task_group_destroy(&group);
+        
+        /* Kept for rift_tb_reparse */
+        parser->td_state.token_count = atomic_load(&td.published);
         
         /* Merge results with YODA evaluation */
-        for (size_t i = 0; i < bu_count; i++) {
-            YodaEvalResult eval = rift_tb_yoda_evaluate(parser, 
-                                                       &(*output_tokens)[i],
-                                                       &parser->yoda_config);
-            
-            /* Apply evaluation result to token */
-            if (eval == YODA_EVAL_INVARIANT) {
-                (*output_tokens)[i].token_type |= 0x80000000;  /* Mark as invariant */
-            }
-        }
+        rift_tb_yoda_evaluate_batch(parser, *output_tokens, bu_count, &parser->yoda_config,
+                                    parser->yoda_invariant, parser->yoda_true);
         
         *token_count = bu_count;
         
         /* Update parity elimination stats */
         atomic_fetch_add(&parser->stats.parity_eliminations, 1);
         
-        /* Cleanup */
-        if (td_result) {
-            free(td_result->value);
-            free(td_result);
-        }
-        
     } else if (parser->current_mode == PARSE_MODE_TOP_DOWN) {
         /* Top-down only */
         size_t pos = 0;
+        size_t end = 0;
         size_t count = 0;
         
         while (pos < length && count < parser->bu_state.memory_size) {
-            ParseNode* node = parse_top_down(parser, input, &pos, length);
+            if (pos >= end) end = match_limit(parser, input, pos, length);
+            ParseNode* node = parse_top_down(parser, input, &pos, end);
             if (node) {
                 (*output_tokens)[count].token_type = node->type;
-                (*output_tokens)[count].token_value = (uint32_t)(uintptr_t)node->value;
-                (*output_tokens)[count].lexeme_start = pos - strlen((char*)node->value);
-                (*output_tokens)[count].lexeme_end = pos;
-                (*output_tokens)[count].memory_value = node->value;
+                (*output_tokens)[count].token_value = (uint32_t)(node->end - node->start);
+                (*output_tokens)[count].lexeme_start = node->start;
+                (*output_tokens)[count].lexeme_end = node->end;
+                (*output_tokens)[count].memory_value = token_lexeme(parser, input,
+                                                                    node->start, node->end);
                 count++;
-                free(node);
             } else {
                 pos++;  /* Skip unmatched */
             }
         }
         
         *token_count = count;
+        parser->td_state.token_count = 0;
         
     } else if (parser->current_mode == PARSE_MODE_BOTTOM_UP) {
         /* Bottom-up only */
         parse_bottom_up(parser, input, length, *output_tokens, token_count);
+        parser->td_state.token_count = 0;
     }
     
     pthread_mutex_unlock(&parser->context_mutex);
@@ -408,68 +582,1042 @@ int rift_tb_parse_input(DualModeParser* parser,
 }
 
 /* =================================================================
- * PARITY ELIMINATION IMPLEMENTATION
+ * INCREMENTAL REPARSE
  * =================================================================
  */
 
-void rift_tb_release_parity(ParityEliminator* elim, size_t thread_index) {
-    if (!elim || thread_index >= THREAD_PAIR_COUNT) return;
+/* One tokenizer step of a pass: the length of the token at pos, which
+ * ends by end (-1 if nothing matches there), and its pattern index */
+typedef long (*LexStepFn)(DualModeParser* parser,
+                          const char* input,
+                          size_t pos,
+                          size_t end,
+                          uint32_t* type);
+
+static long top_down_step(DualModeParser* parser,
+                          const char* input,
+                          size_t pos,
+                          size_t end,
+                          uint32_t* type) {
+    size_t next = pos;
+    ParseNode* node = parse_top_down(parser, input, &next, end);
+    if (!node) return -1;
+    *type = node->type;
+    return (long)(next - pos);
+}
+
+/* How a stream was tokenized, so re-lexing reproduces it exactly */
+typedef struct {
+    LexStepFn step;
+    bool keep_empty;            /* An empty match is a token, not a skip */
+    bool copy_lexemes;          /* Tokens own their lexemes */
+} LexStream;
+
+/* Old tokens that the tokenizer may fall back into step with. The
+ * stream from an offset depends only on the input from there, so once
+ * the tokenizer reaches the shifted start of an old token past the
+ * edit, the rest of the old stream is the rest of the new one. */
+typedef struct {
+    const TokenMemory* tokens;
+    size_t index;
+    size_t count;
+    const RiftTbEdit* edit;
+    bool synced;
+} LexResync;
+
+static size_t shifted(const RiftTbEdit* edit, size_t offset) {
+    return offset - edit->old_end + edit->new_end;
+}
+
+/* First token in [lo, hi) whose end (or start) is at or after offset;
+ * streams are ordered, so both are nondecreasing */
+static size_t token_lower_bound(const TokenMemory* tokens, size_t lo, size_t hi,
+                                size_t offset, bool by_end) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t at = by_end ? tokens[mid].lexeme_end : tokens[mid].lexeme_start;
+        if (at < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Tokenize from *pos until the input ends, room runs out or the
+ * position lines up with the old stream */
+static size_t lex_tokens(DualModeParser* parser,
+                         const LexStream* stream,
+                         const char* input,
+                         size_t length,
+                         size_t* pos,
+                         TokenMemory* out,
+                         size_t room,
+                         LexResync* resync) {
+    size_t count = 0;
+    size_t end = 0;
     
-    /* Flip parity bit for this thread */
-    uint32_t thread_bit = 1 << thread_index;
-    atomic_fetch_xor(&elim->parity_state, thread_bit);
+    while (*pos < length && count < room) {
+        if (resync && *pos >= resync->edit->new_end) {
+            while (resync->index < resync->count &&
+                   shifted(resync->edit, resync->tokens[resync->index].lexeme_start) < *pos) {
+                resync->index++;
+            }
+            if (resync->index < resync->count &&
+                shifted(resync->edit, resync->tokens[resync->index].lexeme_start) == *pos) {
+                resync->synced = true;
+                break;
+            }
+        }
+        
+        if (*pos >= end) end = match_limit(parser, input, *pos, length);
+        uint32_t type = 0;
+        long matched = stream->step(parser, input, *pos, end, &type);
+        if (matched > 0 || (matched == 0 && stream->keep_empty)) {
+            TokenMemory* token = &out[count++];
+            token->token_type = type;
+            token->token_value = (uint32_t)matched;
+            token->lexeme_start = *pos;
+            token->lexeme_end = *pos + (size_t)matched;
+            token->memory_value = stream->copy_lexemes
+                ? strndup(input + *pos, (size_t)matched)
+                : (void*)(input + *pos);
+            *pos = token->lexeme_end;
+        } else {
+            (*pos)++;
+        }
+    }
+    return count;
+}
+
+/* Bring one stream up to date with an edit, in place */
+static void relex_stream(DualModeParser* parser,
+                         const LexStream* stream,
+                         const char* input,
+                         size_t length,
+                         const RiftTbEdit* edit,
+                         TokenMemory* tokens,
+                         size_t* count,
+                         size_t capacity) {
+    size_t old_count = *count;
+    TokenMemory* window = parser->bu_state.relex_scratch;
+    
+    /* A match can look ahead as far as its match_limit, which bounds
+     * nothing without line matching, so only the lines before the edited
+     * one can keep their tokens; otherwise lexing restarts at 0 and only
+     * the stream after the edit is reused */
+    size_t pos = parser->line_matching ? line_start(input, edit->start) : 0;
+    size_t keep = token_lower_bound(tokens, 0, old_count, pos, false);
+    
+    LexResync resync = {
+        .tokens = tokens,
+        .index = token_lower_bound(tokens, keep, old_count, edit->old_end, false),
+        .count = old_count,
+        .edit = edit,
+    };
+    size_t fresh = lex_tokens(parser, stream, input, length, &pos,
+                              window, capacity - keep, &resync);
+    
+    size_t suffix = 0;
+    if (resync.synced) {
+        suffix = old_count - resync.index;
+        if (suffix > capacity - keep - fresh) suffix = capacity - keep - fresh;
+    }
+    
+    /* Replaced tokens, and old ones pushed off the end, give up their copies */
+    if (stream->copy_lexemes) {
+        for (size_t i = keep; i < old_count; i++) {
+            if (resync.synced && i >= resync.index && i < resync.index + suffix) continue;
+            free(tokens[i].memory_value);
+        }
+    }
+    
+    memmove(tokens + keep + fresh, tokens + resync.index, suffix * sizeof(TokenMemory));
+    memcpy(tokens + keep, window, fresh * sizeof(TokenMemory));
+    for (size_t i = keep + fresh; i < keep + fresh + suffix; i++) {
+        tokens[i].lexeme_start = shifted(edit, tokens[i].lexeme_start);
+        tokens[i].lexeme_end = shifted(edit, tokens[i].lexeme_end);
+    }
+    
+    /* Spans follow the lexemes into the new input */
+    if (!stream->copy_lexemes) {
+        for (size_t i = 0; i < keep; i++) {
+            tokens[i].memory_value = (void*)(input + tokens[i].lexeme_start);
+        }
+        for (size_t i = keep + fresh; i < keep + fresh + suffix; i++) {
+            tokens[i].memory_value = (void*)(input + tokens[i].lexeme_start);
+        }
+    }
+    
+    size_t total = keep + fresh + suffix;
+    atomic_fetch_add(&parser->stats.reused_tokens, keep + suffix);
+    
+    /* A stream that filled the buffer was cut short, so the tokens the
+     * edit made room for still have to be read */
+    if (resync.synced && old_count == capacity && total < capacity) {
+        pos = tokens[total - 1].lexeme_end;
+        total += lex_tokens(parser, stream, input, length, &pos,
+                            tokens + total, capacity - total, NULL);
+    }
+    
+    *count = total;
+}
+
+int rift_tb_reparse(DualModeParser* parser,
+                    const char* input,
+                    size_t length,
+                    const RiftTbEdit* edit,
+                    TokenMemory* tokens,
+                    size_t* token_count) {
+    if (!parser || !input || !edit || !tokens || !token_count) return -1;
+    if (edit->start > edit->old_end || edit->start > edit->new_end || edit->new_end > length) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&parser->context_mutex);
+    
+    size_t capacity = parser->bu_state.memory_size;
+    if (*token_count > capacity) {
+        pthread_mutex_unlock(&parser->context_mutex);
+        return -1;
+    }
+    if (!parser->bu_state.relex_scratch) {
+        parser->bu_state.relex_scratch = malloc(capacity * sizeof(TokenMemory));
+    }
+    if (!parser->bu_state.relex_scratch) {
+        pthread_mutex_unlock(&parser->context_mutex);
+        return -1;
+    }
+    
+    begin_parse_locked(parser, length);
+    
+    if (parser->current_mode == PARSE_MODE_DUAL && parser->dual_mode_enabled) {
+        /* Both streams are brought up to date on this thread; the
+         * re-lexed stretches are short, so no worker is involved */
+        if (!parser->td_state.token_scratch) {
+            parser->td_state.token_scratch = malloc(capacity * sizeof(TokenMemory));
+            parser->td_state.token_count = 0;
+        }
+        
+        LexStream bu = { bottom_up_step, true, parser->copy_lexemes };
+        relex_stream(parser, &bu, input, length, edit, tokens, token_count, capacity);
+        
+        /* Token indices may have moved, so the bitmaps are redone whole;
+         * the consensus merge only compares spans, it matches nothing */
+        if (parser->td_state.token_scratch) {
+            LexStream td = { top_down_step, false, false };
+            relex_stream(parser, &td, input, length, edit,
+                         parser->td_state.token_scratch, &parser->td_state.token_count,
+                         capacity);
+            
+            TopDownPass td_pass = {
+                .parser = parser,
+                .input = input,
+                .length = length,
+                .tokens = parser->td_state.token_scratch,
+                .capacity = capacity,
+            };
+            atomic_init(&td_pass.published, parser->td_state.token_count);
+            atomic_init(&td_pass.claimed, true);
+            atomic_init(&td_pass.done, true);
+            merge_consensus(&td_pass, tokens, *token_count, parser->consensus);
+        } else if (parser->consensus) {
+            memset(parser->consensus, 0, YODA_BITMAP_WORDS(*token_count) * sizeof(uint64_t));
+        }
+        rift_tb_yoda_evaluate_batch(parser, tokens, *token_count, &parser->yoda_config,
+                                    parser->yoda_invariant, parser->yoda_true);
+        
+        atomic_fetch_add(&parser->stats.parity_eliminations, 1);
+        
+    } else if (parser->current_mode == PARSE_MODE_TOP_DOWN) {
+        LexStream td = { top_down_step, true, parser->copy_lexemes };
+        relex_stream(parser, &td, input, length, edit, tokens, token_count, capacity);
+        
+    } else if (parser->current_mode == PARSE_MODE_BOTTOM_UP) {
+        LexStream bu = { bottom_up_step, true, parser->copy_lexemes };
+        relex_stream(parser, &bu, input, length, edit, tokens, token_count, capacity);
+    }
     
-    /* Release semaphore */
-    sem_post(elim->parity_sem);
+    /* The grammar pass is table-driven and reads only token types */
+    if (parser->bu_state.grammar && parser->current_mode != PARSE_MODE_TOP_DOWN) {
+        run_grammar(parser, tokens, *token_count);
+    }
+    
+    pthread_mutex_unlock(&parser->context_mutex);
+    return 0;
 }
 
 /* =================================================================
- * INVARIANT LOGIC SLICING
+ * BLOCK-PARALLEL PARSING
  * =================================================================
  */
 
-bool rift_tb_invariant_slice(DualModeParser* parser,
-                            size_t start_token,
-                            size_t end_token,
-                            void** slice_result) {
-    if (!parser || !slice_result || start_token >= end_token) return false;
+/* Consecutive blocks are grouped into tasks of about this many bytes */
+#define BLOCK_TASK_BYTES    (16 * 1024)
+
+static void free_block_regexes(DualModeParser* parser) {
+    regex_t* regexes = parser->block_state.regexes;
+    if (!regexes) return;
+    
+    size_t stride = parser->block_state.pattern_count;
+    for (size_t set = 0; set < parser->block_state.set_count; set++) {
+        for (size_t i = 0; i < stride; i++) {
+            if (parser->patterns[i]->parse_mode & PARSE_MODE_BOTTOM_UP) {
+                regfree(&regexes[set * stride + i]);
+            }
+        }
+    }
+    free(regexes);
+    parser->block_state.regexes = NULL;
+    parser->block_state.set_count = 0;
+    parser->block_state.pattern_count = 0;
+}
+
+/* A regex_t runs one match at a time, so every thread that may run a
+ * block task gets its own compiled bottom-up patterns: one set per pool
+ * worker and one for the caller. Caller holds context_mutex. */
+static bool prepare_block_regexes(DualModeParser* parser, RiftWorkPool* pool) {
+    size_t sets = (pool ? rift_workpool_worker_count(pool) : 0) + 1;
+    if (parser->block_state.regexes &&
+        parser->block_state.set_count == sets &&
+        parser->block_state.pattern_count == parser->pattern_count) {
+        return true;
+    }
+    free_block_regexes(parser);
+    
+    size_t stride = parser->pattern_count;
+    regex_t* regexes = calloc(sets * stride + 1, sizeof(regex_t));
+    if (!regexes) return false;
+    parser->block_state.regexes = regexes;
+    parser->block_state.pattern_count = stride;
+    
+    /* set_count only counts whole sets, so a failure releases those */
+    for (size_t set = 0; set < sets; set++) {
+        for (size_t i = 0; i < stride; i++) {
+            RiftRegexPattern* pattern = parser->patterns[i];
+            if (!(pattern->parse_mode & PARSE_MODE_BOTTOM_UP)) continue;
+            if (regcomp(&regexes[set * stride + i], pattern->pattern_str, (int)pattern->flags) != 0) {
+                for (size_t j = 0; j < i; j++) {
+                    if (parser->patterns[j]->parse_mode & PARSE_MODE_BOTTOM_UP) {
+                        regfree(&regexes[set * stride + j]);
+                    }
+                }
+                free_block_regexes(parser);
+                return false;
+            }
+        }
+        parser->block_state.set_count = set + 1;
+    }
+    return true;
+}
+
+typedef struct {
+    DualModeParser* parser;
+    RiftWorkPool* pool;
+    const char* input;
+    const RiftGrammar* grammar;     /* NULL to tokenize only */
+    const RiftBlockSpan* blocks;
+    size_t block_count;
+    
+    TokenMemory* tokens;            /* This task's blocks, in order */
+    size_t token_count;
+    size_t token_capacity;
+    FlatTree* forest;               /* Block trees, task-relative tokens */
+    bool accepted;
+    size_t error_token;             /* Task-relative, when not accepted */
+    bool failed;                    /* Out of memory */
+} BlockTask;
+
+static bool lex_block(BlockTask* task, const regex_t* regexes, const RiftBlockSpan* block) {
+    DualModeParser* parser = task->parser;
+    size_t stride = parser->block_state.pattern_count;
+    size_t pos = block->start;
+    size_t end = block->start;
+    
+    while (pos < block->end) {
+        /* Matches stop at the block end */
+        if (pos >= end) end = match_limit(parser, task->input, pos, block->end);
+        long matched = -1;
+        uint32_t type = 0;
+        for (size_t i = 0; i < stride && matched < 0; i++) {
+            if (!(parser->patterns[i]->parse_mode & PARSE_MODE_BOTTOM_UP)) continue;
+            matched = bounded_match(&regexes[i], task->input, pos, end);
+            type = (uint32_t)i;
+        }
+        if (matched <= 0) {
+            pos++;
+            continue;
+        }
+        
+        if (task->token_count == task->token_capacity) {
+            size_t capacity = task->token_capacity ? task->token_capacity * 2 : 256;
+            TokenMemory* tokens = realloc(task->tokens, capacity * sizeof(TokenMemory));
+            if (!tokens) return false;
+            task->tokens = tokens;
+            task->token_capacity = capacity;
+        }
+        TokenMemory* token = &task->tokens[task->token_count++];
+        token->token_type = type;
+        token->token_value = (uint32_t)matched;
+        token->lexeme_start = pos;
+        token->lexeme_end = pos + (size_t)matched;
+        token->memory_value = token_lexeme(parser, task->input, pos, token->lexeme_end);
+        pos = token->lexeme_end;
+    }
+    return true;
+}
+
+static void block_task_run(void* arg) {
+    BlockTask* task = (BlockTask*)arg;
+    DualModeParser* parser = task->parser;
+    
+    int worker = task->pool ? rift_workpool_current_worker(task->pool) : -1;
+    size_t set = worker >= 0 ? (size_t)worker : parser->block_state.set_count - 1;
+    const regex_t* regexes = parser->block_state.regexes + set * parser->block_state.pattern_count;
+    
+    FlatTree* block_tree = NULL;
+    uint32_t* types = NULL;
+    size_t type_capacity = 0;
+    task->accepted = true;
+    
+    for (size_t b = 0; b < task->block_count; b++) {
+        size_t first = task->token_count;
+        if (!lex_block(task, regexes, &task->blocks[b])) {
+            task->failed = true;
+            break;
+        }
+        size_t count = task->token_count - first;
+        if (!task->grammar || count == 0) continue;
+        
+        if (count > type_capacity) {
+            uint32_t* grown = realloc(types, count * sizeof(uint32_t));
+            if (!grown) {
+                task->failed = true;
+                break;
+            }
+            types = grown;
+            type_capacity = count;
+        }
+        for (size_t i = 0; i < count; i++) {
+            types[i] = task->tokens[first + i].token_type;
+        }
+        
+        if (!block_tree) block_tree = flat_tree_create(0);
+        if (!task->forest) task->forest = flat_tree_create(0);
+        if (!block_tree || !task->forest) {
+            task->failed = true;
+            break;
+        }
+        
+        /* Blocks are separate sentences; a rejected one leaves no tree */
+        size_t error = 0;
+        if (rift_grammar_parse_tree(task->grammar, types, count, NULL, NULL,
+                                    block_tree, &error) == 0) {
+            if (!flat_tree_splice(task->forest, block_tree, (uint32_t)first)) {
+                task->failed = true;
+                break;
+            }
+        } else if (task->accepted) {
+            task->accepted = false;
+            task->error_token = first + error;
+        }
+    }
+    
+    atomic_fetch_add(&parser->stats.bottom_up_ops, task->token_count);
+    flat_tree_destroy(block_tree);
+    free(types);
+}
+
+static void block_task_release(DualModeParser* parser, BlockTask* task, bool owns_lexemes) {
+    if (owns_lexemes && parser->copy_lexemes) {
+        for (size_t i = 0; i < task->token_count; i++) free(task->tokens[i].memory_value);
+    }
+    free(task->tokens);
+    flat_tree_destroy(task->forest);
+}
+
+int rift_tb_parse_blocks(DualModeParser* parser,
+                        RiftWorkPool* pool,
+                        const char* input,
+                        size_t length,
+                        TokenMemory** output_tokens,
+                        size_t* token_count) {
+    if (!parser || !input || !output_tokens || !token_count) return -1;
     
     pthread_mutex_lock(&parser->context_mutex);
     
-    /* Calculate slice size */
-    size_t slice_size = end_token - start_token;
+    parser->bu_state.accepted = false;
+    parser->bu_state.error_token = 0;
+    parser->td_state.token_count = 0;
+    
+    /* Tables are built before any task reads them */
+    RiftGrammar* grammar = parser->bu_state.grammar;
+    if (grammar && !rift_grammar_is_built(grammar) && rift_grammar_build(grammar) != 0) {
+        grammar = NULL;
+    }
+    if (grammar && !parser->bu_state.tree) parser->bu_state.tree = flat_tree_create(0);
+    if (!parser->bu_state.tree) grammar = NULL;
     
-    /* Allocate slice result */
-    TokenMemory* slice = calloc(slice_size, sizeof(TokenMemory));
-    if (!slice) {
+    RiftBlockList* blocks = &parser->block_state.blocks;
+    if (rift_block_prescan(input, length, blocks) != 0 || !prepare_block_regexes(parser, pool)) {
         pthread_mutex_unlock(&parser->context_mutex);
-        return false;
+        return -1;
+    }
+    
+    BlockTask* tasks = calloc(blocks->count + 1, sizeof(BlockTask));
+    if (!tasks) {
+        pthread_mutex_unlock(&parser->context_mutex);
+        return -1;
+    }
+    
+    size_t task_count = 0;
+    for (size_t b = 0; b < blocks->count;) {
+        size_t first = b;
+        size_t bytes = 0;
+        while (b < blocks->count && bytes < BLOCK_TASK_BYTES) {
+            bytes += blocks->spans[b].end - blocks->spans[b].start;
+            b++;
+        }
+        tasks[task_count++] = (BlockTask){
+            .parser = parser,
+            .pool = pool,
+            .input = input,
+            .grammar = grammar,
+            .blocks = blocks->spans + first,
+            .block_count = b - first,
+        };
     }
     
-    /* Apply invariant logic - slice problem in half */
-    size_t mid_point = start_token + (slice_size / 2);
+    /* A task that cannot be queued runs here, on the caller's own set */
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+    for (size_t t = 0; t < task_count; t++) {
+        if (!pool || rift_workpool_submit(pool, &group, block_task_run, &tasks[t]) != 0) {
+            tasks[t].pool = NULL;
+            block_task_run(&tasks[t]);
+        }
+    }
+    if (pool) rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+    
+    /* Stitch: tokens in block order, block trees side by side */
+    size_t total = 0;
+    bool failed = false;
+    for (size_t t = 0; t < task_count; t++) {
+        total += tasks[t].token_count;
+        failed |= tasks[t].failed;
+    }
     
-    /* Copy tokens with invariant analysis */
-    for (size_t i = 0; i < slice_size; i++) {
-        size_t src_idx = start_token + i;
-        if (src_idx < parser->bu_state.memory_size) {
-            slice[i] = parser->bu_state.token_memory[src_idx];
+    size_t capacity = total > parser->bu_state.memory_size ? total : parser->bu_state.memory_size;
+    TokenMemory* output = failed ? NULL : calloc(capacity, sizeof(TokenMemory));
+    if (output) {
+        bool accepted = grammar != NULL && total > 0;
+        if (grammar) flat_tree_clear(parser->bu_state.tree);
+        
+        size_t base = 0;
+        for (size_t t = 0; t < task_count; t++) {
+            BlockTask* task = &tasks[t];
+            memcpy(output + base, task->tokens, task->token_count * sizeof(TokenMemory));
             
-            /* Apply invariant marking based on position */
-            if (src_idx < mid_point) {
-                slice[i].token_type |= 0x40000000;  /* First half marker */
+            if (accepted && !task->accepted) {
+                accepted = false;
+                parser->bu_state.error_token = base + task->error_token;
+            }
+            if (accepted && task->forest &&
+                !flat_tree_splice(parser->bu_state.tree, task->forest, (uint32_t)base)) {
+                accepted = false;
+                parser->bu_state.error_token = base;
+            }
+            base += task->token_count;
+        }
+        
+        parser->bu_state.accepted = accepted;
+        *output_tokens = output;
+        *token_count = total;
+    }
+    
+    /* Lexeme copies moved to the output, unless there is none */
+    for (size_t t = 0; t < task_count; t++) {
+        block_task_release(parser, &tasks[t], output == NULL);
+    }
+    free(tasks);
+    
+    pthread_mutex_unlock(&parser->context_mutex);
+    return output ? 0 : -1;
+}
+
+/* =================================================================
+ * STREAMING OUTPUT
+ * =================================================================
+ */
+
+#define STREAM_DEFAULT_BATCH 256
+
+/* The top-down pass lexed on demand, one token ahead of the bottom-up
+ * stream at most, as run_top_down_pass would produce it */
+typedef struct {
+    size_t pos;
+    size_t end;                 /* match_limit of pos */
+    TokenMemory token;
+    bool have;
+} TopDownCursor;
+
+/* Advance to the first top-down token starting at or after start;
+ * false once the pass has none left */
+static bool top_down_seek(DualModeParser* parser,
+                          const char* input,
+                          size_t length,
+                          TopDownCursor* cursor,
+                          size_t start) {
+    while (!cursor->have || cursor->token.lexeme_start < start) {
+        cursor->have = false;
+        while (!cursor->have) {
+            if (cursor->pos >= length) return false;
+            
+            size_t from = cursor->pos;
+            if (from >= cursor->end) cursor->end = match_limit(parser, input, from, length);
+            uint32_t type = 0;
+            long matched = top_down_step(parser, input, from, cursor->end, &type);
+            if (matched > 0) {
+                cursor->token = (TokenMemory){ type, (uint32_t)matched, from,
+                                               from + (size_t)matched, NULL };
+                cursor->have = true;
+                cursor->pos = from + (size_t)matched;
             } else {
-                slice[i].token_type |= 0x20000000;  /* Second half marker */
+                /* Unmatched, or an empty match that would not advance */
+                cursor->pos = from + 1;
             }
         }
     }
+    return true;
+}
+
+typedef struct {
+    DualModeParser* parser;
+    RiftTokenSinkFn sink;
+    void* sink_data;
+    TokenMemory* batch;
+    uint64_t* consensus;        /* Per batch; NULL outside dual mode */
+    size_t capacity;
+    size_t pending;
+    size_t delivered;
+    RiftGrammarPush* grammar;   /* NULL without rules */
+} TokenStream;
+
+/* Hand the pending tokens to the sink, then the ones it took to the
+ * grammar, so every reduction covers tokens the sink already has */
+static bool stream_flush(TokenStream* stream) {
+    if (stream->pending == 0) return true;
     
-    *slice_result = slice;
+    DualModeParser* parser = stream->parser;
+    size_t taken = stream->sink(stream->batch, stream->pending, stream->consensus,
+                                stream->sink_data);
+    if (taken > stream->pending) taken = stream->pending;
+    bool more = taken == stream->pending;
+    
+    if (stream->grammar) {
+        for (size_t i = 0; i < taken; i++) {
+            if (rift_grammar_push_token(stream->grammar, stream->batch[i].token_type) != 0) break;
+        }
+    }
+    stream->delivered += taken;
+    stream->pending = 0;
+    if (stream->consensus) {
+        memset(stream->consensus, 0, YODA_BITMAP_WORDS(stream->capacity) * sizeof(uint64_t));
+    }
+    
+    /* Parse nodes only back tokens that are gone; rewind them so the
+     * top-down pass runs in constant memory too */
+    parse_arena_reset(parser->td_state.arena);
+    return more;
+}
+
+int rift_tb_parse_stream(DualModeParser* parser,
+                        const char* input,
+                        size_t length,
+                        RiftTokenSinkFn sink,
+                        void* sink_data,
+                        size_t batch,
+                        size_t* token_count) {
+    if (!parser || !input || !sink || !token_count) return -1;
+    *token_count = 0;
+    
+    pthread_mutex_lock(&parser->context_mutex);
+    begin_parse_locked(parser, length);
+    
+    /* Nothing of this parse is kept for a reparse or a tree */
+    parser->td_state.token_count = 0;
+    parser->bu_state.accepted = false;
+    parser->bu_state.error_token = 0;
+    flat_tree_clear(parser->bu_state.tree);
+    
+    bool top_down = parser->current_mode == PARSE_MODE_TOP_DOWN;
+    bool dual = parser->current_mode == PARSE_MODE_DUAL && parser->dual_mode_enabled;
+    bool bottom_up = parser->current_mode == PARSE_MODE_BOTTOM_UP || dual;
+    
+    TokenStream stream = {
+        .parser = parser,
+        .sink = sink,
+        .sink_data = sink_data,
+        .capacity = batch ? batch : STREAM_DEFAULT_BATCH,
+    };
+    stream.batch = malloc(stream.capacity * sizeof(TokenMemory));
+    if (dual) stream.consensus = calloc(YODA_BITMAP_WORDS(stream.capacity), sizeof(uint64_t));
+    bool ok = stream.batch != NULL && (!dual || stream.consensus != NULL);
+    
+    /* Rules apply to the bottom-up stream, as in rift_tb_parse_input */
+    RiftGrammar* grammar = parser->bu_state.grammar;
+    if (ok && bottom_up && grammar &&
+        (rift_grammar_is_built(grammar) || rift_grammar_build(grammar) == 0)) {
+        stream.grammar = rift_grammar_push_create(grammar, parser->bu_state.on_reduce,
+                                                  parser->bu_state.reduce_data);
+        ok = stream.grammar != NULL;
+    }
     
+    LexStepFn step = top_down ? top_down_step : bottom_up_step;
+    TopDownCursor cursor = { 0 };
+    size_t pos = 0;
+    size_t limit = 0;
+    
+    while (ok && (top_down || bottom_up) && pos < length) {
+        if (pos >= limit) limit = match_limit(parser, input, pos, length);
+        uint32_t type = 0;
+        long matched = step(parser, input, pos, limit, &type);
+        if (matched <= 0) {
+            /* Nothing caps the stream, so an empty match skips a byte */
+            pos++;
+            continue;
+        }
+        
+        size_t end = pos + (size_t)matched;
+        size_t slot = stream.pending++;
+        stream.batch[slot] = (TokenMemory){ type, (uint32_t)matched, pos, end,
+                                            token_lexeme(parser, input, pos, end) };
+        
+        if (dual && top_down_seek(parser, input, length, &cursor, pos) &&
+            cursor.token.lexeme_start == pos &&
+            cursor.token.lexeme_end == end &&
+            cursor.token.token_type == type) {
+            stream.consensus[slot / 64] |= (uint64_t)1 << (slot % 64);
+        }
+        
+        pos = end;
+        if (stream.pending == stream.capacity) ok = stream_flush(&stream);
+    }
+    if (ok) ok = stream_flush(&stream);
+    
+    if (stream.grammar) {
+        if (ok) {
+            parser->bu_state.accepted =
+                rift_grammar_push_finish(stream.grammar, &parser->bu_state.error_token) == 0;
+        } else {
+            parser->bu_state.error_token = stream.delivered;
+        }
+        rift_grammar_push_destroy(stream.grammar);
+    }
+    if (dual) atomic_fetch_add(&parser->stats.parity_eliminations, 1);
+    
+    *token_count = stream.delivered;
+    free(stream.consensus);
+    free(stream.batch);
     pthread_mutex_unlock(&parser->context_mutex);
+    return ok ? 0 : -1;
+}
+
+struct RiftTbRing {
+    pthread_mutex_t lock;
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+    TokenMemory* slots;
+    size_t mask;                /* Capacity - 1; capacity is a power of two */
+    size_t head;                /* Next slot to pop */
+    size_t tail;                /* Next slot to fill */
+    bool closed;
+    bool cancelled;
+    bool owns_lexemes;
+};
+
+RiftTbRing* rift_tb_ring_create(size_t capacity, bool owns_lexemes) {
+    if (capacity == 0 || capacity > (SIZE_MAX >> 1) / sizeof(TokenMemory)) return NULL;
+    
+    size_t slots = 1;
+    while (slots < capacity) slots <<= 1;
+    
+    RiftTbRing* ring = calloc(1, sizeof(RiftTbRing));
+    if (!ring) return NULL;
+    ring->slots = malloc(slots * sizeof(TokenMemory));
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+    ring->mask = slots - 1;
+    ring->owns_lexemes = owns_lexemes;
+    pthread_mutex_init(&ring->lock, NULL);
+    pthread_cond_init(&ring->not_full, NULL);
+    pthread_cond_init(&ring->not_empty, NULL);
+    return ring;
+}
+
+/* Free the lexeme copies of tokens no consumer will see */
+static void ring_drop(const RiftTbRing* ring, const TokenMemory* tokens, size_t count) {
+    if (!ring->owns_lexemes) return;
+    for (size_t i = 0; i < count; i++) free(tokens[i].memory_value);
+}
+
+/* Drop everything still queued; caller holds the lock */
+static void ring_drop_queued(RiftTbRing* ring) {
+    for (; ring->head != ring->tail; ring->head++) {
+        ring_drop(ring, &ring->slots[ring->head & ring->mask], 1);
+    }
+}
+
+void rift_tb_ring_destroy(RiftTbRing* ring) {
+    if (!ring) return;
+    ring_drop_queued(ring);
+    pthread_cond_destroy(&ring->not_empty);
+    pthread_cond_destroy(&ring->not_full);
+    pthread_mutex_destroy(&ring->lock);
+    free(ring->slots);
+    free(ring);
+}
+
+size_t rift_tb_ring_sink(const TokenMemory* tokens, size_t count,
+                         const uint64_t* consensus, void* arg) {
+    (void)consensus;
+    RiftTbRing* ring = (RiftTbRing*)arg;
+    if (!ring) return 0;
+    
+    pthread_mutex_lock(&ring->lock);
+    
+    size_t capacity = ring->mask + 1;
+    size_t done = 0;
+    while (done < count) {
+        while (ring->tail - ring->head == capacity && !ring->closed && !ring->cancelled) {
+            pthread_cond_wait(&ring->not_full, &ring->lock);
+        }
+        if (ring->closed || ring->cancelled) break;
+        
+        /* Copy what fits, in at most two runs around the wrap */
+        size_t room = capacity - (ring->tail - ring->head);
+        size_t n = count - done < room ? count - done : room;
+        size_t at = ring->tail & ring->mask;
+        size_t first = n < capacity - at ? n : capacity - at;
+        memcpy(&ring->slots[at], tokens + done, first * sizeof(TokenMemory));
+        memcpy(ring->slots, tokens + done + first, (n - first) * sizeof(TokenMemory));
+        
+        ring->tail += n;
+        done += n;
+        pthread_cond_signal(&ring->not_empty);
+    }
+    
+    pthread_mutex_unlock(&ring->lock);
+    
+    ring_drop(ring, tokens + done, count - done);
+    return done;
+}
+
+size_t rift_tb_ring_pop(RiftTbRing* ring, TokenMemory* tokens, size_t max) {
+    if (!ring || !tokens || max == 0) return 0;
+    
+    pthread_mutex_lock(&ring->lock);
+    
+    while (ring->head == ring->tail && !ring->closed && !ring->cancelled) {
+        pthread_cond_wait(&ring->not_empty, &ring->lock);
+    }
+    
+    size_t n = 0;
+    if (!ring->cancelled) {
+        size_t queued = ring->tail - ring->head;
+        n = queued < max ? queued : max;
+        size_t at = ring->head & ring->mask;
+        size_t first = n < ring->mask + 1 - at ? n : ring->mask + 1 - at;
+        memcpy(tokens, &ring->slots[at], first * sizeof(TokenMemory));
+        memcpy(tokens + first, ring->slots, (n - first) * sizeof(TokenMemory));
+        ring->head += n;
+        if (n > 0) pthread_cond_signal(&ring->not_full);
+    }
+    
+    pthread_mutex_unlock(&ring->lock);
+    return n;
+}
+
+void rift_tb_ring_close(RiftTbRing* ring) {
+    if (!ring) return;
+    
+    pthread_mutex_lock(&ring->lock);
+    ring->closed = true;
+    pthread_cond_broadcast(&ring->not_empty);
+    pthread_cond_broadcast(&ring->not_full);
+    pthread_mutex_unlock(&ring->lock);
+}
+
+void rift_tb_ring_cancel(RiftTbRing* ring) {
+    if (!ring) return;
+    
+    pthread_mutex_lock(&ring->lock);
+    ring->cancelled = true;
+    ring_drop_queued(ring);
+    pthread_cond_broadcast(&ring->not_empty);
+    pthread_cond_broadcast(&ring->not_full);
+    pthread_mutex_unlock(&ring->lock);
+}
+
+/* =================================================================
+ * BATCH YODA EVALUATION
+ * =================================================================
+ */
+
+/* rift_tb_yoda_evaluate as masks: a token without a lexeme is false
+ * under null/nil semantics, a flagged one invariant, otherwise its
+ * value decides */
+typedef struct {
+    uint32_t require_lexeme;    /* All ones when null_nil_semantics */
+    uint32_t invariant_bit;     /* 0x80000000 when invariant_slicing */
+} YodaMasks;
+
+static YodaMasks yoda_masks(const YodaConfig* cfg) {
+    YodaMasks masks = {
+        .require_lexeme = cfg->null_nil_semantics ? UINT32_MAX : 0,
+        .invariant_bit = cfg->invariant_slicing ? 0x80000000u : 0,
+    };
+    return masks;
+}
+
+/* Bits 0 and 1: invariant and true */
+static inline uint64_t yoda_classify(const YodaMasks* masks,
+                                     uint32_t type,
+                                     uint32_t value,
+                                     bool has_lexeme) {
+    uint32_t live = (uint32_t)has_lexeme | (masks->require_lexeme == 0);
+    uint32_t invariant = live & ((type & masks->invariant_bit) >> 31);
+    uint32_t truth = live & (invariant ^ 1) & (value != 0);
+    return (uint64_t)invariant | ((uint64_t)truth << 1);
+}
+
+/* Store one 64-token word of each bitmap; returns its invariant count */
+static size_t yoda_store_word(size_t base,
+                              uint64_t invariant_word,
+                              uint64_t true_word,
+                              uint64_t* invariant,
+                              uint64_t* truth) {
+    if (invariant) invariant[base / 64] = invariant_word;
+    if (truth) truth[base / 64] = true_word;
+    return (size_t)__builtin_popcountll(invariant_word);
+}
+
+size_t rift_tb_yoda_evaluate_batch(DualModeParser* parser,
+                                  const TokenMemory* tokens,
+                                  size_t count,
+                                  const YodaConfig* config,
+                                  uint64_t* invariant,
+                                  uint64_t* truth) {
+    if (!parser || (!tokens && count > 0)) return 0;
+    
+    YodaMasks masks = yoda_masks(config ? config : &parser->yoda_config);
+    size_t found = 0;
+    
+    /* Words are assembled in registers and stored once per 64 tokens */
+    for (size_t base = 0; base < count; base += 64) {
+        size_t end = count - base < 64 ? count - base : 64;
+        uint64_t invariant_word = 0;
+        uint64_t true_word = 0;
+        for (size_t bit = 0; bit < end; bit++) {
+            const TokenMemory* token = &tokens[base + bit];
+            uint64_t eval = yoda_classify(&masks, token->token_type, token->token_value,
+                                          token->memory_value != NULL);
+            invariant_word |= (eval & 1) << bit;
+            true_word |= (eval >> 1) << bit;
+        }
+        found += yoda_store_word(base, invariant_word, true_word, invariant, truth);
+    }
+    return found;
+}
+
+size_t rift_tb_yoda_evaluate_columns(DualModeParser* parser,
+                                    const uint32_t* types,
+                                    const uint32_t* values,
+                                    const void* const* lexemes,
+                                    size_t count,
+                                    const YodaConfig* config,
+                                    uint64_t* invariant,
+                                    uint64_t* truth) {
+    if (!parser || ((!types || !values) && count > 0)) return 0;
+    
+    YodaMasks masks = yoda_masks(config ? config : &parser->yoda_config);
+    size_t found = 0;
+    
+    for (size_t base = 0; base < count; base += 64) {
+        size_t end = count - base < 64 ? count - base : 64;
+        uint64_t invariant_word = 0;
+        uint64_t true_word = 0;
+        for (size_t bit = 0; bit < end; bit++) {
+            size_t i = base + bit;
+            bool has_lexeme = !lexemes || lexemes[i] != NULL;
+            uint64_t eval = yoda_classify(&masks, types[i], values[i], has_lexeme);
+            invariant_word |= (eval & 1) << bit;
+            true_word |= (eval >> 1) << bit;
+        }
+        found += yoda_store_word(base, invariant_word, true_word, invariant, truth);
+    }
+    return found;
+}
+
+bool rift_tb_yoda_bitmaps(const DualModeParser* parser,
+                         const uint64_t** invariant,
+                         const uint64_t** truth) {
+    if (!parser || !parser->yoda_invariant || !parser->yoda_true) return false;
+    if (invariant) *invariant = parser->yoda_invariant;
+    if (truth) *truth = parser->yoda_true;
+    return true;
+}
+
+bool rift_tb_consensus_bitmap(const DualModeParser* parser, const uint64_t** consensus) {
+    if (!parser || !parser->consensus) return false;
+    if (consensus) *consensus = parser->consensus;
     return true;
 }
 
+/* =================================================================
+ * PARITY ELIMINATION IMPLEMENTATION
+ * =================================================================
+ */
+
+void rift_tb_release_parity(ParityEliminator* elim, size_t thread_index) {
+    if (!elim || thread_index >= THREAD_PAIR_COUNT) return;
+    
+    /* Flip parity bit for this thread */
+    uint32_t thread_bit = 1 << thread_index;
+    atomic_fetch_xor(&elim->parity_state, thread_bit);
+    
+    /* End this thread's parity turn */
+    parity_lock_release(&elim->parity_lock);
+}
+
+/* =================================================================
+ * INVARIANT LOGIC SLICING
+ * =================================================================
+ */
+
+bool rift_tb_invariant_slice(DualModeParser* parser,
+                            const TokenMemory* tokens,
+                            size_t count,
+                            size_t start_token,
+                            size_t end_token,
+                            TokenSliceView* view) {
+    if (!parser || !view) return false;
+    
+    /* The config may change between parses, so read it under the lock */
+    pthread_mutex_lock(&parser->context_mutex);
+    bool slicing = parser->yoda_config.invariant_slicing;
+    pthread_mutex_unlock(&parser->context_mutex);
+    if (!slicing) return false;
+    
+    /* Slice the problem in half: the view's mid splits it, so the
+     * halves come from rift_tb_view_halves rather than type markers */
+    return rift_tb_token_view(tokens, count, start_token, end_token, view);
+}
+
 /* =================================================================
  * CLEANUP FUNCTIONS
  * =================================================================
@@ -480,11 +1628,16 @@ void rift_tb_parser_destroy(DualModeParser* parser) {
     
     pthread_mutex_lock(&parser->context_mutex);
     
+    /* Block regexes are released by pattern, so before the patterns */
+    free_block_regexes(parser);
+    
     /* Clean up patterns */
     for (size_t i = 0; i < parser->pattern_count; i++) {
         if (parser->patterns[i]) {
             regfree(parser->patterns[i]->compiled_regex);
             free(parser->patterns[i]->compiled_regex);
+            regfree(parser->patterns[i]->td_regex);
+            free(parser->patterns[i]->td_regex);
             free(parser->patterns[i]->pattern_str);
             free(parser->patterns[i]);
         }
@@ -493,40 +1646,22 @@ void rift_tb_parser_destroy(DualModeParser* parser) {
     
     /* Clean up parity eliminator */
     if (parser->parity_elim) {
-        sem_close(parser->parity_elim->parity_sem);
-        sem_unlink("/rift_parity");
         free(parser->parity_elim);
     }
     
     /* Clean up parse states */
-    if (parser->td_state.parse_stack) {
-        /* Pop all remaining nodes */
-        ParseStack* stack = (ParseStack*)parser->td_state.parse_stack;
-        while (stack->top) {
-            stack_pop(stack);
-        }
-        pthread_mutex_destroy(&stack->mutex);
-        free(stack);
-    }
-    
-    if (parser->bu_state.reduce_stack) {
-        ParseStack* stack = (ParseStack*)parser->bu_state.reduce_stack;
-        while (stack->top) {
-            stack_pop(stack);
-        }
-        pthread_mutex_destroy(&stack->mutex);
-        free(stack);
-    }
-    
-    /* Free token memory */
-    if (parser->bu_state.token_memory) {
-        for (size_t i = 0; i < parser->bu_state.memory_size; i++) {
-            if (parser->bu_state.token_memory[i].memory_value) {
-                free(parser->bu_state.token_memory[i].memory_value);
-            }
-        }
-        free(parser->bu_state.token_memory);
-    }
+    rift_workpool_destroy(parser->workers);
+    free(parser->td_state.token_scratch);
+    packrat_memo_destroy(parser->td_state.memo);
+    parse_arena_destroy(parser->td_state.arena);
+    rift_grammar_destroy(parser->bu_state.grammar);
+    flat_tree_destroy(parser->bu_state.tree);
+    free(parser->bu_state.type_scratch);
+    free(parser->bu_state.relex_scratch);
+    free(parser->yoda_invariant);
+    rift_block_list_free(&parser->block_state.blocks);
+    free(parser->yoda_true);
+    free(parser->consensus);
     
     pthread_mutex_unlock(&parser->context_mutex);
     pthread_mutex_destroy(&parser->context_mutex);
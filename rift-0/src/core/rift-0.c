@@ -6,6 +6,7 @@
 
 #include "rift-0/core/rift-0.h"
 #include "rift-0/core/lexer/tokenizer.h"
+#include "rift-0/core/lexer/token_cache.h"
 
 /* Version information for DSL */
 static const char* RIFT_VERSION = "0.1.0-dsl";
@@ -14,13 +15,22 @@ static const char* RIFT_VERSION = "0.1.0-dsl";
  * Create RIFT Stage 0 context for DSL processing
  */
 RiftStage0Context* rift_stage0_create(void) {
+    return rift_stage0_create_with_capacity(RIFT_TOKENIZER_DEFAULT_CAPACITY);
+}
+
+/**
+ * Create RIFT Stage 0 context with a pre-sized token buffer
+ */
+RiftStage0Context* rift_stage0_create_with_capacity(size_t token_capacity) {
     RiftStage0Context* ctx = calloc(1, sizeof(RiftStage0Context));
     if (!ctx) {
         return NULL;
     }
     
     /* Initialize tokenizer for DSL parsing */
-    ctx->tokenizer = rift_tokenizer_create();
+    ctx->tokenizer = rift_tokenizer_create_with_capacity(
+        token_capacity ? token_capacity : RIFT_TOKENIZER_DEFAULT_CAPACITY,
+        RIFT_TOKENIZER_MAX_PATTERNS);
     if (!ctx->tokenizer) {
         free(ctx);
         return NULL;
@@ -61,6 +71,28 @@ void rift_stage0_destroy(RiftStage0Context* ctx) {
     free(ctx);
 }
 
+/**
+ * Return a context to its freshly created state, keeping its buffers,
+ * compiled patterns and attached token cache
+ */
+bool rift_stage0_reset(RiftStage0Context* ctx) {
+    if (!ctx) return false;
+    
+    pthread_mutex_lock(&ctx->ctx_lock);
+    
+    bool ok = rift_tokenizer_reset(ctx->tokenizer);
+    
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+    ctx->debug_mode = false;
+    ctx->strict_mode = true;
+    ctx->has_error = false;
+    ctx->error_message[0] = '\0';
+    
+    pthread_mutex_unlock(&ctx->ctx_lock);
+    
+    return ok;
+}
+
 /**
  * Process RIFT build script (DSL input)
  */
@@ -113,6 +145,17 @@ int rift_generate_parser(RiftStage0Context* ctx, const char* output_file) {
     return 0;
 }
 
+/**
+ * Attach an on-disk token cache to the context
+ */
+void rift_stage0_set_token_cache(RiftStage0Context* ctx, RiftTokenCache* cache) {
+    if (!ctx) return;
+    
+    pthread_mutex_lock(&ctx->ctx_lock);
+    ctx->token_cache = cache;
+    pthread_mutex_unlock(&ctx->ctx_lock);
+}
+
 /**
  * Tokenize input for DSL processing
  */
@@ -124,12 +167,32 @@ int rift_tokenize_input(RiftStage0Context* ctx, const char* input,
     
     pthread_mutex_lock(&ctx->ctx_lock);
     
-    /* Use tokenizer to process DSL input */
+    size_t input_length = strlen(input);
     size_t token_count = 0;
+    uint64_t ruleset_hash = 0;
+    
+    /* Unchanged inputs are served straight from the cache mapping */
+    if (ctx->token_cache) {
+        RiftTokenCacheHit hit;
+        ruleset_hash = rift_token_cache_ruleset_hash(ctx->tokenizer);
+        
+        if (rift_token_cache_lookup(ctx->token_cache, input, input_length,
+                                    ruleset_hash, &hit)) {
+            token_count = hit.count < max_tokens ? hit.count : max_tokens;
+            memcpy(tokens, hit.tokens, token_count * sizeof(TokenTriplet));
+            rift_token_cache_release(&hit);
+            
+            ctx->stats.tokens_processed += token_count;
+            pthread_mutex_unlock(&ctx->ctx_lock);
+            return (int)token_count;
+        }
+    }
+    
+    /* Use tokenizer to process DSL input */
     ssize_t result = rift_tokenizer_process_with_flags(
         ctx->tokenizer, 
         input, 
-        strlen(input),
+        input_length,
         TOKEN_FLAG_NONE
     );
     
@@ -140,6 +203,12 @@ int rift_tokenize_input(RiftStage0Context* ctx, const char* input,
             max_tokens
         );
         ctx->stats.tokens_processed += token_count;
+        
+        /* Only complete streams are cached; a truncated one would replay short */
+        if (ctx->token_cache && (size_t)result <= max_tokens) {
+            rift_token_cache_store(ctx->token_cache, input, input_length,
+                                   ruleset_hash, tokens, token_count);
+        }
     }
     
     pthread_mutex_unlock(&ctx->ctx_lock);
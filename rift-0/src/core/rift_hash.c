@@ -0,0 +1,119 @@
+/*
+ * =================================================================
+ * rift_hash.c - RIFT-0 Non-Cryptographic Content Hashing
+ * RIFT: RIFT Is a Flexible Translator
+ * OBINexus Computing Framework - AEGIS Compliant
+ * =================================================================
+ */
+
+#include <string.h>
+
+#include "rift-0/core/rift_hash.h"
+
+#define RIFT_HASH_PRIME1 0x9E3779B185EBCA87ULL
+#define RIFT_HASH_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define RIFT_HASH_PRIME3 0x165667B19E3779F9ULL
+#define RIFT_HASH_PRIME4 0x85EBCA77C2B2AE63ULL
+#define RIFT_HASH_PRIME5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+/* Unaligned little-endian reads; memcpy compiles to a single load */
+static inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+static inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap32(v);
+#endif
+    return v;
+}
+
+static inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    acc += input * RIFT_HASH_PRIME2;
+    acc = rotl64(acc, 31);
+    return acc * RIFT_HASH_PRIME1;
+}
+
+static inline uint64_t hash_merge(uint64_t acc, uint64_t val) {
+    acc ^= hash_round(0, val);
+    return acc * RIFT_HASH_PRIME1 + RIFT_HASH_PRIME4;
+}
+
+static inline uint64_t hash_avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= RIFT_HASH_PRIME2;
+    h ^= h >> 29;
+    h *= RIFT_HASH_PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t rift_hash64(const void* data, size_t length, uint64_t seed) {
+    static const uint8_t empty[1] = {0};
+    const uint8_t* p = data ? (const uint8_t*)data : empty;
+    const uint8_t* end;
+    uint64_t h;
+
+    if (!data) length = 0;
+    end = p + length;
+
+    if (length >= 32) {
+        const uint8_t* limit = end - 32;
+        uint64_t v1 = seed + RIFT_HASH_PRIME1 + RIFT_HASH_PRIME2;
+        uint64_t v2 = seed + RIFT_HASH_PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - RIFT_HASH_PRIME1;
+
+        do {
+            v1 = hash_round(v1, read64(p));      p += 8;
+            v2 = hash_round(v2, read64(p));      p += 8;
+            v3 = hash_round(v3, read64(p));      p += 8;
+            v4 = hash_round(v4, read64(p));      p += 8;
+        } while (p <= limit);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = hash_merge(h, v1);
+        h = hash_merge(h, v2);
+        h = hash_merge(h, v3);
+        h = hash_merge(h, v4);
+    } else {
+        h = seed + RIFT_HASH_PRIME5;
+    }
+
+    h += (uint64_t)length;
+
+    while (p + 8 <= end) {
+        h ^= hash_round(0, read64(p));
+        h = rotl64(h, 27) * RIFT_HASH_PRIME1 + RIFT_HASH_PRIME4;
+        p += 8;
+    }
+
+    if (p + 4 <= end) {
+        h ^= (uint64_t)read32(p) * RIFT_HASH_PRIME1;
+        h = rotl64(h, 23) * RIFT_HASH_PRIME2 + RIFT_HASH_PRIME3;
+        p += 4;
+    }
+
+    while (p < end) {
+        h ^= (*p) * RIFT_HASH_PRIME5;
+        h = rotl64(h, 11) * RIFT_HASH_PRIME1;
+        p++;
+    }
+
+    return hash_avalanche(h);
+}
+
+uint64_t rift_hash64_combine(uint64_t hash, uint64_t value) {
+    return hash_avalanche(hash_merge(hash ^ RIFT_HASH_PRIME5, value));
+}
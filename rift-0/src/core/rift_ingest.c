@@ -0,0 +1,683 @@
+/*
+ * =================================================================
+ * rift_ingest.c - RIFT-0 Bulk File Ingestion
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#ifdef RIFT_HAVE_IO_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif
+
+#include "rift-0/core/rift_ingest.h"
+
+#define INGEST_MAX_DEPTH 4096
+
+/* =================================================================
+ * INGEST STATE
+ * =================================================================
+ */
+
+typedef struct RunState RunState;
+
+typedef struct {
+    RiftIngestBuffer buffer;    /* First, so a released buffer maps back */
+    int slot;                   /* Registered buffer index; -1 for heap-only */
+    char* heap;                 /* Set once the file outgrew its slot */
+    size_t capacity;            /* Usable bytes in the current buffer */
+    int fd;
+    RunState* run;              /* Fallback task state, valid during a run */
+} IngestFile;
+
+#ifdef RIFT_HAVE_IO_URING
+typedef struct {
+    int fd;
+    unsigned entries;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void* sq_map;
+    size_t sq_map_size;
+    void* cq_map;
+    size_t cq_map_size;
+    size_t sqes_size;
+    unsigned to_submit;
+} IngestRing;
+#endif
+
+struct RiftIngest {
+    RiftIngestConfig config;
+
+    /* One record and one buffer per slot, recycled on release */
+    IngestFile* files;
+    char* arena;
+    size_t* free_slots;
+    size_t free_count;
+    pthread_mutex_t lock;
+    pthread_cond_t released;
+
+#ifdef RIFT_HAVE_IO_URING
+    IngestRing ring;
+    bool uring;
+    bool fixed_buffers;
+#endif
+};
+
+struct RunState {
+    RiftIngest* ingest;
+    RiftIngestCallback callback;
+    void* user_data;
+    atomic_bool failed;
+};
+
+static void deliver(RunState* run, IngestFile* file) {
+    if (file->buffer.error != 0) atomic_store(&run->failed, true);
+    run->callback(&file->buffer, run->user_data);
+}
+
+/* =================================================================
+ * THREAD FALLBACK
+ * =================================================================
+ */
+
+static int read_whole_file(const char* path, size_t max_size, char** data, size_t* size) {
+    /* O_NONBLOCK lets a FIFO open without a writer so fstat can reject it */
+    int fd = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) return errno;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        return err;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        close(fd);
+        return EINVAL;
+    }
+    if (max_size && (size_t)st.st_size > max_size) {
+        close(fd);
+        return EFBIG;
+    }
+
+    size_t length = (size_t)st.st_size;
+    char* buffer = malloc(length + 1);
+    if (!buffer) {
+        close(fd);
+        return ENOMEM;
+    }
+
+    size_t got = 0;
+    while (got < length) {
+        ssize_t n = pread(fd, buffer + got, length - got, (off_t)got);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            int err = n < 0 ? errno : EIO;
+            free(buffer);
+            close(fd);
+            return err;
+        }
+        got += (size_t)n;
+    }
+    close(fd);
+
+    buffer[length] = '\0';
+    *data = buffer;
+    *size = length;
+    return 0;
+}
+
+static void fallback_read_task(void* arg) {
+    IngestFile* file = (IngestFile*)arg;
+    RunState* run = file->run;
+
+    file->buffer.error = read_whole_file(file->buffer.path, run->ingest->config.max_file_size,
+                                         &file->heap, &file->buffer.size);
+    file->buffer.data = file->heap;
+    deliver(run, file);
+}
+
+static int run_fallback(RiftIngest* ingest, RunState* run,
+                         const char* const* paths, size_t count) {
+    /* Allocate every record first so a failure delivers nothing */
+    IngestFile** files = calloc(count ? count : 1, sizeof(IngestFile*));
+    if (!files) return -1;
+    for (size_t i = 0; i < count; i++) {
+        files[i] = calloc(1, sizeof(IngestFile));
+        if (!files[i]) {
+            while (i > 0) free(files[--i]);
+            free(files);
+            return -1;
+        }
+        files[i]->buffer.index = i;
+        files[i]->buffer.path = paths[i];
+        files[i]->slot = -1;
+        files[i]->fd = -1;
+        files[i]->run = run;
+    }
+
+    RiftWorkPool* pool = ingest->config.readers;
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+
+    for (size_t i = 0; i < count; i++) {
+        if (!pool || rift_workpool_submit(pool, &group, fallback_read_task, files[i]) != 0) {
+            fallback_read_task(files[i]);
+        }
+    }
+
+    if (pool) rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+    free(files);
+    return 0;
+}
+
+/* =================================================================
+ * IO_URING BACKEND
+ * =================================================================
+ */
+
+#ifdef RIFT_HAVE_IO_URING
+
+enum {
+    INGEST_OP_OPEN = 1,
+    INGEST_OP_READ = 2,
+    INGEST_OP_CLOSE = 3
+};
+
+#define OP_DATA(slot, op) (((uint64_t)(slot) << 2) | (uint64_t)(op))
+
+static int ring_setup(IngestRing* ring, unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) return -1;
+
+    ring->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_map_size > ring->sq_map_size) ring->sq_map_size = ring->cq_map_size;
+        ring->cq_map_size = 0;
+    }
+
+    ring->sq_map = mmap(NULL, ring->sq_map_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_map == MAP_FAILED) goto fail_sq;
+
+    ring->cq_map = ring->sq_map;
+    if (ring->cq_map_size) {
+        ring->cq_map = mmap(NULL, ring->cq_map_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_map == MAP_FAILED) goto fail_cq;
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) goto fail_sqes;
+
+    char* sq = (char*)ring->sq_map;
+    char* cq = (char*)ring->cq_map;
+    ring->entries = params.sq_entries;
+    ring->sq_head = (unsigned*)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    return 0;
+
+fail_sqes:
+    if (ring->cq_map_size) munmap(ring->cq_map, ring->cq_map_size);
+fail_cq:
+    munmap(ring->sq_map, ring->sq_map_size);
+fail_sq:
+    close(ring->fd);
+    ring->fd = -1;
+    return -1;
+}
+
+static void ring_teardown(IngestRing* ring) {
+    if (ring->fd < 0) return;
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_map_size) munmap(ring->cq_map, ring->cq_map_size);
+    munmap(ring->sq_map, ring->sq_map_size);
+    close(ring->fd);
+    ring->fd = -1;
+}
+
+/* Queue one request; the ring is sized so this cannot run out */
+static struct io_uring_sqe* ring_next_sqe(IngestRing* ring) {
+    unsigned tail = *ring->sq_tail;
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[index] = index;
+    return sqe;
+}
+
+static void ring_commit(IngestRing* ring) {
+    __atomic_store_n(ring->sq_tail, *ring->sq_tail + 1, __ATOMIC_RELEASE);
+    ring->to_submit++;
+}
+
+static bool ring_has_completions(const IngestRing* ring) {
+    return *ring->cq_head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+}
+
+/* Submit queued requests and block until a completion exists.
+ * outstanding counts requests queued or in the kernel. */
+static int ring_enter(IngestRing* ring, size_t outstanding) {
+    unsigned submit = ring->to_submit;
+    for (;;) {
+        long ret = syscall(__NR_io_uring_enter, ring->fd, submit, 1u,
+                           IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret >= 0) {
+            ring->to_submit -= (unsigned)ret;
+            return 0;
+        }
+        if (errno == EINTR) continue;
+        if ((errno != EAGAIN && errno != EBUSY) || submit == 0) return -1;
+
+        /* The kernel will not take more yet. Reap what is ready, else
+         * wait on requests it already holds, else back off briefly */
+        if (ring_has_completions(ring)) return 0;
+        if (outstanding > ring->to_submit) {
+            submit = 0;
+        } else {
+            struct timespec pause = { 0, 1000000 };
+            nanosleep(&pause, NULL);
+        }
+    }
+}
+
+static void queue_open(RiftIngest* ingest, IngestFile* file) {
+    struct io_uring_sqe* sqe = ring_next_sqe(&ingest->ring);
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uint64_t)(uintptr_t)file->buffer.path;
+    /* O_NONBLOCK keeps a stray FIFO from parking a kernel worker */
+    sqe->open_flags = O_RDONLY | O_CLOEXEC | O_NONBLOCK;
+    sqe->user_data = OP_DATA(file->slot, INGEST_OP_OPEN);
+    ring_commit(&ingest->ring);
+}
+
+static void queue_read(RiftIngest* ingest, IngestFile* file) {
+    struct io_uring_sqe* sqe = ring_next_sqe(&ingest->ring);
+    bool fixed = ingest->fixed_buffers && !file->heap;
+
+    sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    sqe->fd = file->fd;
+    sqe->addr = (uint64_t)(uintptr_t)(file->buffer.data + file->buffer.size);
+    sqe->len = (unsigned)(file->capacity - file->buffer.size);
+    sqe->off = file->buffer.size;
+    if (fixed) sqe->buf_index = (uint16_t)file->slot;
+    sqe->user_data = OP_DATA(file->slot, INGEST_OP_READ);
+    ring_commit(&ingest->ring);
+}
+
+static void queue_close(RiftIngest* ingest, IngestFile* file) {
+    if (file->fd < 0) return;
+    struct io_uring_sqe* sqe = ring_next_sqe(&ingest->ring);
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->fd = file->fd;
+    sqe->user_data = OP_DATA(file->slot, INGEST_OP_CLOSE);
+    ring_commit(&ingest->ring);
+    file->fd = -1;
+}
+
+static void fail_file(IngestFile* file, int error) {
+    free(file->heap);
+    file->heap = NULL;
+    file->buffer.data = NULL;
+    file->buffer.size = 0;
+    file->buffer.error = error;
+}
+
+/* Move a full slot into a heap buffer twice the size */
+static int grow_file(RiftIngest* ingest, IngestFile* file) {
+    size_t max_size = ingest->config.max_file_size;
+    if (max_size && file->buffer.size > max_size) return EFBIG;
+
+    size_t capacity = file->capacity * 2;
+    /* One byte past the limit is enough to tell an oversized file */
+    if (max_size && capacity > max_size + 1) capacity = max_size + 1;
+
+    char* heap = realloc(file->heap, capacity + 1);
+    if (!heap) return ENOMEM;
+    if (!file->heap) memcpy(heap, file->buffer.data, file->buffer.size);
+
+    file->heap = heap;
+    file->buffer.data = heap;
+    file->capacity = capacity;
+    return 0;
+}
+
+/* Same checks as the fallback's fstat: regular files within the limit */
+static int check_opened(RiftIngest* ingest, int fd) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) return errno;
+    if (!S_ISREG(st.st_mode)) return EINVAL;
+    if (ingest->config.max_file_size && (size_t)st.st_size > ingest->config.max_file_size) {
+        return EFBIG;
+    }
+    return 0;
+}
+
+/* Advance one file by a completion; delivers it once its data is final.
+ * While aborting nothing new is queued and files still open fail. */
+static void handle_completion(RiftIngest* ingest, RunState* run, uint64_t user_data,
+                              int res, bool aborting, size_t* delivered) {
+    IngestFile* file = &ingest->files[user_data >> 2];
+    int op = (int)(user_data & 3);
+
+    switch (op) {
+    case INGEST_OP_OPEN:
+        if (res < 0) {
+            fail_file(file, -res);
+            break;
+        }
+        file->fd = res;
+        int err = aborting ? ECANCELED : check_opened(ingest, res);
+        if (err) {
+            fail_file(file, err);
+            break;
+        }
+        queue_read(ingest, file);
+        return;
+
+    case INGEST_OP_READ:
+        if (res < 0) {
+            fail_file(file, -res);
+            break;
+        }
+        if (res > 0) {
+            file->buffer.size += (size_t)res;
+            if (aborting) {
+                fail_file(file, ECANCELED);
+                break;
+            }
+            if (file->buffer.size == file->capacity) {
+                int err = grow_file(ingest, file);
+                if (err) {
+                    fail_file(file, err);
+                    break;
+                }
+            }
+            queue_read(ingest, file);
+            return;
+        }
+        file->buffer.data[file->buffer.size] = '\0';
+        break;
+
+    default:
+        return;
+    }
+
+    /* Open or read finished for good: close in the background, deliver */
+    if (aborting) {
+        if (file->fd >= 0) close(file->fd);
+        file->fd = -1;
+    } else {
+        queue_close(ingest, file);
+    }
+    (*delivered)++;
+    deliver(run, file);
+}
+
+/* Retire every posted completion, counting the follow-ups it queued */
+static void reap_completions(RiftIngest* ingest, RunState* run, bool aborting,
+                             size_t* outstanding, size_t* delivered) {
+    IngestRing* ring = &ingest->ring;
+    unsigned head = *ring->cq_head;
+    unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+        uint64_t user_data = cqe->user_data;
+        int res = cqe->res;
+        head++;
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+        unsigned queued = ring->to_submit;
+        (*outstanding)--;
+        handle_completion(ingest, run, user_data, res, aborting, delivered);
+        *outstanding += ring->to_submit - queued;
+    }
+}
+
+/* Paths never started still get exactly one delivery */
+static void cancel_unstarted(RunState* run, const char* const* paths,
+                             size_t next, size_t count) {
+    for (size_t i = next; i < count; i++) {
+        IngestFile* file = calloc(1, sizeof(IngestFile));
+        if (!file) {
+            atomic_store(&run->failed, true);
+            continue;
+        }
+        file->buffer.index = i;
+        file->buffer.path = paths[i];
+        file->buffer.error = ECANCELED;
+        file->slot = -1;
+        file->fd = -1;
+        deliver(run, file);
+    }
+}
+
+static IngestFile* take_slot(RiftIngest* ingest, bool block) {
+    pthread_mutex_lock(&ingest->lock);
+    while (block && ingest->free_count == 0) {
+        pthread_cond_wait(&ingest->released, &ingest->lock);
+    }
+    IngestFile* file = NULL;
+    if (ingest->free_count > 0) {
+        file = &ingest->files[ingest->free_slots[--ingest->free_count]];
+    }
+    pthread_mutex_unlock(&ingest->lock);
+    return file;
+}
+
+static int run_uring(RiftIngest* ingest, RunState* run,
+                     const char* const* paths, size_t count) {
+    IngestRing* ring = &ingest->ring;
+    size_t buffer_size = ingest->config.buffer_size;
+    size_t next = 0;
+    size_t delivered = 0;
+    size_t outstanding = 0;     /* Requests queued or in the kernel */
+
+    while (delivered < count || outstanding > 0) {
+        /* Start files while slots are free; block only with nothing in flight */
+        while (next < count) {
+            IngestFile* file = take_slot(ingest, outstanding == 0);
+            if (!file) break;
+
+            file->buffer = (RiftIngestBuffer){ next, paths[next], NULL, 0, 0 };
+            file->buffer.data = ingest->arena + (size_t)file->slot * buffer_size;
+            file->capacity = buffer_size - 1;
+            file->heap = NULL;
+            file->fd = -1;
+            queue_open(ingest, file);
+            next++;
+            outstanding++;
+        }
+
+        if (outstanding > 0 && ring_enter(ring, outstanding) != 0) break;
+        reap_completions(ingest, run, false, &outstanding, &delivered);
+    }
+
+    if (delivered == count && outstanding == 0) return 0;
+
+    /* The ring failed mid-run. Requests the kernel still holds point at
+     * slots and buffers, so wait them out before anyone reuses those. */
+    while (outstanding > 0) {
+        if (ring_enter(ring, outstanding) != 0) {
+            /* Cannot even wait: closing the ring cancels what is left */
+            ring_teardown(ring);
+            ingest->uring = false;
+            break;
+        }
+        reap_completions(ingest, run, true, &outstanding, &delivered);
+    }
+    cancel_unstarted(run, paths, next, count);
+    return -1;
+}
+
+static void setup_uring(RiftIngest* ingest) {
+    size_t depth = ingest->config.queue_depth;
+
+    /* Per slot: the current open/read plus a trailing close */
+    if (ring_setup(&ingest->ring, (unsigned)(depth * 2)) != 0) return;
+    ingest->uring = true;
+
+    struct iovec* iov = malloc(depth * sizeof(struct iovec));
+    if (!iov) return;
+    for (size_t i = 0; i < depth; i++) {
+        iov[i].iov_base = ingest->arena + i * ingest->config.buffer_size;
+        iov[i].iov_len = ingest->config.buffer_size;
+    }
+    /* Pinning can fail under a tight RLIMIT_MEMLOCK; plain reads still work */
+    ingest->fixed_buffers = syscall(__NR_io_uring_register, ingest->ring.fd,
+                                    IORING_REGISTER_BUFFERS, iov, (unsigned)depth) == 0;
+    free(iov);
+}
+
+#endif /* RIFT_HAVE_IO_URING */
+
+/* =================================================================
+ * PUBLIC API
+ * =================================================================
+ */
+
+RiftIngest* rift_ingest_create(const RiftIngestConfig* config) {
+    RiftIngest* ingest = calloc(1, sizeof(RiftIngest));
+    if (!ingest) return NULL;
+
+    if (config) ingest->config = *config;
+    if (ingest->config.queue_depth == 0) ingest->config.queue_depth = RIFT_INGEST_DEFAULT_DEPTH;
+    if (ingest->config.queue_depth > INGEST_MAX_DEPTH) ingest->config.queue_depth = INGEST_MAX_DEPTH;
+    if (ingest->config.buffer_size < 2) ingest->config.buffer_size = RIFT_INGEST_DEFAULT_BUFFER_SIZE;
+
+    pthread_mutex_init(&ingest->lock, NULL);
+    pthread_cond_init(&ingest->released, NULL);
+
+#ifdef RIFT_HAVE_IO_URING
+    ingest->ring.fd = -1;
+    if (!ingest->config.disable_io_uring) {
+        size_t depth = ingest->config.queue_depth;
+        ingest->files = calloc(depth, sizeof(IngestFile));
+        ingest->free_slots = malloc(depth * sizeof(size_t));
+        /* Page-aligned so the kernel can pin whole pages */
+        if (posix_memalign((void**)&ingest->arena, 4096, depth * ingest->config.buffer_size) != 0) {
+            ingest->arena = NULL;
+        }
+        if (!ingest->files || !ingest->free_slots || !ingest->arena) {
+            rift_ingest_destroy(ingest);
+            return NULL;
+        }
+        for (size_t i = 0; i < depth; i++) {
+            ingest->files[i].slot = (int)i;
+            ingest->free_slots[i] = depth - 1 - i;
+        }
+        ingest->free_count = depth;
+        setup_uring(ingest);
+
+        if (!ingest->uring) {
+            free(ingest->arena);
+            free(ingest->free_slots);
+            free(ingest->files);
+            ingest->arena = NULL;
+            ingest->free_slots = NULL;
+            ingest->files = NULL;
+        }
+    }
+#endif
+
+    return ingest;
+}
+
+/* Every delivered buffer must have been released */
+void rift_ingest_destroy(RiftIngest* ingest) {
+    if (!ingest) return;
+
+#ifdef RIFT_HAVE_IO_URING
+    ring_teardown(&ingest->ring);
+#endif
+    free(ingest->arena);
+    free(ingest->free_slots);
+    free(ingest->files);
+    pthread_cond_destroy(&ingest->released);
+    pthread_mutex_destroy(&ingest->lock);
+    free(ingest);
+}
+
+const char* rift_ingest_backend(const RiftIngest* ingest) {
+#ifdef RIFT_HAVE_IO_URING
+    if (ingest && ingest->uring) return "io_uring";
+#else
+    (void)ingest;
+#endif
+    return "threads";
+}
+
+int rift_ingest_run(RiftIngest* ingest, const char* const* paths, size_t count,
+                    RiftIngestCallback callback, void* user_data) {
+    if (!ingest || (!paths && count > 0) || !callback) return -1;
+
+    RunState run = { ingest, callback, user_data, false };
+    atomic_init(&run.failed, false);
+
+#ifdef RIFT_HAVE_IO_URING
+    if (ingest->uring) {
+        if (run_uring(ingest, &run, paths, count) != 0) return -1;
+        return atomic_load(&run.failed) ? -1 : 0;
+    }
+#endif
+
+    if (run_fallback(ingest, &run, paths, count) != 0) return -1;
+    return atomic_load(&run.failed) ? -1 : 0;
+}
+
+void rift_ingest_release(RiftIngest* ingest, RiftIngestBuffer* buffer) {
+    if (!ingest || !buffer) return;
+
+    IngestFile* file = (IngestFile*)buffer;
+    free(file->heap);
+    file->heap = NULL;
+
+    if (file->slot < 0) {
+        free(file);
+        return;
+    }
+
+    pthread_mutex_lock(&ingest->lock);
+    ingest->free_slots[ingest->free_count++] = (size_t)file->slot;
+    pthread_cond_signal(&ingest->released);
+    pthread_mutex_unlock(&ingest->lock);
+}
@@ -0,0 +1,475 @@
+/*
+ * =================================================================
+ * rift_log.c - RIFT-0 Leveled Logging
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ *
+ * Each thread formats into its own chunk. In synchronous mode every
+ * record is emitted with a single write(2); in asynchronous mode full
+ * chunks (and any chunk holding a WARN or ERROR record) are queued for
+ * the flusher thread and the producer continues with a recycled chunk.
+ * Threads are registered so shutdown can ship chunks that threads still
+ * running have not filled yet.
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "rift-0/core/rift_log.h"
+
+#define RIFT_LOG_MIN_BUFFER_SIZE 512
+
+typedef struct RiftLogChunk {
+    struct RiftLogChunk* next;
+    size_t size;
+    size_t capacity;
+    char data[];
+} RiftLogChunk;
+
+/* A logging thread. Its lock is uncontended except while shutdown
+ * ships the chunk from another thread. */
+typedef struct RiftLogThread {
+    struct RiftLogThread* prev;
+    struct RiftLogThread* next;
+    pthread_mutex_t lock;
+    RiftLogChunk* chunk;
+    uint32_t thread_id;
+} RiftLogThread;
+
+atomic_int rift_log_threshold = RIFT_LOG_DEFAULT_LEVEL;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t pending_cond;
+    pthread_cond_t drained_cond;
+
+    /* Chunks waiting for the flusher, and recycled empty chunks */
+    RiftLogChunk* head;
+    RiftLogChunk* tail;
+    RiftLogChunk* free_list;
+    size_t in_flight;
+
+    pthread_t flusher;
+    bool running;
+    bool stopping;
+    bool atexit_registered;
+
+    /* Configuration; changed only through rift_log_init */
+    int fd;
+    bool async;
+    bool binary;
+    size_t buffer_size;
+} g_log = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .pending_cond = PTHREAD_COND_INITIALIZER,
+    .drained_cond = PTHREAD_COND_INITIALIZER,
+    .fd = STDERR_FILENO,
+    .buffer_size = RIFT_LOG_DEFAULT_BUFFER_SIZE
+};
+
+static const char* const level_names[] = {
+    "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "OFF"
+};
+
+/* Producers check this without taking g_log.lock */
+static atomic_bool g_async_active;
+
+static _Thread_local RiftLogThread* t_thread;
+
+static pthread_key_t g_thread_key;
+static pthread_once_t g_thread_key_once = PTHREAD_ONCE_INIT;
+
+/* Live threads; taken before a thread's lock, which goes before g_log.lock */
+static pthread_mutex_t g_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+static RiftLogThread* g_threads;
+
+/* =================================================================
+ * CHUNK MANAGEMENT
+ * =================================================================
+ */
+
+static void write_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;     /* Logging never fails the caller */
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+}
+
+static RiftLogChunk* chunk_acquire(void) {
+    RiftLogChunk* chunk = NULL;
+
+    pthread_mutex_lock(&g_log.lock);
+    if (g_log.free_list) {
+        chunk = g_log.free_list;
+        g_log.free_list = chunk->next;
+    }
+    size_t capacity = g_log.buffer_size;
+    pthread_mutex_unlock(&g_log.lock);
+
+    if (!chunk) {
+        chunk = malloc(sizeof(RiftLogChunk) + capacity);
+        if (!chunk) return NULL;
+        chunk->capacity = capacity;
+    }
+
+    chunk->next = NULL;
+    chunk->size = 0;
+    return chunk;
+}
+
+/* Hand a chunk to the flusher; returns a fresh chunk for the producer */
+static RiftLogChunk* chunk_submit(RiftLogChunk* chunk) {
+    if (chunk->size == 0) return chunk;
+
+    if (atomic_load_explicit(&g_async_active, memory_order_acquire)) {
+        pthread_mutex_lock(&g_log.lock);
+        if (g_log.running && !g_log.stopping) {
+            if (g_log.tail) g_log.tail->next = chunk;
+            else g_log.head = chunk;
+            g_log.tail = chunk;
+            g_log.in_flight++;
+            pthread_cond_signal(&g_log.pending_cond);
+            pthread_mutex_unlock(&g_log.lock);
+            return chunk_acquire();
+        }
+        pthread_mutex_unlock(&g_log.lock);
+    }
+
+    write_all(g_log.fd, chunk->data, chunk->size);
+    chunk->size = 0;
+    return chunk;
+}
+
+static void thread_destructor(void* value) {
+    RiftLogThread* thread = (RiftLogThread*)value;
+    t_thread = NULL;
+    if (!thread) return;
+
+    /* Once unlinked, shutdown no longer reaches this chunk */
+    pthread_mutex_lock(&g_threads_lock);
+    if (thread->prev) thread->prev->next = thread->next;
+    else g_threads = thread->next;
+    if (thread->next) thread->next->prev = thread->prev;
+    pthread_mutex_unlock(&g_threads_lock);
+
+    RiftLogChunk* chunk = thread->chunk ? chunk_submit(thread->chunk) : NULL;
+    free(chunk);
+    pthread_mutex_destroy(&thread->lock);
+    free(thread);
+}
+
+static void create_thread_key(void) {
+    pthread_key_create(&g_thread_key, thread_destructor);
+}
+
+/* The calling thread's registration, created on its first record */
+static RiftLogThread* current_thread(void) {
+    if (t_thread) return t_thread;
+
+    pthread_once(&g_thread_key_once, create_thread_key);
+    RiftLogThread* thread = calloc(1, sizeof(RiftLogThread));
+    if (!thread) return NULL;
+    pthread_mutex_init(&thread->lock, NULL);
+    thread->chunk = chunk_acquire();
+    thread->thread_id = (uint32_t)syscall(SYS_gettid);
+
+    pthread_mutex_lock(&g_threads_lock);
+    thread->next = g_threads;
+    if (g_threads) g_threads->prev = thread;
+    g_threads = thread;
+    pthread_mutex_unlock(&g_threads_lock);
+
+    t_thread = thread;
+    pthread_setspecific(g_thread_key, thread);
+    return thread;
+}
+
+/* Ship the chunk of every live thread that holds records */
+static void submit_thread_chunks(void) {
+    pthread_mutex_lock(&g_threads_lock);
+    for (RiftLogThread* thread = g_threads; thread; thread = thread->next) {
+        pthread_mutex_lock(&thread->lock);
+        if (thread->chunk && thread->chunk->size > 0) {
+            thread->chunk = chunk_submit(thread->chunk);
+        }
+        pthread_mutex_unlock(&thread->lock);
+    }
+    pthread_mutex_unlock(&g_threads_lock);
+}
+
+static void wait_drained(void) {
+    pthread_mutex_lock(&g_log.lock);
+    while (g_log.running && g_log.in_flight > 0) {
+        pthread_cond_wait(&g_log.drained_cond, &g_log.lock);
+    }
+    pthread_mutex_unlock(&g_log.lock);
+}
+
+/* =================================================================
+ * FLUSHER THREAD
+ * =================================================================
+ */
+
+static void* flusher_main(void* arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&g_log.lock);
+    for (;;) {
+        while (!g_log.head && !g_log.stopping) {
+            pthread_cond_wait(&g_log.pending_cond, &g_log.lock);
+        }
+        if (!g_log.head && g_log.stopping) break;
+
+        RiftLogChunk* batch = g_log.head;
+        g_log.head = g_log.tail = NULL;
+        int fd = g_log.fd;
+        pthread_mutex_unlock(&g_log.lock);
+
+        size_t written = 0;
+        RiftLogChunk* last = batch;
+        for (RiftLogChunk* c = batch; c; c = c->next) {
+            write_all(fd, c->data, c->size);
+            last = c;
+            written++;
+        }
+
+        pthread_mutex_lock(&g_log.lock);
+        last->next = g_log.free_list;
+        g_log.free_list = batch;
+        g_log.in_flight -= written;
+        pthread_cond_broadcast(&g_log.drained_cond);
+    }
+    pthread_mutex_unlock(&g_log.lock);
+
+    return NULL;
+}
+
+/* =================================================================
+ * CONFIGURATION
+ * =================================================================
+ */
+
+int rift_log_init(const RiftLogConfig* config) {
+    rift_log_shutdown();
+
+    RiftLogConfig defaults = {
+        RIFT_LOG_DEFAULT_LEVEL, -1, false, false, 0
+    };
+    if (!config) config = &defaults;
+
+    pthread_mutex_lock(&g_log.lock);
+    g_log.fd = config->fd >= 0 ? config->fd : STDERR_FILENO;
+    g_log.binary = config->binary;
+    g_log.buffer_size = config->buffer_size ? config->buffer_size
+                                            : RIFT_LOG_DEFAULT_BUFFER_SIZE;
+    if (g_log.buffer_size < RIFT_LOG_MIN_BUFFER_SIZE) {
+        g_log.buffer_size = RIFT_LOG_MIN_BUFFER_SIZE;
+    }
+    g_log.async = config->async;
+
+    int result = 0;
+    if (g_log.async) {
+        g_log.stopping = false;
+        if (pthread_create(&g_log.flusher, NULL, flusher_main, NULL) == 0) {
+            g_log.running = true;
+            atomic_store_explicit(&g_async_active, true, memory_order_release);
+            if (!g_log.atexit_registered) {
+                g_log.atexit_registered = true;
+                atexit(rift_log_shutdown);
+            }
+        } else {
+            g_log.async = false;
+            result = -1;
+        }
+    }
+    pthread_mutex_unlock(&g_log.lock);
+
+    rift_log_set_level(config->level);
+    return result;
+}
+
+void rift_log_shutdown(void) {
+    submit_thread_chunks();
+    wait_drained();
+
+    atomic_store_explicit(&g_async_active, false, memory_order_release);
+
+    pthread_mutex_lock(&g_log.lock);
+    bool running = g_log.running;
+    if (running) {
+        g_log.stopping = true;
+        pthread_cond_signal(&g_log.pending_cond);
+    }
+    pthread_mutex_unlock(&g_log.lock);
+
+    if (running) {
+        pthread_join(g_log.flusher, NULL);
+    }
+
+    pthread_mutex_lock(&g_log.lock);
+    g_log.running = false;
+    g_log.async = false;
+    while (g_log.free_list) {
+        RiftLogChunk* next = g_log.free_list->next;
+        free(g_log.free_list);
+        g_log.free_list = next;
+    }
+    pthread_mutex_unlock(&g_log.lock);
+}
+
+void rift_log_set_level(RiftLogLevel level) {
+    if (level < RIFT_LOG_LEVEL_TRACE) level = RIFT_LOG_LEVEL_TRACE;
+    if (level > RIFT_LOG_LEVEL_OFF) level = RIFT_LOG_LEVEL_OFF;
+    atomic_store_explicit(&rift_log_threshold, level, memory_order_relaxed);
+}
+
+RiftLogLevel rift_log_get_level(void) {
+    return atomic_load_explicit(&rift_log_threshold, memory_order_relaxed);
+}
+
+RiftLogLevel rift_log_level_from_string(const char* name) {
+    if (!name) return -1;
+
+    for (int i = RIFT_LOG_LEVEL_TRACE; i <= RIFT_LOG_LEVEL_OFF; i++) {
+        if (strcasecmp(name, level_names[i]) == 0) return i;
+    }
+    if (strcasecmp(name, "warning") == 0) return RIFT_LOG_LEVEL_WARN;
+
+    return -1;
+}
+
+void rift_log_flush(void) {
+    RiftLogThread* thread = t_thread;
+    if (thread) {
+        pthread_mutex_lock(&thread->lock);
+        if (thread->chunk && thread->chunk->size > 0) {
+            thread->chunk = chunk_submit(thread->chunk);
+        }
+        pthread_mutex_unlock(&thread->lock);
+    }
+
+    wait_drained();
+}
+
+/* =================================================================
+ * RECORD FORMATTING
+ * =================================================================
+ */
+
+static const char* base_name(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+/*
+ * Format one record at the end of chunk; returns bytes used, or 0 if it
+ * did not fit. An oversized text record is truncated when allowed.
+ */
+static size_t format_record(RiftLogChunk* chunk, uint32_t thread_id,
+                            RiftLogLevel level, const char* file, int line, bool truncate,
+                            const char* format, va_list args) {
+    char* out = chunk->data + chunk->size;
+    size_t room = chunk->capacity - chunk->size;
+
+    if (g_log.binary) {
+        size_t file_len = strlen(file) + 1;
+        if (room <= sizeof(RiftLogRecordHeader) + file_len) return 0;
+
+        char* message = out + sizeof(RiftLogRecordHeader) + file_len;
+        size_t message_room = room - sizeof(RiftLogRecordHeader) - file_len;
+        int n = vsnprintf(message, message_room, format, args);
+        if (n < 0 || (size_t)n >= message_room) return 0;
+
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+
+        RiftLogRecordHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = RIFT_LOG_BINARY_MAGIC;
+        header.length = (uint32_t)(file_len + (size_t)n);
+        header.timestamp_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+        header.thread_id = thread_id;
+        header.line = (uint32_t)line;
+        header.level = (uint8_t)level;
+
+        memcpy(out, &header, sizeof(header));
+        memcpy(out + sizeof(header), file, file_len);
+        return sizeof(header) + header.length;
+    }
+
+    int prefix = snprintf(out, room, "[%s] %s:%d: ", level_names[level], file, line);
+    if (prefix < 0 || (size_t)prefix >= room) return 0;
+
+    int n = vsnprintf(out + prefix, room - (size_t)prefix, format, args);
+    if (n < 0) return 0;
+
+    size_t used = (size_t)prefix + (size_t)n;
+    if (used + 1 >= room) {
+        if (!truncate) return 0;
+        used = room - 1;
+    }
+
+    out[used++] = '\n';
+    return used;
+}
+
+void rift_log_write(RiftLogLevel level, const char* file, int line,
+                    const char* format, ...) {
+    if (level < RIFT_LOG_LEVEL_TRACE || level >= RIFT_LOG_LEVEL_OFF) return;
+
+    file = file ? base_name(file) : "?";
+
+    RiftLogThread* thread = current_thread();
+    if (!thread) return;
+
+    pthread_mutex_lock(&thread->lock);
+    RiftLogChunk* chunk = thread->chunk;
+    if (!chunk) {
+        pthread_mutex_unlock(&thread->lock);
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    size_t used = format_record(chunk, thread->thread_id, level, file, line,
+                                chunk->size == 0, format, args);
+    va_end(args);
+
+    if (used == 0 && chunk->size > 0) {
+        /* Chunk full: ship what is there and retry in an empty one */
+        chunk = thread->chunk = chunk_submit(chunk);
+        if (chunk) {
+            va_start(args, format);
+            used = format_record(chunk, thread->thread_id, level, file, line, true,
+                                 format, args);
+            va_end(args);
+        }
+    }
+
+    /* Nothing to add when a binary record is larger than a chunk */
+    if (chunk && used > 0) {
+        chunk->size += used;
+
+        /* Synchronous loggers emit each record; async ones batch until WARN */
+        if (!atomic_load_explicit(&g_async_active, memory_order_relaxed) ||
+            level >= RIFT_LOG_LEVEL_WARN) {
+            thread->chunk = chunk_submit(chunk);
+        }
+    }
+    pthread_mutex_unlock(&thread->lock);
+}
@@ -0,0 +1,200 @@
+/*
+ * =================================================================
+ * rift_pool.c - RIFT-0 Stage Context Pool
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "rift-0/core/rift_pool.h"
+
+/* One free list per shard, padded so shards never share a cache line */
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    RiftStage0Context** items;
+    size_t count;
+} PoolShard;
+
+struct RiftContextPool {
+    PoolShard shards[RIFT_POOL_SHARD_COUNT];
+
+    size_t max_contexts;
+    size_t token_capacity;
+    RiftTokenCache* token_cache;
+
+    atomic_size_t live;
+    atomic_size_t idle;
+    atomic_size_t created;
+    atomic_size_t reused;
+    atomic_size_t exhausted;
+};
+
+/* Threads are assigned shards round-robin on first use */
+static atomic_uint g_next_shard;
+static _Thread_local unsigned int t_shard = UINT_MAX;
+
+static unsigned int current_shard(void) {
+    if (t_shard == UINT_MAX) {
+        t_shard = atomic_fetch_add(&g_next_shard, 1) % RIFT_POOL_SHARD_COUNT;
+    }
+    return t_shard;
+}
+
+static void shard_push(RiftContextPool* pool, unsigned int index,
+                       RiftStage0Context* ctx) {
+    PoolShard* shard = &pool->shards[index];
+
+    pthread_mutex_lock(&shard->lock);
+    shard->items[shard->count++] = ctx;
+    pthread_mutex_unlock(&shard->lock);
+
+    atomic_fetch_add(&pool->idle, 1);
+}
+
+static RiftStage0Context* shard_pop(RiftContextPool* pool, unsigned int index) {
+    PoolShard* shard = &pool->shards[index];
+    RiftStage0Context* ctx = NULL;
+
+    pthread_mutex_lock(&shard->lock);
+    if (shard->count > 0) {
+        ctx = shard->items[--shard->count];
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (ctx) atomic_fetch_sub(&pool->idle, 1);
+    return ctx;
+}
+
+static RiftStage0Context* pool_new_context(RiftContextPool* pool) {
+    /* Reserve a slot first so concurrent creators cannot overshoot */
+    if (atomic_fetch_add(&pool->live, 1) >= pool->max_contexts) {
+        atomic_fetch_sub(&pool->live, 1);
+        atomic_fetch_add(&pool->exhausted, 1);
+        return NULL;
+    }
+
+    RiftStage0Context* ctx = rift_stage0_create_with_capacity(pool->token_capacity);
+    if (!ctx) {
+        atomic_fetch_sub(&pool->live, 1);
+        return NULL;
+    }
+
+    if (pool->token_cache) {
+        rift_stage0_set_token_cache(ctx, pool->token_cache);
+    }
+
+    atomic_fetch_add(&pool->created, 1);
+    return ctx;
+}
+
+/* =================================================================
+ * LIFECYCLE
+ * =================================================================
+ */
+
+RiftContextPool* rift_context_pool_create(const RiftContextPoolConfig* config) {
+    RiftContextPool* pool = calloc(1, sizeof(RiftContextPool));
+    if (!pool) return NULL;
+
+    pool->max_contexts = (config && config->max_contexts)
+                       ? config->max_contexts : RIFT_POOL_DEFAULT_MAX_CONTEXTS;
+    pool->token_capacity = config ? config->token_capacity : 0;
+    pool->token_cache = config ? config->token_cache : NULL;
+
+    /* Every shard can hold the whole pool, so release never fails */
+    for (unsigned int i = 0; i < RIFT_POOL_SHARD_COUNT; i++) {
+        pthread_mutex_init(&pool->shards[i].lock, NULL);
+        pool->shards[i].items = calloc(pool->max_contexts,
+                                       sizeof(RiftStage0Context*));
+        if (!pool->shards[i].items) {
+            rift_context_pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    size_t prewarm = config ? config->prewarm : 0;
+    if (prewarm > pool->max_contexts) prewarm = pool->max_contexts;
+
+    for (size_t i = 0; i < prewarm; i++) {
+        RiftStage0Context* ctx = pool_new_context(pool);
+        if (!ctx) break;
+        shard_push(pool, (unsigned int)(i % RIFT_POOL_SHARD_COUNT), ctx);
+    }
+
+    return pool;
+}
+
+/* Contexts still checked out must be released before destroy */
+void rift_context_pool_destroy(RiftContextPool* pool) {
+    if (!pool) return;
+
+    for (unsigned int i = 0; i < RIFT_POOL_SHARD_COUNT; i++) {
+        PoolShard* shard = &pool->shards[i];
+        if (shard->items) {
+            for (size_t j = 0; j < shard->count; j++) {
+                rift_stage0_destroy(shard->items[j]);
+            }
+            free(shard->items);
+        }
+        pthread_mutex_destroy(&shard->lock);
+    }
+
+    free(pool);
+}
+
+/* =================================================================
+ * ACQUIRE / RELEASE
+ * =================================================================
+ */
+
+RiftStage0Context* rift_context_pool_acquire(RiftContextPool* pool) {
+    if (!pool) return NULL;
+
+    unsigned int home = current_shard();
+
+    RiftStage0Context* ctx = shard_pop(pool, home);
+    if (!ctx && atomic_load(&pool->idle) > 0) {
+        /* Home shard empty: take an idle context from a neighbour */
+        for (unsigned int i = 1; i < RIFT_POOL_SHARD_COUNT && !ctx; i++) {
+            ctx = shard_pop(pool, (home + i) % RIFT_POOL_SHARD_COUNT);
+        }
+    }
+
+    if (ctx) {
+        atomic_fetch_add(&pool->reused, 1);
+        return ctx;
+    }
+
+    return pool_new_context(pool);
+}
+
+void rift_context_pool_release(RiftContextPool* pool, RiftStage0Context* ctx) {
+    if (!pool || !ctx) return;
+
+    if (!rift_stage0_reset(ctx)) {
+        rift_stage0_destroy(ctx);
+        atomic_fetch_sub(&pool->live, 1);
+        return;
+    }
+
+    shard_push(pool, current_shard(), ctx);
+}
+
+void rift_context_pool_get_stats(const RiftContextPool* pool,
+                                 RiftContextPoolStats* stats) {
+    if (!pool || !stats) return;
+
+    RiftContextPool* p = (RiftContextPool*)pool;
+    stats->live = atomic_load(&p->live);
+    stats->idle = atomic_load(&p->idle);
+    stats->created = atomic_load(&p->created);
+    stats->reused = atomic_load(&p->reused);
+    stats->exhausted = atomic_load(&p->exhausted);
+}
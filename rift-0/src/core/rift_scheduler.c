@@ -0,0 +1,391 @@
+/*
+ * =================================================================
+ * rift_scheduler.c - RIFT-0 Cooperative Job Scheduler
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include "rift-0/core/rift_scheduler.h"
+
+#define SCHED_STACK_CACHE 16
+
+/* =================================================================
+ * SCHEDULER STATE
+ * =================================================================
+ */
+
+typedef struct SchedJob {
+    struct SchedJob* next;
+    RiftJobFn fn;
+    void* arg;
+    ucontext_t context;
+    void* stack;                /* Mapping base; the lowest page is a guard */
+    bool started;
+    bool done;
+    uint64_t slice_start;       /* When the job was last resumed */
+} SchedJob;
+
+typedef struct {
+    RiftScheduler* scheduler;
+    pthread_t thread;
+    ucontext_t context;         /* Where a yielding job switches back to */
+    SchedJob* current;
+
+    /* Started jobs waiting for another turn; only this worker touches it */
+    SchedJob* ready_head;
+    SchedJob* ready_tail;
+    size_t ready_count;
+    size_t active;              /* Started and not finished */
+
+    void* stack_cache[SCHED_STACK_CACHE];
+    size_t cached;
+} SchedWorker;
+
+struct RiftScheduler {
+    SchedWorker* workers;
+    size_t worker_count;
+    size_t started;             /* Workers with a running thread */
+
+    size_t map_size;            /* Stack plus guard page */
+    size_t page_size;
+    uint64_t slice_ns;
+    size_t max_active;
+
+    /* Jobs no worker has started yet */
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t idle;
+    SchedJob* new_head;
+    SchedJob* new_tail;
+    atomic_size_t new_count;
+    size_t live;
+    bool stop;
+
+    atomic_size_t spawned;
+    atomic_size_t completed;
+    atomic_size_t switches;
+};
+
+static _Thread_local SchedWorker* t_worker;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* =================================================================
+ * STACKS
+ * =================================================================
+ */
+
+static void* stack_acquire(SchedWorker* w) {
+    if (w->cached > 0) return w->stack_cache[--w->cached];
+
+    RiftScheduler* s = w->scheduler;
+    void* base = mmap(NULL, s->map_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (base == MAP_FAILED) return NULL;
+
+    /* Overflow faults instead of corrupting the neighbouring mapping */
+    mprotect(base, s->page_size, PROT_NONE);
+    return base;
+}
+
+static void stack_release(SchedWorker* w, void* base) {
+    if (!base) return;
+    if (w->cached < SCHED_STACK_CACHE) {
+        w->stack_cache[w->cached++] = base;
+        return;
+    }
+    munmap(base, w->scheduler->map_size);
+}
+
+/* =================================================================
+ * JOB EXECUTION
+ * =================================================================
+ */
+
+static void job_entry(void) {
+    /* Fresh frame on the job's own stack; the worker is still current */
+    SchedJob* job = t_worker->current;
+    job->fn(job->arg);
+    job->done = true;
+    /* Returning resumes uc_link, the worker's loop */
+}
+
+static int start_job(SchedWorker* w, SchedJob* job) {
+    job->stack = stack_acquire(w);
+    if (!job->stack || getcontext(&job->context) != 0) return -1;
+
+    RiftScheduler* s = w->scheduler;
+    job->context.uc_stack.ss_sp = (char*)job->stack + s->page_size;
+    job->context.uc_stack.ss_size = s->map_size - s->page_size;
+    job->context.uc_link = &w->context;
+    makecontext(&job->context, job_entry, 0);
+
+    job->started = true;
+    w->active++;
+    return 0;
+}
+
+static void retire_job(SchedWorker* w, SchedJob* job) {
+    RiftScheduler* s = w->scheduler;
+
+    if (job->started) w->active--;
+    stack_release(w, job->stack);
+    free(job);
+
+    atomic_fetch_add_explicit(&s->completed, 1, memory_order_relaxed);
+    pthread_mutex_lock(&s->lock);
+    if (--s->live == 0) pthread_cond_broadcast(&s->idle);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static void ready_push(SchedWorker* w, SchedJob* job) {
+    job->next = NULL;
+    if (w->ready_tail) {
+        w->ready_tail->next = job;
+    } else {
+        w->ready_head = job;
+    }
+    w->ready_tail = job;
+    w->ready_count++;
+}
+
+static SchedJob* ready_pop(SchedWorker* w) {
+    SchedJob* job = w->ready_head;
+    if (!job) return NULL;
+    w->ready_head = job->next;
+    if (!w->ready_head) w->ready_tail = NULL;
+    w->ready_count--;
+    return job;
+}
+
+/* Take an unstarted job; blocks only when the worker has nothing else */
+static SchedJob* take_new_job(RiftScheduler* s, bool block) {
+    pthread_mutex_lock(&s->lock);
+    while (block && !s->new_head && !s->stop) {
+        pthread_cond_wait(&s->work, &s->lock);
+    }
+    SchedJob* job = s->new_head;
+    if (job) {
+        s->new_head = job->next;
+        if (!s->new_head) s->new_tail = NULL;
+        atomic_fetch_sub_explicit(&s->new_count, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return job;
+}
+
+static SchedJob* next_job(SchedWorker* w) {
+    RiftScheduler* s = w->scheduler;
+    bool room = s->max_active == 0 || w->active < s->max_active;
+
+    /* New work first while there is room, so fresh jobs are not starved
+     * by a set of long-running jobs that keep yielding */
+    if (room && atomic_load_explicit(&s->new_count, memory_order_relaxed) > 0) {
+        SchedJob* job = take_new_job(s, false);
+        if (job) return job;
+    }
+
+    SchedJob* job = ready_pop(w);
+    if (job) return job;
+
+    /* Nothing started is left here, so the cap cannot be reached */
+    return take_new_job(s, true);
+}
+
+static void* sched_worker_main(void* arg) {
+    SchedWorker* w = (SchedWorker*)arg;
+    RiftScheduler* s = w->scheduler;
+    t_worker = w;
+
+    for (;;) {
+        SchedJob* job = next_job(w);
+        if (!job) break;
+
+        if (job->started) {
+            atomic_fetch_add_explicit(&s->switches, 1, memory_order_relaxed);
+        } else if (start_job(w, job) != 0) {
+            /* No stack: run it on the worker, where yields are plain */
+            job->fn(job->arg);
+            retire_job(w, job);
+            continue;
+        }
+
+        w->current = job;
+        job->slice_start = now_ns();
+        swapcontext(&w->context, &job->context);
+        w->current = NULL;
+
+        if (job->done) {
+            retire_job(w, job);
+        } else {
+            ready_push(w, job);
+        }
+    }
+
+    return NULL;
+}
+
+/* =================================================================
+ * PUBLIC API
+ * =================================================================
+ */
+
+RiftScheduler* rift_scheduler_create(const RiftSchedulerConfig* config) {
+    RiftSchedulerConfig defaults = { 0, 0, 0, 0 };
+    if (!config) config = &defaults;
+
+    RiftScheduler* s = calloc(1, sizeof(RiftScheduler));
+    if (!s) return NULL;
+
+    long page = sysconf(_SC_PAGESIZE);
+    s->page_size = page > 0 ? (size_t)page : 4096;
+    size_t stack = config->stack_size ? config->stack_size : RIFT_SCHEDULER_DEFAULT_STACK;
+    stack = (stack + s->page_size - 1) & ~(s->page_size - 1);
+    s->map_size = stack + s->page_size;
+    s->slice_ns = (uint64_t)(config->time_slice_us ? config->time_slice_us
+                                                   : RIFT_SCHEDULER_DEFAULT_SLICE_US) * 1000;
+    s->max_active = config->max_active;
+
+    s->worker_count = config->worker_count;
+    if (s->worker_count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        s->worker_count = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    s->workers = calloc(s->worker_count, sizeof(SchedWorker));
+    if (!s->workers) {
+        free(s);
+        return NULL;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->work, NULL);
+    pthread_cond_init(&s->idle, NULL);
+    atomic_init(&s->new_count, 0);
+    atomic_init(&s->spawned, 0);
+    atomic_init(&s->completed, 0);
+    atomic_init(&s->switches, 0);
+
+    for (size_t i = 0; i < s->worker_count; i++) {
+        s->workers[i].scheduler = s;
+        if (pthread_create(&s->workers[i].thread, NULL, sched_worker_main,
+                           &s->workers[i]) != 0) {
+            rift_scheduler_destroy(s);
+            return NULL;
+        }
+        s->started++;
+    }
+
+    return s;
+}
+
+void rift_scheduler_destroy(RiftScheduler* s) {
+    if (!s) return;
+
+    pthread_mutex_lock(&s->lock);
+    s->stop = true;
+    pthread_cond_broadcast(&s->work);
+    pthread_mutex_unlock(&s->lock);
+
+    for (size_t i = 0; i < s->started; i++) {
+        pthread_join(s->workers[i].thread, NULL);
+    }
+
+    /* Workers leave only once both queues are empty */
+    for (size_t i = 0; i < s->worker_count; i++) {
+        SchedWorker* w = &s->workers[i];
+        for (size_t k = 0; k < w->cached; k++) {
+            munmap(w->stack_cache[k], s->map_size);
+        }
+    }
+
+    pthread_cond_destroy(&s->idle);
+    pthread_cond_destroy(&s->work);
+    pthread_mutex_destroy(&s->lock);
+    free(s->workers);
+    free(s);
+}
+
+int rift_scheduler_spawn(RiftScheduler* s, RiftJobFn fn, void* arg) {
+    if (!s || !fn) return -1;
+
+    SchedJob* job = calloc(1, sizeof(SchedJob));
+    if (!job) return -1;
+    job->fn = fn;
+    job->arg = arg;
+
+    pthread_mutex_lock(&s->lock);
+    if (s->new_tail) {
+        s->new_tail->next = job;
+    } else {
+        s->new_head = job;
+    }
+    s->new_tail = job;
+    s->live++;
+    atomic_fetch_add_explicit(&s->new_count, 1, memory_order_relaxed);
+    pthread_cond_signal(&s->work);
+    pthread_mutex_unlock(&s->lock);
+
+    atomic_fetch_add_explicit(&s->spawned, 1, memory_order_relaxed);
+    return 0;
+}
+
+void rift_scheduler_wait(RiftScheduler* s) {
+    if (!s) return;
+
+    pthread_mutex_lock(&s->lock);
+    while (s->live > 0) {
+        pthread_cond_wait(&s->idle, &s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+void rift_scheduler_get_stats(const RiftScheduler* scheduler, RiftSchedulerStats* stats) {
+    if (!scheduler || !stats) return;
+
+    RiftScheduler* s = (RiftScheduler*)scheduler;
+    stats->worker_count = s->worker_count;
+    stats->spawned = atomic_load(&s->spawned);
+    stats->completed = atomic_load(&s->completed);
+    stats->switches = atomic_load(&s->switches);
+}
+
+void rift_job_yield(void) {
+    SchedWorker* w = t_worker;
+    if (!w || !w->current) {
+        sched_yield();
+        return;
+    }
+
+    /* The worker loop queues us again once we are off this stack */
+    swapcontext(&w->current->context, &w->context);
+}
+
+bool rift_job_should_yield(void) {
+    SchedWorker* w = t_worker;
+    if (!w || !w->current) return false;
+    if (now_ns() - w->current->slice_start < w->scheduler->slice_ns) return false;
+
+    return w->ready_count > 0 ||
+           atomic_load_explicit(&w->scheduler->new_count, memory_order_relaxed) > 0;
+}
+
+bool rift_job_in_scheduler(void) {
+    return t_worker != NULL && t_worker->current != NULL;
+}
@@ -0,0 +1,489 @@
+/*
+ * =================================================================
+ * rift_telemetry.c - RIFT-0 Spawn and Heartbeat Telemetry
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "rift-0/core/rift_telemetry.h"
+#include "rift-0/core/rift_hash.h"
+
+#define RING_MASK (RIFT_TELEMETRY_RING_SIZE - 1)
+
+_Static_assert((RIFT_TELEMETRY_RING_SIZE & RING_MASK) == 0,
+               "RIFT_TELEMETRY_RING_SIZE must be a power of two");
+
+/* =================================================================
+ * PER-THREAD RINGS
+ * =================================================================
+ */
+
+typedef enum {
+    EVENT_SPAWN,
+    EVENT_HEARTBEAT
+} TelemetryEventType;
+
+typedef struct {
+    TelemetryEventType type;
+    uint64_t rift_id;
+    struct timespec when;
+    rift_spawn_telemetry_t* spawn;      /* EVENT_SPAWN: heap copy, freed on drain */
+} TelemetryEvent;
+
+/* One producer (the owning thread), one consumer (whoever holds g_lock) */
+typedef struct TelemetryRing {
+    struct TelemetryRing* next;         /* Fixed once the ring is published */
+    atomic_bool owned;                  /* A live thread produces into it */
+
+    alignas(64) atomic_size_t head;     /* Consumer position */
+
+    alignas(64) atomic_size_t tail;     /* Producer position */
+    size_t cached_head;                 /* Producer's last view of head */
+    atomic_uint_fast64_t dropped;       /* Written by the producer only */
+
+    alignas(64) TelemetryEvent events[RIFT_TELEMETRY_RING_SIZE];
+} TelemetryRing;
+
+/*
+ * Rings are never freed: a thread that exits hands its ring back for
+ * the next thread to adopt, so the list is bounded by the peak number
+ * of reporting threads and outlives init/shutdown cycles.
+ */
+static _Atomic(TelemetryRing*) g_rings;
+static atomic_size_t g_ring_count;
+static atomic_bool g_active;
+static atomic_uint_fast64_t g_next_id = 1;
+
+static pthread_once_t g_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_ring_key;
+static _Thread_local TelemetryRing* t_ring;
+
+static void ring_retire(void* arg) {
+    TelemetryRing* ring = (TelemetryRing*)arg;
+    atomic_store_explicit(&ring->owned, false, memory_order_release);
+}
+
+static void create_ring_key(void) {
+    pthread_key_create(&g_ring_key, ring_retire);
+}
+
+static TelemetryRing* ring_new(void) {
+    TelemetryRing* ring = aligned_alloc(alignof(TelemetryRing), sizeof(TelemetryRing));
+    if (!ring) return NULL;
+
+    memset(ring, 0, sizeof(*ring));
+    atomic_init(&ring->owned, true);
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+
+    TelemetryRing* first = atomic_load_explicit(&g_rings, memory_order_relaxed);
+    do {
+        ring->next = first;
+    } while (!atomic_compare_exchange_weak_explicit(&g_rings, &first, ring,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+    atomic_fetch_add_explicit(&g_ring_count, 1, memory_order_relaxed);
+    return ring;
+}
+
+static TelemetryRing* thread_ring(void) {
+    if (t_ring) return t_ring;
+
+    pthread_once(&g_key_once, create_ring_key);
+
+    TelemetryRing* ring = atomic_load_explicit(&g_rings, memory_order_acquire);
+    for (; ring; ring = ring->next) {
+        bool expected = false;
+        if (!atomic_load_explicit(&ring->owned, memory_order_relaxed) &&
+            atomic_compare_exchange_strong_explicit(&ring->owned, &expected, true,
+                                                    memory_order_acquire,
+                                                    memory_order_relaxed)) {
+            break;
+        }
+    }
+    if (!ring) ring = ring_new();
+    if (!ring) return NULL;
+
+    /* The previous owner's cached head may be stale, never ahead */
+    ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    pthread_setspecific(g_ring_key, ring);
+    t_ring = ring;
+    return ring;
+}
+
+static bool ring_push(TelemetryRing* ring, const TelemetryEvent* event) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail - ring->cached_head >= RIFT_TELEMETRY_RING_SIZE) {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail - ring->cached_head >= RIFT_TELEMETRY_RING_SIZE) return false;
+    }
+
+    ring->events[tail & RING_MASK] = *event;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+/* =================================================================
+ * REGISTRY
+ * =================================================================
+ */
+
+typedef struct {
+    rift_spawn_telemetry_t telemetry;   /* First, so get() can return it */
+    struct timespec last_heartbeat;
+    uint64_t heartbeats;
+    bool registered;                    /* False until the spawn event arrives */
+} TelemetryRecord;
+
+/* Everything below is guarded by g_lock */
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_wake = PTHREAD_COND_INITIALIZER;
+static pthread_t g_aggregator;
+static bool g_running;
+
+static TelemetryRecord** g_table;
+static size_t g_capacity;
+static size_t g_records;
+static size_t g_registered;
+static uint64_t g_heartbeats;
+
+static size_t slot_of(uint64_t rift_id, size_t capacity) {
+    return (size_t)rift_hash64_combine(0, rift_id) & (capacity - 1);
+}
+
+static TelemetryRecord* registry_find(uint64_t rift_id) {
+    if (!g_table) return NULL;
+    for (size_t i = slot_of(rift_id, g_capacity); g_table[i]; i = (i + 1) & (g_capacity - 1)) {
+        if (g_table[i]->telemetry.rift_thread_id == rift_id) return g_table[i];
+    }
+    return NULL;
+}
+
+static bool registry_grow(void) {
+    size_t capacity = g_capacity ? g_capacity * 2 : 64;
+    TelemetryRecord** table = calloc(capacity, sizeof(TelemetryRecord*));
+    if (!table) return false;
+
+    for (size_t i = 0; i < g_capacity; i++) {
+        TelemetryRecord* record = g_table[i];
+        if (!record) continue;
+        size_t k = slot_of(record->telemetry.rift_thread_id, capacity);
+        while (table[k]) k = (k + 1) & (capacity - 1);
+        table[k] = record;
+    }
+
+    free(g_table);
+    g_table = table;
+    g_capacity = capacity;
+    return true;
+}
+
+static TelemetryRecord* registry_lookup(uint64_t rift_id) {
+    TelemetryRecord* record = registry_find(rift_id);
+    if (record) return record;
+
+    if ((g_records + 1) * 2 > g_capacity && !registry_grow()) return NULL;
+
+    record = calloc(1, sizeof(TelemetryRecord));
+    if (!record) return NULL;
+    record->telemetry.rift_thread_id = rift_id;
+
+    size_t k = slot_of(rift_id, g_capacity);
+    while (g_table[k]) k = (k + 1) & (g_capacity - 1);
+    g_table[k] = record;
+    g_records++;
+    return record;
+}
+
+static bool timespec_after(const struct timespec* a, const struct timespec* b) {
+    return a->tv_sec != b->tv_sec ? a->tv_sec > b->tv_sec : a->tv_nsec > b->tv_nsec;
+}
+
+static void apply_spawn(const TelemetryEvent* event) {
+    TelemetryRecord* record = registry_lookup(event->rift_id);
+    if (!record) return;
+
+    /* Children may have reported before this spawn reached the registry */
+    uint32_t early_children = record->registered ? 0 : record->telemetry.child_count;
+    bool first = !record->registered;
+
+    record->telemetry = *event->spawn;
+    record->telemetry.child_count += early_children;
+    record->registered = true;
+
+    uint64_t parent_id = event->spawn->parent_rift_id;
+    if (parent_id != 0) {
+        TelemetryRecord* parent = registry_lookup(parent_id);
+        if (parent) {
+            if (first) parent->telemetry.child_count++;
+            if (parent->registered) {
+                record->telemetry.hierarchy_depth = parent->telemetry.hierarchy_depth + 1;
+            }
+        }
+    }
+    if (first) g_registered++;
+}
+
+static void apply_heartbeat(const TelemetryEvent* event) {
+    TelemetryRecord* record = registry_lookup(event->rift_id);
+    if (!record) return;
+
+    if (timespec_after(&event->when, &record->last_heartbeat)) {
+        record->last_heartbeat = event->when;
+    }
+    record->heartbeats++;
+    g_heartbeats++;
+}
+
+static void drain_ring(TelemetryRing* ring) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    for (; head != tail; head++) {
+        TelemetryEvent* event = &ring->events[head & RING_MASK];
+        if (event->type == EVENT_SPAWN) {
+            apply_spawn(event);
+            free(event->spawn);
+        } else {
+            apply_heartbeat(event);
+        }
+    }
+    atomic_store_explicit(&ring->head, head, memory_order_release);
+}
+
+static void drain_all(void) {
+    TelemetryRing* ring = atomic_load_explicit(&g_rings, memory_order_acquire);
+    for (; ring; ring = ring->next) drain_ring(ring);
+}
+
+static void* aggregator_main(void* arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&g_lock);
+    while (g_running) {
+        drain_all();
+
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += RIFT_TELEMETRY_INTERVAL_US * 1000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&g_wake, &g_lock, &deadline);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return NULL;
+}
+
+/* =================================================================
+ * PUBLIC API
+ * =================================================================
+ */
+
+int rift_telemetry_init(void) {
+    pthread_mutex_lock(&g_lock);
+    if (g_running) {
+        pthread_mutex_unlock(&g_lock);
+        return 0;
+    }
+
+    g_running = true;
+    if (pthread_create(&g_aggregator, NULL, aggregator_main, NULL) != 0) {
+        g_running = false;
+        pthread_mutex_unlock(&g_lock);
+        return -1;
+    }
+    atomic_store(&g_active, true);
+    pthread_mutex_unlock(&g_lock);
+    return 0;
+}
+
+void rift_telemetry_shutdown(void) {
+    pthread_mutex_lock(&g_lock);
+    if (!g_running) {
+        pthread_mutex_unlock(&g_lock);
+        return;
+    }
+    atomic_store(&g_active, false);
+    g_running = false;
+    pthread_cond_signal(&g_wake);
+    pthread_mutex_unlock(&g_lock);
+
+    pthread_join(g_aggregator, NULL);
+
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    for (size_t i = 0; i < g_capacity; i++) free(g_table[i]);
+    free(g_table);
+    g_table = NULL;
+    g_capacity = 0;
+    g_records = 0;
+    g_registered = 0;
+    g_heartbeats = 0;
+    pthread_mutex_unlock(&g_lock);
+}
+
+int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* spawn_location) {
+    if (!context || !atomic_load_explicit(&g_active, memory_order_relaxed)) return -1;
+
+    TelemetryRing* ring = thread_ring();
+    if (!ring) return -1;
+
+    rift_spawn_telemetry_t* telemetry = &context->telemetry;
+    if (telemetry->rift_thread_id == 0) {
+        telemetry->rift_thread_id = atomic_fetch_add_explicit(&g_next_id, 1,
+                                                              memory_order_relaxed);
+    }
+    if (telemetry->process_id == 0) telemetry->process_id = getpid();
+    if (telemetry->spawn_time.tv_sec == 0 && telemetry->spawn_time.tv_nsec == 0) {
+        clock_gettime(CLOCK_MONOTONIC, &telemetry->spawn_time);
+    }
+    if (spawn_location) {
+        snprintf(telemetry->spawn_location, sizeof(telemetry->spawn_location),
+                 "%s", spawn_location);
+    }
+    context->last_heartbeat = telemetry->spawn_time;
+
+    TelemetryEvent event = { EVENT_SPAWN, telemetry->rift_thread_id,
+                             telemetry->spawn_time, NULL };
+    event.spawn = malloc(sizeof(rift_spawn_telemetry_t));
+    if (!event.spawn) return -1;
+    *event.spawn = *telemetry;
+
+    /* Spawns are rare and must not be lost: wait for the aggregator */
+    while (!ring_push(ring, &event)) {
+        pthread_cond_signal(&g_wake);
+        sched_yield();
+    }
+    return 0;
+}
+
+int rift_telemetry_heartbeat(uint64_t rift_id) {
+    if (!atomic_load_explicit(&g_active, memory_order_relaxed)) return -1;
+
+    TelemetryRing* ring = thread_ring();
+    if (!ring) return -1;
+
+    TelemetryEvent event = { EVENT_HEARTBEAT, rift_id, { 0, 0 }, NULL };
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &event.when);
+
+    if (!ring_push(ring, &event)) {
+        uint64_t dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+        atomic_store_explicit(&ring->dropped, dropped + 1, memory_order_relaxed);
+    }
+    return 0;
+}
+
+rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id) {
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    TelemetryRecord* record = registry_find(rift_id);
+    rift_spawn_telemetry_t* telemetry = record && record->registered ? &record->telemetry : NULL;
+    pthread_mutex_unlock(&g_lock);
+    return telemetry;
+}
+
+bool rift_telemetry_last_heartbeat(uint64_t rift_id, struct timespec* when) {
+    bool found = false;
+
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    TelemetryRecord* record = registry_find(rift_id);
+    if (record && record->heartbeats > 0) {
+        if (when) *when = record->last_heartbeat;
+        found = true;
+    }
+    pthread_mutex_unlock(&g_lock);
+    return found;
+}
+
+bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy) {
+    if (!proposed_policy) return false;
+    if (parent_rift_id == 0) return true;
+
+    uint32_t max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    if (proposed_policy->max_children != 0 && proposed_policy->max_children < max_children) {
+        max_children = proposed_policy->max_children;
+    }
+    uint32_t max_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    if (proposed_policy->trace_capped && proposed_policy->max_hierarchy_depth != 0 &&
+        proposed_policy->max_hierarchy_depth < max_depth) {
+        max_depth = proposed_policy->max_hierarchy_depth;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    TelemetryRecord* parent = registry_find(parent_rift_id);
+    bool allowed = parent && parent->registered &&
+                   parent->telemetry.child_count < max_children &&
+                   parent->telemetry.hierarchy_depth + 1 < max_depth;
+    pthread_mutex_unlock(&g_lock);
+    return allowed;
+}
+
+void rift_telemetry_get_stats(rift_telemetry_stats_t* stats) {
+    if (!stats) return;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->threads = atomic_load(&g_ring_count);
+
+    TelemetryRing* ring = atomic_load_explicit(&g_rings, memory_order_acquire);
+    for (; ring; ring = ring->next) {
+        stats->dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+    }
+
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    stats->registered = g_registered;
+    stats->heartbeats = g_heartbeats;
+    pthread_mutex_unlock(&g_lock);
+}
+
+static int compare_records(const void* a, const void* b) {
+    uint64_t x = ((const TelemetryRecord*)a)->telemetry.rift_thread_id;
+    uint64_t y = ((const TelemetryRecord*)b)->telemetry.rift_thread_id;
+    return (x > y) - (x < y);
+}
+
+void rift_telemetry_print_report(void) {
+    rift_telemetry_stats_t stats;
+    rift_telemetry_get_stats(&stats);
+
+    /* Copy under the lock, print without it */
+    pthread_mutex_lock(&g_lock);
+    drain_all();
+    size_t count = 0;
+    TelemetryRecord* snapshot = g_records ? malloc(g_records * sizeof(TelemetryRecord)) : NULL;
+    for (size_t i = 0; snapshot && i < g_capacity; i++) {
+        if (g_table[i] && g_table[i]->registered) snapshot[count++] = *g_table[i];
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    printf("RIFT telemetry: %zu spawns, %llu heartbeats (%llu dropped), %zu reporting threads\n",
+           stats.registered, (unsigned long long)stats.heartbeats,
+           (unsigned long long)stats.dropped, stats.threads);
+
+    if (count > 1) qsort(snapshot, count, sizeof(TelemetryRecord), compare_records);
+    for (size_t i = 0; i < count; i++) {
+        const rift_spawn_telemetry_t* t = &snapshot[i].telemetry;
+        printf("  rift %llu\tparent %llu\tdepth %u\tchildren %u\tpid %d\theartbeats %llu\t%s%s\n",
+               (unsigned long long)t->rift_thread_id, (unsigned long long)t->parent_rift_id,
+               t->hierarchy_depth, t->child_count, (int)t->process_id,
+               (unsigned long long)snapshot[i].heartbeats, t->spawn_location,
+               t->is_daemon ? " (daemon)" : "");
+    }
+    free(snapshot);
+}
@@ -0,0 +1,637 @@
+/*
+ * =================================================================
+ * rift_workpool.c - RIFT-0 Work-Stealing Thread Pool
+ * RIFT: RIFT Is a Flexible Translator
+ * Stage: rift-0
+ * OBINexus Computing Framework - Technical Implementation
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "rift-0/core/rift_workpool.h"
+
+#define WORKPOOL_INITIAL_DEQUE 256
+
+#ifdef __linux__
+#define WORKPOOL_MAX_CPUS CPU_SETSIZE
+#else
+#define WORKPOOL_MAX_CPUS 1
+#endif
+
+typedef struct {
+    RiftTaskFn fn;
+    void* arg;
+    RiftTaskGroup* group;
+} WorkTask;
+
+/* Per-worker deque: owner uses the bottom, thieves take from the top */
+typedef struct {
+    _Alignas(64) pthread_mutex_t lock;
+    WorkTask* ring;
+    size_t capacity;            /* Power of two */
+    size_t top;
+    size_t bottom;
+
+    pthread_t thread;
+    RiftWorkPool* pool;
+    size_t index;
+    unsigned int rng;
+
+    /* Placement; home_node is fixed before the first task runs */
+#ifdef __linux__
+    cpu_set_t affinity;
+#endif
+    bool pinned;
+    atomic_int home_node;
+    atomic_size_t executed;
+    atomic_size_t remote;
+} WorkPoolWorker;
+
+struct RiftWorkPool {
+    WorkPoolWorker* workers;
+    size_t worker_count;
+    size_t started;             /* Workers with a running thread */
+
+    atomic_size_t queued;       /* Tasks sitting in any deque */
+    atomic_size_t sleepers;
+    atomic_uint next_inject;
+    atomic_bool shutdown;
+
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+
+    atomic_size_t executed;
+    atomic_size_t stolen;
+
+    RiftWorkerStartFn on_worker_start;
+    void* user_data;
+    short cpu_node[WORKPOOL_MAX_CPUS];  /* NUMA node of each CPU */
+};
+
+static _Thread_local WorkPoolWorker* t_worker;
+
+/* =================================================================
+ * TOPOLOGY AND PLACEMENT
+ * =================================================================
+ */
+
+static int node_of_cpu(const RiftWorkPool* pool, int cpu) {
+    if (cpu < 0 || cpu >= WORKPOOL_MAX_CPUS) return 0;
+    return pool->cpu_node[cpu];
+}
+
+static int current_node(const RiftWorkPool* pool) {
+#ifdef __linux__
+    return node_of_cpu(pool, sched_getcpu());
+#else
+    (void)pool;
+    return 0;
+#endif
+}
+
+#ifdef __linux__
+
+/* Kernel cpulist syntax: "0-3,8,10-11" */
+static int parse_cpu_list(const char* text, cpu_set_t* set) {
+    CPU_ZERO(set);
+    const char* p = text;
+
+    while (*p) {
+        while (*p == ',' || *p == ' ' || *p == '\n') p++;
+        if (!*p) break;
+
+        char* end;
+        long first = strtol(p, &end, 10);
+        if (end == p || first < 0) return -1;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            if (end == p + 1 || last < first) return -1;
+            p = end;
+        }
+        if (last >= CPU_SETSIZE) return -1;
+        if (*p && *p != ',' && *p != ' ' && *p != '\n') return -1;
+
+        for (long cpu = first; cpu <= last; cpu++) CPU_SET((int)cpu, set);
+    }
+    return 0;
+}
+
+/* Without sysfs every CPU stays on node 0 */
+static void load_numa_nodes(RiftWorkPool* pool) {
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (!dir) return;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        int node;
+        char tail;
+        if (sscanf(entry->d_name, "node%d%c", &node, &tail) != 1) continue;
+        if (node < 0 || node >= RIFT_WORKPOOL_MAX_NODES) continue;
+
+        char path[300];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/%s/cpulist", entry->d_name);
+        FILE* f = fopen(path, "r");
+        if (!f) continue;
+
+        char list[4096];
+        cpu_set_t cpus;
+        if (fgets(list, sizeof(list), f) && parse_cpu_list(list, &cpus) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &cpus)) pool->cpu_node[cpu] = (short)node;
+            }
+        }
+        fclose(f);
+    }
+    closedir(dir);
+}
+
+/* Allowed CPUs grouped by node, nodes and CPUs in ascending order */
+typedef struct {
+    int cpus[WORKPOOL_MAX_CPUS];
+    size_t cpu_count;
+    size_t node_start[RIFT_WORKPOOL_MAX_NODES + 1];
+    int node_id[RIFT_WORKPOOL_MAX_NODES];
+    size_t node_count;
+} CpuLayout;
+
+static int build_layout(const RiftWorkPool* pool, const rift_placement_policy_t* placement,
+                        CpuLayout* layout) {
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        CPU_ZERO(&allowed);
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        for (long cpu = 0; cpu < cpus && cpu < CPU_SETSIZE; cpu++) CPU_SET((int)cpu, &allowed);
+    }
+    if (placement->cpu_list[0]) {
+        cpu_set_t requested;
+        if (parse_cpu_list(placement->cpu_list, &requested) != 0) return -1;
+        CPU_AND(&allowed, &allowed, &requested);
+    }
+
+    memset(layout, 0, sizeof(*layout));
+    for (int node = 0; node < RIFT_WORKPOOL_MAX_NODES; node++) {
+        size_t start = layout->cpu_count;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed) && pool->cpu_node[cpu] == node) {
+                layout->cpus[layout->cpu_count++] = cpu;
+            }
+        }
+        if (layout->cpu_count > start) {
+            layout->node_start[layout->node_count] = start;
+            layout->node_id[layout->node_count++] = node;
+        }
+    }
+    layout->node_start[layout->node_count] = layout->cpu_count;
+
+    return layout->cpu_count > 0 ? 0 : -1;
+}
+
+static void place_worker(WorkPoolWorker* w, const CpuLayout* layout, rift_pin_policy_t policy) {
+    size_t i = w->index;
+    size_t nodes = layout->node_count;
+    CPU_ZERO(&w->affinity);
+
+    switch (policy) {
+    case PIN_NODE: {
+        size_t k = i % nodes;
+        for (size_t c = layout->node_start[k]; c < layout->node_start[k + 1]; c++) {
+            CPU_SET(layout->cpus[c], &w->affinity);
+        }
+        w->home_node = layout->node_id[k];
+        break;
+    }
+    case PIN_CORE_COMPACT: {
+        int cpu = layout->cpus[i % layout->cpu_count];
+        CPU_SET(cpu, &w->affinity);
+        w->home_node = node_of_cpu(w->pool, cpu);
+        break;
+    }
+    case PIN_CORE_SCATTER: {
+        size_t k = i % nodes;
+        size_t width = layout->node_start[k + 1] - layout->node_start[k];
+        int cpu = layout->cpus[layout->node_start[k] + (i / nodes) % width];
+        CPU_SET(cpu, &w->affinity);
+        w->home_node = layout->node_id[k];
+        break;
+    }
+    default:
+        return;
+    }
+    w->pinned = true;
+}
+
+#endif /* __linux__ */
+
+/* =================================================================
+ * DEQUE OPERATIONS
+ * =================================================================
+ */
+
+static int deque_push(WorkPoolWorker* w, WorkTask task) {
+    pthread_mutex_lock(&w->lock);
+
+    if (w->bottom - w->top == w->capacity) {
+        size_t new_capacity = w->capacity * 2;
+        WorkTask* ring = malloc(new_capacity * sizeof(WorkTask));
+        if (!ring) {
+            pthread_mutex_unlock(&w->lock);
+            return -1;
+        }
+        for (size_t i = w->top; i != w->bottom; i++) {
+            ring[i & (new_capacity - 1)] = w->ring[i & (w->capacity - 1)];
+        }
+        free(w->ring);
+        w->ring = ring;
+        w->capacity = new_capacity;
+    }
+
+    w->ring[w->bottom & (w->capacity - 1)] = task;
+    w->bottom++;
+
+    pthread_mutex_unlock(&w->lock);
+    return 0;
+}
+
+static bool deque_pop_bottom(WorkPoolWorker* w, WorkTask* task) {
+    bool found = false;
+
+    pthread_mutex_lock(&w->lock);
+    if (w->bottom != w->top) {
+        w->bottom--;
+        *task = w->ring[w->bottom & (w->capacity - 1)];
+        found = true;
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return found;
+}
+
+static bool deque_steal_top(WorkPoolWorker* w, WorkTask* task) {
+    bool found = false;
+
+    /* A busy victim is skipped rather than waited for */
+    if (pthread_mutex_trylock(&w->lock) != 0) return false;
+    if (w->bottom != w->top) {
+        *task = w->ring[w->top & (w->capacity - 1)];
+        w->top++;
+        found = true;
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return found;
+}
+
+/* =================================================================
+ * SCHEDULING
+ * =================================================================
+ */
+
+static unsigned int next_random(unsigned int* state) {
+    unsigned int x = *state ? *state : 0x9E3779B9u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static bool steal_task(RiftWorkPool* pool, size_t self, unsigned int* rng,
+                       WorkTask* task) {
+    size_t n = pool->worker_count;
+    size_t start = next_random(rng) % n;
+
+    for (size_t i = 0; i < n; i++) {
+        size_t victim = (start + i) % n;
+        if (victim == self) continue;
+        if (deque_steal_top(&pool->workers[victim], task)) {
+            atomic_fetch_add_explicit(&pool->stolen, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool find_task(RiftWorkPool* pool, WorkPoolWorker* self,
+                      unsigned int* rng, WorkTask* task) {
+    if (atomic_load(&pool->queued) == 0) return false;
+
+    bool found = self ? deque_pop_bottom(self, task) : false;
+    if (!found) {
+        found = steal_task(pool, self ? self->index : (size_t)-1, rng, task);
+    }
+    if (found) atomic_fetch_sub(&pool->queued, 1);
+    return found;
+}
+
+static void run_task(RiftWorkPool* pool, WorkTask* task) {
+    task->fn(task->arg);
+    atomic_fetch_add_explicit(&pool->executed, 1, memory_order_relaxed);
+
+    WorkPoolWorker* self = t_worker;
+    if (self && self->pool == pool) {
+        atomic_fetch_add_explicit(&self->executed, 1, memory_order_relaxed);
+        if (current_node(pool) != self->home_node) {
+            atomic_fetch_add_explicit(&self->remote, 1, memory_order_relaxed);
+        }
+    }
+
+    /* Decrement under the lock: a waiter that sees zero then takes the
+     * lock once, so it cannot destroy the group while we still use it */
+    RiftTaskGroup* group = task->group;
+    pthread_mutex_lock(&group->lock);
+    if (atomic_fetch_sub(&group->pending, 1) == 1) {
+        pthread_cond_broadcast(&group->done);
+    }
+    pthread_mutex_unlock(&group->lock);
+}
+
+static void* worker_main(void* arg) {
+    WorkPoolWorker* self = (WorkPoolWorker*)arg;
+    RiftWorkPool* pool = self->pool;
+    WorkTask task;
+
+    t_worker = self;
+
+    if (!self->pinned) self->home_node = current_node(pool);
+    if (pool->on_worker_start) {
+        pool->on_worker_start(self->index, self->home_node, pool->user_data);
+    }
+
+    while (!atomic_load(&pool->shutdown)) {
+        if (find_task(pool, self, &self->rng, &task)) {
+            run_task(pool, &task);
+            continue;
+        }
+
+        /* Announce sleep before re-checking so submit cannot miss us */
+        pthread_mutex_lock(&pool->idle_lock);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while (atomic_load(&pool->queued) == 0 && !atomic_load(&pool->shutdown)) {
+            pthread_cond_wait(&pool->idle_cond, &pool->idle_lock);
+        }
+        atomic_fetch_sub(&pool->sleepers, 1);
+        pthread_mutex_unlock(&pool->idle_lock);
+    }
+
+    return NULL;
+}
+
+/* =================================================================
+ * PUBLIC API
+ * =================================================================
+ */
+
+RiftWorkPool* rift_workpool_create(size_t worker_count) {
+    RiftWorkPoolConfig config;
+    memset(&config, 0, sizeof(config));
+    config.worker_count = worker_count;
+    config.placement.pin_policy = PIN_NONE;
+    return rift_workpool_create_with_config(&config);
+}
+
+static int start_worker(WorkPoolWorker* w) {
+#ifdef __linux__
+    if (w->pinned) {
+        /* Pin before the thread runs so even its stack is node-local */
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        int rc = pthread_attr_setaffinity_np(&attr, sizeof(w->affinity), &w->affinity);
+        if (rc == 0) rc = pthread_create(&w->thread, &attr, worker_main, w);
+        pthread_attr_destroy(&attr);
+        if (rc == 0) return 0;
+        w->pinned = false;
+    }
+#endif
+    return pthread_create(&w->thread, NULL, worker_main, w);
+}
+
+RiftWorkPool* rift_workpool_create_with_config(const RiftWorkPoolConfig* config) {
+    if (!config) return NULL;
+
+    RiftWorkPool* pool = calloc(1, sizeof(RiftWorkPool));
+    if (!pool) return NULL;
+    pool->on_worker_start = config->on_worker_start;
+    pool->user_data = config->user_data;
+
+    size_t worker_count = config->worker_count;
+#ifdef __linux__
+    load_numa_nodes(pool);
+
+    CpuLayout* layout = malloc(sizeof(CpuLayout));
+    if (!layout || build_layout(pool, &config->placement, layout) != 0) {
+        free(layout);
+        free(pool);
+        errno = EINVAL;
+        return NULL;
+    }
+    if (worker_count == 0) worker_count = layout->cpu_count;
+#else
+    if (worker_count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = cpus > 0 ? (size_t)cpus : 1;
+    }
+#endif
+
+    pool->workers = calloc(worker_count, sizeof(WorkPoolWorker));
+    if (!pool->workers) {
+#ifdef __linux__
+        free(layout);
+#endif
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->idle_lock, NULL);
+    pthread_cond_init(&pool->idle_cond, NULL);
+    pool->worker_count = worker_count;
+
+    for (size_t i = 0; i < worker_count; i++) {
+        WorkPoolWorker* w = &pool->workers[i];
+        pthread_mutex_init(&w->lock, NULL);
+        w->capacity = WORKPOOL_INITIAL_DEQUE;
+        w->ring = malloc(w->capacity * sizeof(WorkTask));
+        w->pool = pool;
+        w->index = i;
+        w->rng = (unsigned int)(i * 2654435761u + 1);
+        atomic_init(&w->executed, 0);
+        atomic_init(&w->remote, 0);
+#ifdef __linux__
+        place_worker(w, layout, config->placement.pin_policy);
+#endif
+        if (!w->ring) {
+#ifdef __linux__
+            free(layout);
+#endif
+            rift_workpool_destroy(pool);
+            return NULL;
+        }
+    }
+#ifdef __linux__
+    free(layout);
+#endif
+
+    for (size_t i = 0; i < worker_count; i++) {
+        if (start_worker(&pool->workers[i]) != 0) {
+            rift_workpool_destroy(pool);
+            return NULL;
+        }
+        pool->started++;
+    }
+
+    return pool;
+}
+
+/* Tasks still queued are discarded; wait on their groups first */
+void rift_workpool_destroy(RiftWorkPool* pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->idle_lock);
+    atomic_store(&pool->shutdown, true);
+    pthread_cond_broadcast(&pool->idle_cond);
+    pthread_mutex_unlock(&pool->idle_lock);
+
+    for (size_t i = 0; i < pool->started; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        pthread_mutex_destroy(&pool->workers[i].lock);
+        free(pool->workers[i].ring);
+    }
+
+    pthread_cond_destroy(&pool->idle_cond);
+    pthread_mutex_destroy(&pool->idle_lock);
+    free(pool->workers);
+    free(pool);
+}
+
+size_t rift_workpool_worker_count(const RiftWorkPool* pool) {
+    return pool ? pool->worker_count : 0;
+}
+
+int rift_workpool_current_worker(const RiftWorkPool* pool) {
+    if (!pool || !t_worker || t_worker->pool != pool) return -1;
+    return (int)t_worker->index;
+}
+
+int rift_workpool_worker_node(const RiftWorkPool* pool, size_t worker) {
+    if (!pool || worker >= pool->worker_count) return 0;
+    return pool->workers[worker].home_node;
+}
+
+void rift_task_group_init(RiftTaskGroup* group) {
+    if (!group) return;
+    atomic_init(&group->pending, 0);
+    pthread_mutex_init(&group->lock, NULL);
+    pthread_cond_init(&group->done, NULL);
+}
+
+void rift_task_group_destroy(RiftTaskGroup* group) {
+    if (!group) return;
+    pthread_cond_destroy(&group->done);
+    pthread_mutex_destroy(&group->lock);
+}
+
+int rift_workpool_submit(RiftWorkPool* pool, RiftTaskGroup* group,
+                         RiftTaskFn fn, void* arg) {
+    if (!pool || !group || !fn) return -1;
+
+    WorkPoolWorker* target;
+    if (t_worker && t_worker->pool == pool) {
+        target = t_worker;
+    } else {
+        unsigned int slot = atomic_fetch_add_explicit(&pool->next_inject, 1,
+                                                      memory_order_relaxed);
+        target = &pool->workers[slot % pool->worker_count];
+    }
+
+    /* Count before publishing: a thief that pops the task right away
+     * decrements queued, which must not go below zero */
+    WorkTask task = { fn, arg, group };
+    atomic_fetch_add(&group->pending, 1);
+    atomic_fetch_add(&pool->queued, 1);
+    if (deque_push(target, task) != 0) {
+        atomic_fetch_sub(&pool->queued, 1);
+        atomic_fetch_sub(&group->pending, 1);
+        return -1;
+    }
+
+    if (atomic_load(&pool->sleepers) > 0) {
+        pthread_mutex_lock(&pool->idle_lock);
+        pthread_cond_signal(&pool->idle_cond);
+        pthread_mutex_unlock(&pool->idle_lock);
+    }
+
+    return 0;
+}
+
+void rift_workpool_wait(RiftWorkPool* pool, RiftTaskGroup* group) {
+    if (!pool || !group) return;
+
+    WorkPoolWorker* self = (t_worker && t_worker->pool == pool) ? t_worker : NULL;
+    unsigned int rng = (unsigned int)(uintptr_t)group;
+    WorkTask task;
+
+    while (atomic_load(&group->pending) > 0) {
+        /* Help instead of idling; a worker must never block here */
+        if (find_task(pool, self, self ? &self->rng : &rng, &task)) {
+            run_task(pool, &task);
+            continue;
+        }
+
+        if (self) {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&group->lock);
+        while (atomic_load(&group->pending) > 0 && atomic_load(&pool->queued) == 0) {
+            pthread_cond_wait(&group->done, &group->lock);
+        }
+        pthread_mutex_unlock(&group->lock);
+    }
+
+    /* Let the task that finished last release the group */
+    pthread_mutex_lock(&group->lock);
+    pthread_mutex_unlock(&group->lock);
+}
+
+void rift_workpool_get_stats(const RiftWorkPool* pool, RiftWorkPoolStats* stats) {
+    if (!pool || !stats) return;
+
+    RiftWorkPool* p = (RiftWorkPool*)pool;
+    stats->worker_count = p->worker_count;
+    stats->executed = atomic_load(&p->executed);
+    stats->stolen = atomic_load(&p->stolen);
+}
+
+size_t rift_workpool_get_node_stats(const RiftWorkPool* pool,
+                                    RiftWorkPoolNodeStats* stats, size_t max_nodes) {
+    if (!pool || !stats) return 0;
+
+    size_t count = 0;
+    for (int node = 0; node < RIFT_WORKPOOL_MAX_NODES && count < max_nodes; node++) {
+        RiftWorkPoolNodeStats entry = { node, 0, 0, 0 };
+        for (size_t i = 0; i < pool->worker_count; i++) {
+            WorkPoolWorker* w = &pool->workers[i];
+            if (w->home_node != node) continue;
+            entry.workers++;
+            entry.executed += atomic_load(&w->executed);
+            entry.remote += atomic_load(&w->remote);
+        }
+        if (entry.workers > 0) stats[count++] = entry;
+    }
+    return count;
+}
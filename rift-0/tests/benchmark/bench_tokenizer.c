@@ -0,0 +1,102 @@
+/**
+ * =================================================================
+ * bench_tokenizer.c - RIFT-0 Tokenizer Scaling Benchmark
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Multi-context throughput of the tokenization stage
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ *
+ * Runs N threads, each driving its own tokenizer context, for
+ * N = 1, 2, 4, ... up to the online CPU count. With no shared lock
+ * on the processing path, throughput should scale with N.
+ */
+
+#include "rift-0/core/lexer/tokenizer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_ITERATIONS 200000
+#define BENCH_MAX_THREADS 64
+
+static const char* g_sample_input =
+    "let result = (x + y) * 42; /* RIFT tokenization benchmark */";
+
+typedef struct {
+    size_t iterations;
+    size_t completed;
+} BenchWorker;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* bench_worker(void* arg) {
+    BenchWorker* worker = (BenchWorker*)arg;
+    size_t input_size = strlen(g_sample_input);
+
+    rift_tokenizer_context_t* ctx = rift_tokenizer_init(NULL);
+    if (!ctx) return NULL;
+
+    for (size_t i = 0; i < worker->iterations; i++) {
+        void* output = NULL;
+        size_t output_size = 0;
+        if (rift_tokenizer_process(ctx, g_sample_input, input_size,
+                                   &output, &output_size) != RIFT_TOKENIZER_SUCCESS) {
+            break;
+        }
+        free(output);
+        worker->completed++;
+    }
+
+    rift_tokenizer_cleanup(ctx);
+    return NULL;
+}
+
+static double run_round(int thread_count) {
+    pthread_t threads[BENCH_MAX_THREADS];
+    BenchWorker workers[BENCH_MAX_THREADS];
+
+    double start = now_seconds();
+    for (int i = 0; i < thread_count; i++) {
+        workers[i].iterations = BENCH_ITERATIONS;
+        workers[i].completed = 0;
+        pthread_create(&threads[i], NULL, bench_worker, &workers[i]);
+    }
+
+    size_t total = 0;
+    for (int i = 0; i < thread_count; i++) {
+        pthread_join(threads[i], NULL);
+        total += workers[i].completed;
+    }
+    double elapsed = now_seconds() - start;
+
+    return elapsed > 0 ? total / elapsed : 0;
+}
+
+int main(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = cpus > 0 ? (int)cpus : 1;
+    if (max_threads > BENCH_MAX_THREADS) max_threads = BENCH_MAX_THREADS;
+
+    printf("=================================================================\n");
+    printf("RIFT-0 Tokenizer Scaling Benchmark (%s)\n", rift_tokenizer_version());
+    printf("Online CPUs: %d, iterations per thread: %d\n", max_threads, BENCH_ITERATIONS);
+    printf("=================================================================\n");
+
+    double baseline = 0;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double rate = run_round(threads);
+        if (threads == 1) baseline = rate;
+        printf("Threads: %2d  %12.0f ops/s  scaling %.2fx\n",
+               threads, rate, baseline > 0 ? rate / baseline : 0.0);
+        if (rate <= 0) return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * =================================================================
+ * test_block_prescan.c - RIFT-0 Block Prescan Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Splitting sources into independently parsable blocks
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/block_prescan.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_functions_and_sections(void);
+static bool test_strings_and_comments(void);
+static bool test_nested_and_else(void);
+static bool test_unbalanced(void);
+static bool test_generated_source(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Block Prescan Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Functions And Sections", test_functions_and_sections);
+    run_test("Strings And Comments", test_strings_and_comments);
+    run_test("Nested Blocks And Else", test_nested_and_else);
+    run_test("Unbalanced Input", test_unbalanced);
+    run_test("Generated Source", test_generated_source);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/* The spans must tile the input in order */
+static bool covers(const RiftBlockList* list, size_t length) {
+    size_t at = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        if (list->spans[i].start != at || list->spans[i].end <= at) return false;
+        at = list->spans[i].end;
+    }
+    return at == length;
+}
+
+static bool block_is(const char* input, const RiftBlockList* list, size_t i, const char* text) {
+    size_t length = list->spans[i].end - list->spans[i].start;
+    return length == strlen(text) && memcmp(input + list->spans[i].start, text, length) == 0;
+}
+
+/**
+ * Test: top-level functions, @quantum blocks and ! sections split
+ */
+static bool test_functions_and_sections(void) {
+    const char* input =
+        "!classic\n"
+        "x = 42\n"
+        "function calculate(a, b) {\n"
+        "    return a + b * 2\n"
+        "}\n"
+        "\n"
+        "!quantum\n"
+        "@quantum {\n"
+        "    H(qreg)\n"
+        "}\n"
+        "!collapse\n"
+        "m = measure(qreg)\n";
+    RiftBlockList list = {0};
+
+    TEST_ASSERT(rift_block_prescan(input, strlen(input), &list) == 0, "Prescan");
+    TEST_ASSERT(covers(&list, strlen(input)), "Blocks tile the input");
+    TEST_ASSERT(list.count == 4, "Four blocks");
+    TEST_ASSERT(block_is(input, &list, 0,
+                "!classic\nx = 42\nfunction calculate(a, b) {\n    return a + b * 2\n}\n"),
+                "Section with its function");
+    TEST_ASSERT(block_is(input, &list, 1, "\n"), "Blank line before the directive");
+    TEST_ASSERT(block_is(input, &list, 2, "!quantum\n@quantum {\n    H(qreg)\n}\n"),
+                "Quantum block");
+    TEST_ASSERT(block_is(input, &list, 3, "!collapse\nm = measure(qreg)\n"), "Trailing section");
+
+    rift_block_list_free(&list);
+    TEST_PASS("Functions and sections");
+}
+
+/**
+ * Test: braces inside strings and comments do not count
+ */
+static bool test_strings_and_comments(void) {
+    const char* input =
+        "a {\n"
+        "  s = \"}\\\"}\"  // }\n"
+        "  /* } \n } */\n"
+        "}\n"
+        "// { not a block\n"
+        "b { }\n";
+    RiftBlockList list = {0};
+
+    TEST_ASSERT(rift_block_prescan(input, strlen(input), &list) == 0, "Prescan");
+    TEST_ASSERT(covers(&list, strlen(input)), "Blocks tile the input");
+    TEST_ASSERT(list.count == 2, "Two blocks");
+    TEST_ASSERT(block_is(input, &list, 1, "// { not a block\nb { }\n"), "Comment joins next block");
+
+    rift_block_list_free(&list);
+    TEST_PASS("Strings and comments");
+}
+
+/**
+ * Test: inner blocks and } else { keep one unit together
+ */
+static bool test_nested_and_else(void) {
+    const char* input =
+        "if (m == 0) {\n"
+        "    circuit { H(q1) }\n"
+        "} else {\n"
+        "    out = 1\n"
+        "}\n"
+        "try { r = measure(q1) }\n";
+    RiftBlockList list = {0};
+
+    TEST_ASSERT(rift_block_prescan(input, strlen(input), &list) == 0, "Prescan");
+    TEST_ASSERT(covers(&list, strlen(input)), "Blocks tile the input");
+    TEST_ASSERT(list.count == 2, "If/else and try");
+    TEST_ASSERT(block_is(input, &list, 1, "try { r = measure(q1) }\n"), "Try block");
+
+    rift_block_list_free(&list);
+    TEST_PASS("Nested blocks and else");
+}
+
+/**
+ * Test: an unclosed brace keeps the rest together; a stray quote
+ * ends at its line
+ */
+static bool test_unbalanced(void) {
+    const char* input = "a { }\nb {\nc { }\n!classic\n";
+    RiftBlockList list = {0};
+
+    TEST_ASSERT(rift_block_prescan(input, strlen(input), &list) == 0, "Prescan");
+    TEST_ASSERT(list.count == 2 && covers(&list, strlen(input)), "Open brace swallows the rest");
+
+    const char* quote = "x = \"open\ny { }\nz { }\n";
+    TEST_ASSERT(rift_block_prescan(quote, strlen(quote), &list) == 0, "Prescan");
+    TEST_ASSERT(list.count == 2 && covers(&list, strlen(quote)), "Quote ends at the newline");
+
+    TEST_ASSERT(rift_block_prescan("", 0, &list) == 0 && list.count == 0, "Empty input");
+
+    rift_block_list_free(&list);
+    TEST_PASS("Unbalanced input");
+}
+
+#define GENERATED_FUNCTIONS 5000
+
+/**
+ * Test: one block per generated function; the SIMD and tail paths
+ * agree at every alignment
+ */
+static bool test_generated_source(void) {
+    const char* unit = "function f(a) {\n    x = \"{\" // }\n    return a\n}\n";
+    size_t unit_length = strlen(unit);
+    size_t length = unit_length * GENERATED_FUNCTIONS;
+    char* input = malloc(length + 1);
+    TEST_ASSERT(input != NULL, "Allocation");
+    for (size_t i = 0; i < GENERATED_FUNCTIONS; i++) {
+        memcpy(input + i * unit_length, unit, unit_length);
+    }
+    input[length] = '\0';
+
+    RiftBlockList list = {0};
+    TEST_ASSERT(rift_block_prescan(input, length, &list) == 0, "Prescan");
+    TEST_ASSERT(list.count == GENERATED_FUNCTIONS, "One block per function");
+    TEST_ASSERT(covers(&list, length), "Blocks tile the input");
+
+    for (size_t skip = 1; skip < 17; skip++) {
+        TEST_ASSERT(rift_block_prescan(input + skip * unit_length, 3 * unit_length, &list) == 0 &&
+                    list.count == 3, "Any window of whole functions");
+        TEST_ASSERT(rift_block_prescan(input + skip, unit_length - skip, &list) == 0 &&
+                    covers(&list, unit_length - skip), "Partial unit");
+    }
+
+    rift_block_list_free(&list);
+    free(input);
+    TEST_PASS("Generated source");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,205 @@
+/**
+ * =================================================================
+ * test_context_pool.c - RIFT-0 Context Pool Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Bounded reuse of stage contexts
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_prewarm_and_reuse(void);
+static bool test_bounded_size(void);
+static bool test_release_resets_state(void);
+static bool test_concurrent_acquire_release(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Context Pool Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Prewarm And Reuse", test_prewarm_and_reuse);
+    run_test("Bounded Size", test_bounded_size);
+    run_test("Release Resets State", test_release_resets_state);
+    run_test("Concurrent Acquire/Release", test_concurrent_acquire_release);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/**
+ * Test: prewarmed contexts are handed out without new allocations
+ */
+static bool test_prewarm_and_reuse(void) {
+    RiftContextPoolConfig config = { 8, 4, 0, NULL };
+    RiftContextPool* pool = rift_context_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    RiftContextPoolStats stats;
+    rift_context_pool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.created == 4 && stats.idle == 4, "Prewarmed contexts idle");
+
+    RiftStage0Context* ctx = rift_context_pool_acquire(pool);
+    TEST_ASSERT(ctx != NULL, "Acquire succeeds");
+    rift_context_pool_release(pool, ctx);
+
+    RiftStage0Context* again = rift_context_pool_acquire(pool);
+    TEST_ASSERT(again == ctx, "Same thread gets its released context back");
+    rift_context_pool_release(pool, again);
+
+    rift_context_pool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.created == 4, "No context created after prewarm");
+    TEST_ASSERT(stats.reused == 2, "Both acquires reused");
+
+    rift_context_pool_destroy(pool);
+    TEST_PASS("Prewarm and reuse");
+}
+
+/**
+ * Test: acquire refuses once max_contexts are checked out
+ */
+static bool test_bounded_size(void) {
+    RiftContextPoolConfig config = { 3, 0, 0, NULL };
+    RiftContextPool* pool = rift_context_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    RiftStage0Context* held[3];
+    for (int i = 0; i < 3; i++) {
+        held[i] = rift_context_pool_acquire(pool);
+        TEST_ASSERT(held[i] != NULL, "Acquire within bound");
+    }
+    TEST_ASSERT(rift_context_pool_acquire(pool) == NULL, "Acquire beyond bound fails");
+
+    RiftContextPoolStats stats;
+    rift_context_pool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.live == 3 && stats.exhausted == 1, "Exhaustion recorded");
+
+    for (int i = 0; i < 3; i++) {
+        rift_context_pool_release(pool, held[i]);
+    }
+    TEST_ASSERT((held[0] = rift_context_pool_acquire(pool)) != NULL,
+                "Acquire succeeds after release");
+    rift_context_pool_release(pool, held[0]);
+
+    rift_context_pool_destroy(pool);
+    TEST_PASS("Bounded size");
+}
+
+/**
+ * Test: a released context carries no state into the next request
+ */
+static bool test_release_resets_state(void) {
+    RiftContextPoolConfig config = { 1, 1, 0, NULL };
+    RiftContextPool* pool = rift_context_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    RiftStage0Context* ctx = rift_context_pool_acquire(pool);
+    TEST_ASSERT(ctx != NULL, "Acquire succeeds");
+    ctx->has_error = true;
+    ctx->debug_mode = true;
+    ctx->stats.tokens_processed = 99;
+    snprintf(ctx->error_message, sizeof(ctx->error_message), "stale");
+    rift_context_pool_release(pool, ctx);
+
+    ctx = rift_context_pool_acquire(pool);
+    TEST_ASSERT(ctx != NULL, "Reacquire succeeds");
+    TEST_ASSERT(!ctx->has_error && ctx->error_message[0] == '\0', "Error cleared");
+    TEST_ASSERT(!ctx->debug_mode && ctx->strict_mode, "Defaults restored");
+    TEST_ASSERT(ctx->stats.tokens_processed == 0, "Statistics cleared");
+    rift_context_pool_release(pool, ctx);
+
+    rift_context_pool_destroy(pool);
+    TEST_PASS("Release resets state");
+}
+
+static void* pool_worker(void* arg) {
+    RiftContextPool* pool = (RiftContextPool*)arg;
+    for (int i = 0; i < 10000; i++) {
+        RiftStage0Context* ctx = rift_context_pool_acquire(pool);
+        if (ctx) rift_context_pool_release(pool, ctx);
+    }
+    return NULL;
+}
+
+/**
+ * Test: many threads cycling contexts never exceed the bound
+ */
+static bool test_concurrent_acquire_release(void) {
+    RiftContextPoolConfig config = { 4, 2, 0, NULL };
+    RiftContextPool* pool = rift_context_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    pthread_t threads[8];
+    for (int i = 0; i < 8; i++) {
+        pthread_create(&threads[i], NULL, pool_worker, pool);
+    }
+    for (int i = 0; i < 8; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    RiftContextPoolStats stats;
+    rift_context_pool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.created <= 4, "Never more than max_contexts created");
+    TEST_ASSERT(stats.live == stats.idle, "Every context returned");
+
+    rift_context_pool_destroy(pool);
+    TEST_PASS("Concurrent acquire/release");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
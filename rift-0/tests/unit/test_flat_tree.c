@@ -0,0 +1,364 @@
+/**
+ * =================================================================
+ * test_flat_tree.c - RIFT-0 Flat Parse Tree Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Contiguous pre-order parse trees
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/flat_tree.h"
+#include "rift-0/core/parser/rift_grammar.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_postorder_to_preorder(void);
+static bool test_visitor(void);
+static bool test_malformed_append(void);
+static bool test_grammar_tree(void);
+static bool test_deep_tree(void);
+static bool test_splice(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Flat Parse Tree Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Post-Order To Pre-Order", test_postorder_to_preorder);
+    run_test("Visitor", test_visitor);
+    run_test("Malformed Append", test_malformed_append);
+    run_test("Grammar Tree", test_grammar_tree);
+    run_test("Deep Tree", test_deep_tree);
+    run_test("Splice", test_splice);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/* A(B(c, d), e, F(g)) appended bottom-up; kinds are the letters */
+static FlatTree* sample_tree(void) {
+    FlatTree* tree = flat_tree_create(2);
+    if (!tree) return NULL;
+    flat_tree_append(tree, 'c', 1, 0, 1);
+    flat_tree_append(tree, 'd', 1, 1, 2);
+    flat_tree_append(tree, 'B', 3, 0, 2);
+    flat_tree_append(tree, 'e', 1, 2, 3);
+    flat_tree_append(tree, 'g', 1, 3, 4);
+    flat_tree_append(tree, 'F', 2, 3, 4);
+    flat_tree_append(tree, 'A', 7, 0, 4);
+    return flat_tree_finish(tree) ? tree : NULL;
+}
+
+/**
+ * Test: finishing lays nodes out in pre-order with parents and siblings
+ */
+static bool test_postorder_to_preorder(void) {
+    FlatTree* tree = sample_tree();
+    TEST_ASSERT(tree != NULL, "Tree built");
+    TEST_ASSERT(tree->count == 7 && tree->finished, "Seven nodes, finished");
+
+    const char* expected = "ABcdeFg";
+    for (uint32_t i = 0; i < 7; i++) {
+        TEST_ASSERT(tree->kinds[i] == (uint32_t)expected[i], "Pre-order kinds");
+    }
+
+    TEST_ASSERT(tree->nodes[0].parent == FLAT_TREE_NONE, "Root has no parent");
+    TEST_ASSERT(tree->nodes[1].parent == 0 && tree->nodes[4].parent == 0 &&
+                tree->nodes[5].parent == 0, "Children of A");
+    TEST_ASSERT(tree->nodes[2].parent == 1 && tree->nodes[3].parent == 1, "Children of B");
+    TEST_ASSERT(tree->nodes[6].parent == 5, "Child of F");
+
+    TEST_ASSERT(flat_tree_first_child(tree, 0) == 1, "A's first child");
+    TEST_ASSERT(flat_tree_next_sibling(tree, 1) == 4, "B then e");
+    TEST_ASSERT(flat_tree_next_sibling(tree, 4) == 5, "e then F");
+    TEST_ASSERT(flat_tree_next_sibling(tree, 5) == FLAT_TREE_NONE, "F is last");
+    TEST_ASSERT(flat_tree_next_sibling(tree, 3) == FLAT_TREE_NONE, "d is last under B");
+    TEST_ASSERT(flat_tree_first_child(tree, 4) == FLAT_TREE_NONE, "e is a leaf");
+    TEST_ASSERT(tree->nodes[5].first_token == 3 && tree->nodes[5].end_token == 4, "Spans kept");
+
+    flat_tree_destroy(tree);
+    TEST_PASS("Post-order to pre-order");
+}
+
+typedef struct {
+    char trace[64];
+    size_t length;
+    char skip;
+    char stop;
+} Trace;
+
+static FlatTreeVisit trace_enter(const FlatTree* tree, uint32_t node, void* user_data) {
+    Trace* t = (Trace*)user_data;
+    char kind = (char)tree->kinds[node];
+    t->trace[t->length++] = kind;
+    if (kind == t->stop) return FLAT_TREE_STOP;
+    return kind == t->skip ? FLAT_TREE_SKIP : FLAT_TREE_CONTINUE;
+}
+
+static void trace_leave(const FlatTree* tree, uint32_t node, void* user_data) {
+    Trace* t = (Trace*)user_data;
+    t->trace[t->length++] = '/';
+    t->trace[t->length++] = (char)tree->kinds[node];
+}
+
+/**
+ * Test: enter and leave bracket every subtree; skip and stop honoured
+ */
+static bool test_visitor(void) {
+    FlatTree* tree = sample_tree();
+    TEST_ASSERT(tree != NULL, "Tree built");
+
+    Trace t = { .skip = 0, .stop = 0 };
+    flat_tree_visit(tree, 0, trace_enter, trace_leave, &t);
+    t.trace[t.length] = '\0';
+    TEST_ASSERT(strcmp(t.trace, "ABc/cd/d/Be/eFg/g/F/A") == 0, "Full walk");
+
+    t = (Trace){ .skip = 'B', .stop = 0 };
+    flat_tree_visit(tree, 0, trace_enter, trace_leave, &t);
+    t.trace[t.length] = '\0';
+    TEST_ASSERT(strcmp(t.trace, "AB/Be/eFg/g/F/A") == 0, "Skipped subtree");
+
+    t = (Trace){ .skip = 0, .stop = 'e' };
+    flat_tree_visit(tree, 0, trace_enter, trace_leave, &t);
+    t.trace[t.length] = '\0';
+    TEST_ASSERT(strcmp(t.trace, "ABc/cd/d/Be") == 0, "Stopped walk");
+
+    t = (Trace){ .skip = 0, .stop = 0 };
+    flat_tree_visit(tree, 5, trace_enter, trace_leave, &t);
+    t.trace[t.length] = '\0';
+    TEST_ASSERT(strcmp(t.trace, "Fg/g/F") == 0, "Walk of a subtree");
+
+    flat_tree_destroy(tree);
+    TEST_PASS("Visitor");
+}
+
+/**
+ * Test: a node must cover whole subtrees already appended
+ */
+static bool test_malformed_append(void) {
+    FlatTree* tree = flat_tree_create(0);
+    TEST_ASSERT(tree != NULL, "Tree creation");
+
+    TEST_ASSERT(flat_tree_append(tree, 'x', 2, 0, 1) == FLAT_TREE_NONE, "Missing child");
+    TEST_ASSERT(flat_tree_append(tree, 'a', 1, 0, 1) == 0, "Leaf");
+    TEST_ASSERT(flat_tree_append(tree, 'b', 1, 1, 2) == 1, "Leaf");
+    TEST_ASSERT(flat_tree_append(tree, 'P', 2, 0, 2) == 2, "Parent of b");
+    TEST_ASSERT(flat_tree_append(tree, 'Q', 2, 1, 2) == FLAT_TREE_NONE,
+                "Cannot split P's subtree");
+    TEST_ASSERT(flat_tree_append(tree, 'Q', 0, 0, 2) == FLAT_TREE_NONE, "Empty subtree");
+
+    /* Two roots form a forest */
+    TEST_ASSERT(flat_tree_finish(tree), "Finish");
+    TEST_ASSERT(tree->kinds[0] == 'a' && tree->kinds[1] == 'P' && tree->kinds[2] == 'b',
+                "Forest in order");
+    TEST_ASSERT(flat_tree_next_sibling(tree, 0) == 1, "Roots are siblings");
+    TEST_ASSERT(flat_tree_append(tree, 'z', 1, 0, 1) == FLAT_TREE_NONE, "Finished is read-only");
+
+    flat_tree_clear(tree);
+    TEST_ASSERT(tree->count == 0 && !tree->finished, "Cleared");
+
+    flat_tree_destroy(tree);
+    TEST_PASS("Malformed append");
+}
+
+enum { NUM, PLUS, STAR, LPAREN, RPAREN, WS };
+
+typedef struct {
+    const int* digits;
+    long values[64];
+    size_t depth;
+} TreeEvaluator;
+
+/* Productions in order: expr+term, term, term*factor, factor, (expr), NUM */
+static void evaluate_leave(const FlatTree* tree, uint32_t node, void* user_data) {
+    TreeEvaluator* e = (TreeEvaluator*)user_data;
+    if (flat_tree_is_terminal(tree, node)) {
+        if ((tree->kinds[node] & ~FLAT_TREE_TERMINAL) == NUM) {
+            e->values[e->depth++] = e->digits[tree->nodes[node].first_token];
+        }
+        return;
+    }
+    switch (tree->kinds[node]) {
+        case 0: e->depth--; e->values[e->depth - 1] += e->values[e->depth]; break;
+        case 2: e->depth--; e->values[e->depth - 1] *= e->values[e->depth]; break;
+        default: break;
+    }
+}
+
+/**
+ * Test: the grammar's tree evaluates to the same value as the source
+ */
+static bool test_grammar_tree(void) {
+    RiftGrammar* g = rift_grammar_create();
+    TEST_ASSERT(g != NULL, "Grammar creation");
+    rift_grammar_add_terminal(g, "NUM", NUM);
+    rift_grammar_add_terminal(g, "PLUS", PLUS);
+    rift_grammar_add_terminal(g, "STAR", STAR);
+    rift_grammar_add_terminal(g, "LPAREN", LPAREN);
+    rift_grammar_add_terminal(g, "RPAREN", RPAREN);
+    TEST_ASSERT(rift_grammar_add_rules(g,
+                "expr   : expr PLUS term | term ;\n"
+                "term   : term STAR factor | factor ;\n"
+                "factor : LPAREN expr RPAREN | NUM ;\n") == 6, "Rules");
+    TEST_ASSERT(rift_grammar_build(g) == 0, "Build");
+
+    /* 2 * (3 + 4) + 5, with a skipped blank */
+    uint32_t types[] = { NUM, STAR, LPAREN, NUM, PLUS, NUM, RPAREN, WS, PLUS, NUM };
+    int digits[] = { 2, 0, 0, 3, 0, 4, 0, 0, 0, 5 };
+    size_t count = sizeof(types) / sizeof(types[0]);
+
+    FlatTree* tree = flat_tree_create(0);
+    TEST_ASSERT(tree != NULL, "Tree creation");
+    size_t error = 0;
+    TEST_ASSERT(rift_grammar_parse_tree(g, types, count, NULL, NULL, tree, &error) == 0, "Accepted");
+    TEST_ASSERT(tree->finished, "Tree finished");
+    TEST_ASSERT(tree->kinds[0] == 0 && tree->nodes[0].subtree_size == tree->count, "Root is expr");
+    TEST_ASSERT(tree->nodes[0].first_token == 0 && tree->nodes[0].end_token == count, "Root spans all");
+
+    /* Leaves appear in token order and skip the blank */
+    uint32_t expected_leaf = 0;
+    size_t leaves = 0;
+    for (uint32_t i = 0; i < tree->count; i++) {
+        if (!flat_tree_is_terminal(tree, i)) continue;
+        if (expected_leaf == 7) expected_leaf++;
+        TEST_ASSERT(tree->nodes[i].first_token == expected_leaf, "Leaf order");
+        TEST_ASSERT((tree->kinds[i] & ~FLAT_TREE_TERMINAL) == types[expected_leaf], "Leaf type");
+        expected_leaf++;
+        leaves++;
+    }
+    TEST_ASSERT(leaves == count - 1, "One leaf per bound token");
+
+    TreeEvaluator e = { .digits = digits, .depth = 0 };
+    flat_tree_visit(tree, 0, NULL, evaluate_leave, &e);
+    TEST_ASSERT(e.depth == 1 && e.values[0] == 19, "Tree evaluates to 19");
+
+    uint32_t bad[] = { NUM, PLUS, PLUS, NUM };
+    TEST_ASSERT(rift_grammar_parse_tree(g, bad, 4, NULL, NULL, tree, &error) == -1, "Rejected");
+    TEST_ASSERT(error == 2 && !tree->finished, "Error token, tree left unfinished");
+
+    flat_tree_destroy(tree);
+    rift_grammar_destroy(g);
+    TEST_PASS("Grammar tree");
+}
+
+static FlatTreeVisit count_enter(const FlatTree* tree, uint32_t node, void* user_data) {
+    (void)tree;
+    (void)node;
+    (*(size_t*)user_data)++;
+    return FLAT_TREE_CONTINUE;
+}
+
+#define DEEP_NODES 200000
+
+/**
+ * Test: a very deep chain finishes and walks without recursion
+ */
+static bool test_deep_tree(void) {
+    FlatTree* tree = flat_tree_create(16);
+    TEST_ASSERT(tree != NULL, "Tree creation");
+
+    for (uint32_t i = 1; i <= DEEP_NODES; i++) {
+        TEST_ASSERT(flat_tree_append(tree, i, i, 0, 1) == i - 1, "Chain link");
+    }
+    TEST_ASSERT(flat_tree_finish(tree), "Finish");
+    TEST_ASSERT(tree->kinds[0] == DEEP_NODES && tree->kinds[DEEP_NODES - 1] == 1,
+                "Outermost first");
+    TEST_ASSERT(tree->nodes[DEEP_NODES - 1].parent == DEEP_NODES - 2, "Parent links");
+
+    size_t entered = 0;
+    flat_tree_visit(tree, 0, count_enter, NULL, &entered);
+    TEST_ASSERT(entered == DEEP_NODES, "Every node visited");
+
+    flat_tree_destroy(tree);
+    TEST_PASS("Deep tree");
+}
+
+/**
+ * Test: finished forests stitch into one with shifted indices
+ */
+static bool test_splice(void) {
+    FlatTree* piece = sample_tree();
+    FlatTree* whole = flat_tree_create(2);
+    TEST_ASSERT(piece != NULL && whole != NULL, "Trees built");
+
+    TEST_ASSERT(flat_tree_splice(whole, piece, 0), "First piece");
+    TEST_ASSERT(flat_tree_splice(whole, piece, 10), "Second piece");
+    TEST_ASSERT(whole->count == 14 && whole->finished, "Fourteen nodes, finished");
+
+    TEST_ASSERT(whole->nodes[0].parent == FLAT_TREE_NONE &&
+                whole->nodes[7].parent == FLAT_TREE_NONE, "Two roots");
+    TEST_ASSERT(whole->nodes[13].parent == 12 && whole->nodes[8].parent == 7, "Parents shifted");
+    TEST_ASSERT(whole->nodes[12].first_token == 13 && whole->nodes[12].end_token == 14,
+                "Token spans shifted");
+    TEST_ASSERT(whole->kinds[7] == 'A' && whole->kinds[13] == 'g', "Kinds copied");
+    TEST_ASSERT(flat_tree_next_sibling(whole, 0) == 7, "Roots are siblings");
+
+    size_t entered = 0;
+    flat_tree_visit(whole, 7, count_enter, NULL, &entered);
+    TEST_ASSERT(entered == 7, "Second root walks its own subtree");
+
+    /* A tree still being appended to cannot take a forest */
+    FlatTree* open = flat_tree_create(0);
+    TEST_ASSERT(open != NULL, "Open tree");
+    flat_tree_append(open, 'x', 1, 0, 1);
+    TEST_ASSERT(!flat_tree_splice(open, piece, 0), "Unfinished tree refused");
+
+    flat_tree_destroy(open);
+    flat_tree_destroy(whole);
+    flat_tree_destroy(piece);
+    TEST_PASS("Splice");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,424 @@
+/**
+ * =================================================================
+ * test_gov_cache.c - RIFT-0 Governance Cache Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Stat-validated cache of parsed governance records
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/gov/gov_cache.h"
+#include "rift-0/core/rift_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+static char g_cache_dir[256];
+
+/* Forward declarations */
+static bool test_parse_once(void);
+static bool test_content_change(void);
+static bool test_touch_keeps_record(void);
+static bool test_recent_write_rehashes(void);
+static bool test_failures_not_cached(void);
+static bool test_cache_file(void);
+static bool test_loaded_records_validated(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+static void remove_cache_dir(void);
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Governance Cache Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    snprintf(g_cache_dir, sizeof(g_cache_dir), "/tmp/rift-gov-cache-%ld", (long)getpid());
+    mkdir(g_cache_dir, 0755);
+
+    run_test("Parse Once", test_parse_once);
+    run_test("Content Change", test_content_change);
+    run_test("Touch Keeps Record", test_touch_keeps_record);
+    run_test("Recent Write Rehashes", test_recent_write_rehashes);
+    run_test("Failures Not Cached", test_failures_not_cached);
+    run_test("Cache File", test_cache_file);
+    run_test("Loaded Records Validated", test_loaded_records_validated);
+
+    remove_cache_dir();
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+typedef struct {
+    char name[32];
+    int value;
+} TestRecord;
+
+/* "name value"; a negative value is a schema error */
+static int parse_record(const char* content, size_t length, void* record, void* user_data) {
+    TestRecord* r = (TestRecord*)record;
+    (void)length;
+    (*(int*)user_data)++;
+    memset(r, 0, sizeof(*r));
+    if (sscanf(content, "%31s %d", r->name, &r->value) != 2) return 1;
+    return r->value < 0 ? 7 : 0;
+}
+
+static void config_path(const char* name, char* path, size_t size) {
+    snprintf(path, size, "%s/%s", g_cache_dir, name);
+}
+
+/* Write a configuration last modified `age` seconds ago */
+static bool write_config(const char* path, const char* content, time_t age) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fputs(content, f);
+    fclose(f);
+
+    struct timespec times[2];
+    clock_gettime(CLOCK_REALTIME, &times[0]);
+    times[0].tv_sec -= age;
+    times[1] = times[0];
+    return utimensat(AT_FDCWD, path, times, 0) == 0;
+}
+
+/**
+ * Test: an unchanged file is parsed once and then served from its stat
+ */
+static bool test_parse_once(void) {
+    char path[512];
+    config_path("parse_once", path, sizeof(path));
+    TEST_ASSERT(write_config(path, "alpha 1", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    TEST_ASSERT(cache != NULL, "Cache created");
+
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Cold get parses");
+    TEST_ASSERT(parses == 1 && strcmp(record.name, "alpha") == 0 && record.value == 1,
+                "Record parsed");
+
+    memset(&record, 0, sizeof(record));
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Warm get");
+    TEST_ASSERT(parses == 1, "Not parsed again");
+    TEST_ASSERT(strcmp(record.name, "alpha") == 0 && record.value == 1, "Same record");
+
+    RiftGovCacheStats stats;
+    rift_gov_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.stat_hits == 1 && stats.content_hits == 0 && stats.parses == 1 &&
+                stats.entries == 1, "Answered from the stat");
+
+    rift_gov_cache_destroy(cache);
+    TEST_PASS("Parse once");
+}
+
+/**
+ * Test: new contents are parsed again
+ */
+static bool test_content_change(void) {
+    char path[512];
+    config_path("content_change", path, sizeof(path));
+    TEST_ASSERT(write_config(path, "alpha 1", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "First parse");
+
+    /* Same size, so only the mtime and the contents tell */
+    TEST_ASSERT(write_config(path, "alpha 2", 50), "Config rewritten");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Second get");
+    TEST_ASSERT(parses == 2 && record.value == 2, "Parsed again");
+
+    rift_gov_cache_destroy(cache);
+    TEST_PASS("Content change");
+}
+
+/**
+ * Test: a new mtime over the same bytes costs a hash, not a parse
+ */
+static bool test_touch_keeps_record(void) {
+    char path[512];
+    config_path("touch", path, sizeof(path));
+    TEST_ASSERT(write_config(path, "beta 3", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "First parse");
+
+    TEST_ASSERT(write_config(path, "beta 3", 50), "Config touched");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Get after touch");
+    TEST_ASSERT(parses == 1 && record.value == 3, "Not parsed again");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Get again");
+
+    RiftGovCacheStats stats;
+    rift_gov_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.content_hits == 1 && stats.stat_hits == 1, "Hash once, then stat");
+
+    rift_gov_cache_destroy(cache);
+    TEST_PASS("Touch keeps record");
+}
+
+/**
+ * Test: a file written just now is never trusted on its stat alone
+ */
+static bool test_recent_write_rehashes(void) {
+    char path[512];
+    config_path("recent", path, sizeof(path));
+    TEST_ASSERT(write_config(path, "gamma 4", 0), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "First parse");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Second get");
+
+    RiftGovCacheStats stats;
+    rift_gov_cache_get_stats(cache, &stats);
+    TEST_ASSERT(parses == 1 && stats.stat_hits == 0 && stats.content_hits == 1,
+                "Contents checked instead");
+
+    rift_gov_cache_destroy(cache);
+    TEST_PASS("Recent write rehashes");
+}
+
+/**
+ * Test: parse errors are returned and retried; missing files fail
+ */
+static bool test_failures_not_cached(void) {
+    char path[512];
+    config_path("invalid", path, sizeof(path));
+    TEST_ASSERT(write_config(path, "delta -1", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 7,
+                "Parse result returned");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 7,
+                "Returned again");
+    TEST_ASSERT(parses == 2, "Failure not cached");
+
+    config_path("missing", path, sizeof(path));
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == -1,
+                "Missing file");
+
+    RiftGovCacheStats stats;
+    rift_gov_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.entries == 0, "Nothing stored");
+
+    rift_gov_cache_destroy(cache);
+    TEST_PASS("Failures not cached");
+}
+
+/**
+ * Test: a saved cache lets a new process skip parsing
+ */
+static bool test_cache_file(void) {
+    char path[512], file[512];
+    config_path("persisted", path, sizeof(path));
+    config_path("gov.cache", file, sizeof(file));
+    TEST_ASSERT(write_config(path, "epsilon 5", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == -1, "No cache file yet");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Parsed");
+    TEST_ASSERT(rift_gov_cache_save(cache, file) == 0, "Saved");
+    rift_gov_cache_destroy(cache);
+
+    cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == 1, "One entry loaded");
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == 0, "Read once");
+    memset(&record, 0, sizeof(record));
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Warm get");
+    TEST_ASSERT(parses == 1 && strcmp(record.name, "epsilon") == 0 && record.value == 5,
+                "Served from the file");
+    rift_gov_cache_destroy(cache);
+
+    /* Another record layout ignores the file */
+    cache = rift_gov_cache_create(sizeof(TestRecord), 2);
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == -1, "Version mismatch");
+    rift_gov_cache_destroy(cache);
+
+    /* A damaged file is rejected whole */
+    int fd = open(file, O_RDWR);
+    TEST_ASSERT(fd >= 0, "Cache file opens");
+    char byte = 0;
+    TEST_ASSERT(pread(fd, &byte, 1, 40) == 1, "Byte read");
+    byte ^= 0x20;
+    TEST_ASSERT(pwrite(fd, &byte, 1, 40) == 1, "Byte flipped");
+    close(fd);
+
+    cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == -1, "Corruption detected");
+    rift_gov_cache_destroy(cache);
+
+    TEST_PASS("Cache file");
+}
+
+/* Terminates the name; values above 5 are refused */
+static bool check_record(void* record, void* user_data) {
+    TestRecord* r = (TestRecord*)record;
+    (void)user_data;
+    r->name[sizeof(r->name) - 1] = '\0';
+    return r->value <= 5;
+}
+
+/* Rewrite the record stored after `path` in a one-entry cache file and
+ * fix up its checksum, which anyone can recompute */
+static bool forge_record(const char* file, const char* path, const TestRecord* forged) {
+    FILE* f = fopen(file, "rb");
+    if (!f) return false;
+    unsigned char data[4096];
+    size_t length = fread(data, 1, sizeof(data), f);
+    fclose(f);
+
+    unsigned char* at = memmem(data, length, path, strlen(path));
+    if (!at || length < sizeof(uint64_t)) return false;
+    memcpy(at + strlen(path), forged, sizeof(*forged));
+
+    size_t body = length - sizeof(uint64_t);
+    uint64_t sum = rift_hash64(data, body, rift_hash64_combine(1, sizeof(TestRecord)));
+    memcpy(data + body, &sum, sizeof(sum));
+
+    f = fopen(file, "wb");
+    if (!f) return false;
+    bool written = fwrite(data, 1, length, f) == length;
+    return fclose(f) == 0 && written;
+}
+
+/**
+ * Test: records from a cache file pass the validator before use
+ */
+static bool test_loaded_records_validated(void) {
+    char path[512], file[512];
+    config_path("forged", path, sizeof(path));
+    config_path("forged.cache", file, sizeof(file));
+    TEST_ASSERT(write_config(path, "theta 4", 100), "Config written");
+
+    RiftGovCache* cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    int parses = 0;
+    TestRecord record;
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Parsed");
+    TEST_ASSERT(rift_gov_cache_save(cache, file) == 0, "Saved");
+    rift_gov_cache_destroy(cache);
+
+    /* An unterminated name is repaired on load */
+    TestRecord forged;
+    memset(forged.name, 'A', sizeof(forged.name));
+    forged.value = 4;
+    TEST_ASSERT(forge_record(file, path, &forged), "Name forged");
+
+    cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    rift_gov_cache_set_validator(cache, check_record, NULL);
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == 1, "Forged file passes its checksum");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Served from the file");
+    TEST_ASSERT(parses == 1 && strlen(record.name) == sizeof(record.name) - 1,
+                "Name terminated");
+    rift_gov_cache_destroy(cache);
+
+    /* An out-of-range value drops the entry, so the file is parsed again */
+    strcpy(forged.name, "theta");
+    forged.value = 99;
+    TEST_ASSERT(forge_record(file, path, &forged), "Value forged");
+
+    cache = rift_gov_cache_create(sizeof(TestRecord), 1);
+    rift_gov_cache_set_validator(cache, check_record, NULL);
+    TEST_ASSERT(rift_gov_cache_load(cache, file) == 0, "Entry dropped");
+    RiftGovCacheStats stats;
+    rift_gov_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.rejected == 1 && stats.entries == 0, "Rejection counted");
+    TEST_ASSERT(rift_gov_cache_get(cache, path, parse_record, &parses, &record) == 0,
+                "Reparsed");
+    TEST_ASSERT(parses == 2 && record.value == 4, "Value from the file itself");
+    rift_gov_cache_destroy(cache);
+
+    TEST_PASS("Loaded records validated");
+}
+
+static void remove_cache_dir(void) {
+    DIR* dir = opendir(g_cache_dir);
+    if (!dir) return;
+
+    struct dirent* de;
+    char path[512];
+    while ((de = readdir(dir)) != NULL) {
+        if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0) continue;
+        snprintf(path, sizeof(path), "%s/%s", g_cache_dir, de->d_name);
+        unlink(path);
+    }
+    closedir(dir);
+    rmdir(g_cache_dir);
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,403 @@
+/**
+ * =================================================================
+ * test_grammar.c - RIFT-0 LALR(1) Grammar Engine Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: BNF productions, LALR(1) tables and shift-reduce driver
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/rift_grammar.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_expression_grammar(void);
+static bool test_lalr_not_slr(void);
+static bool test_empty_rules_and_skipping(void);
+static bool test_conflicts(void);
+static bool test_definition_errors(void);
+static bool test_long_input(void);
+static bool test_push_parse(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 LALR(1) Grammar Engine Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Expression Grammar", test_expression_grammar);
+    run_test("LALR Not SLR", test_lalr_not_slr);
+    run_test("Empty Rules And Skipping", test_empty_rules_and_skipping);
+    run_test("Conflicts", test_conflicts);
+    run_test("Definition Errors", test_definition_errors);
+    run_test("Long Input", test_long_input);
+    run_test("Push Parse", test_push_parse);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+enum { NUM, PLUS, STAR, LPAREN, RPAREN, WS };
+
+static const char* g_expression_bnf =
+    "expr   : expr PLUS term | term ;\n"
+    "term   : term STAR factor | factor ;\n"
+    "factor : LPAREN expr RPAREN | NUM ;\n";
+
+static RiftGrammar* expression_grammar(void) {
+    RiftGrammar* g = rift_grammar_create();
+    if (!g) return NULL;
+    rift_grammar_add_terminal(g, "NUM", NUM);
+    rift_grammar_add_terminal(g, "PLUS", PLUS);
+    rift_grammar_add_terminal(g, "STAR", STAR);
+    rift_grammar_add_terminal(g, "LPAREN", LPAREN);
+    rift_grammar_add_terminal(g, "RPAREN", RPAREN);
+    /* WS stays unbound, so the parser skips it */
+    if (rift_grammar_add_rules(g, g_expression_bnf) != 6 || rift_grammar_build(g) != 0) {
+        rift_grammar_destroy(g);
+        return NULL;
+    }
+    return g;
+}
+
+/* Single-digit expression source to token types, keeping the digits */
+static size_t lex(const char* text, uint32_t* types, int* digits) {
+    size_t n = 0;
+    for (const char* p = text; *p; p++, n++) {
+        digits[n] = 0;
+        switch (*p) {
+            case '+': types[n] = PLUS; break;
+            case '*': types[n] = STAR; break;
+            case '(': types[n] = LPAREN; break;
+            case ')': types[n] = RPAREN; break;
+            case ' ': types[n] = WS; break;
+            default: types[n] = NUM; digits[n] = *p - '0'; break;
+        }
+    }
+    return n;
+}
+
+typedef struct {
+    const int* digits;
+    long values[64];
+    size_t depth;
+} Evaluator;
+
+/* Productions in order: expr+term, term, term*factor, factor, (expr), NUM */
+static void evaluate(uint32_t production, size_t first, size_t end, void* user_data) {
+    Evaluator* e = (Evaluator*)user_data;
+    (void)end;
+    switch (production) {
+        case 0: e->depth--; e->values[e->depth - 1] += e->values[e->depth]; break;
+        case 2: e->depth--; e->values[e->depth - 1] *= e->values[e->depth]; break;
+        case 5: e->values[e->depth++] = e->digits[first]; break;
+        default: break;
+    }
+}
+
+static bool evaluates_to(const RiftGrammar* g, const char* text, long expected) {
+    uint32_t types[64];
+    int digits[64];
+    size_t count = lex(text, types, digits);
+    Evaluator e = { digits, { 0 }, 0 };
+    size_t error = 0;
+    return rift_grammar_parse(g, types, count, evaluate, &e, &error) == 0 &&
+           e.depth == 1 && e.values[0] == expected;
+}
+
+/**
+ * Test: precedence and nesting come out of the tables, not the caller
+ */
+static bool test_expression_grammar(void) {
+    RiftGrammar* g = expression_grammar();
+    TEST_ASSERT(g != NULL, "Grammar built");
+
+    RiftGrammarStats stats;
+    rift_grammar_get_stats(g, &stats);
+    TEST_ASSERT(stats.productions == 6 && stats.nonterminals == 3, "Symbol counts");
+    TEST_ASSERT(stats.shift_reduce_conflicts == 0 && stats.reduce_reduce_conflicts == 0,
+                "No conflicts");
+    TEST_ASSERT(strcmp(rift_grammar_production_name(g, 2), "term") == 0, "Production names");
+
+    TEST_ASSERT(evaluates_to(g, "1+2*3", 7), "Multiplication binds tighter");
+    TEST_ASSERT(evaluates_to(g, "(1+2)*3", 9), "Parentheses");
+    TEST_ASSERT(evaluates_to(g, "2 * (3 + 4) * 5 + 1", 71), "Whitespace tokens skipped");
+
+    uint32_t types[16];
+    int digits[16];
+    size_t error = 0;
+    size_t count = lex("1+*2", types, digits);
+    TEST_ASSERT(rift_grammar_parse(g, types, count, NULL, NULL, &error) == -1, "Rejects 1+*2");
+    TEST_ASSERT(error == 2, "Error at the star");
+
+    count = lex("(1+2", types, digits);
+    TEST_ASSERT(rift_grammar_parse(g, types, count, NULL, NULL, &error) == -1, "Rejects (1+2");
+    TEST_ASSERT(error == count, "Error at end of input");
+
+    TEST_ASSERT(rift_grammar_parse(g, types, 0, NULL, NULL, &error) == -1, "Empty input");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("Expression grammar");
+}
+
+/**
+ * Test: a grammar SLR(1) cannot handle builds without conflicts
+ */
+static bool test_lalr_not_slr(void) {
+    enum { ID, EQ, DEREF };
+    RiftGrammar* g = rift_grammar_create();
+    rift_grammar_add_terminal(g, "ID", ID);
+    rift_grammar_add_terminal(g, "EQ", EQ);
+    rift_grammar_add_terminal(g, "STAR", DEREF);
+    TEST_ASSERT(rift_grammar_add_rules(g, "S ::= L EQ R | R\nL ::= STAR R | ID\nR ::= L") == 5,
+                "Rules added");
+    TEST_ASSERT(rift_grammar_build(g) == 0, "Built");
+
+    RiftGrammarStats stats;
+    rift_grammar_get_stats(g, &stats);
+    TEST_ASSERT(stats.shift_reduce_conflicts == 0, "No shift/reduce conflict on EQ");
+
+    uint32_t assign[] = { DEREF, ID, EQ, ID };
+    uint32_t bad[] = { ID, EQ, EQ };
+    size_t error = 0;
+    TEST_ASSERT(rift_grammar_parse(g, assign, 4, NULL, NULL, &error) == 0, "*id = id");
+    TEST_ASSERT(rift_grammar_parse(g, bad, 3, NULL, NULL, &error) == -1 && error == 2,
+                "id = = rejected");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("LALR not SLR");
+}
+
+typedef struct {
+    size_t lists;
+    size_t last_first;
+    size_t last_end;
+} SpanLog;
+
+static void log_span(uint32_t production, size_t first, size_t end, void* user_data) {
+    SpanLog* log = (SpanLog*)user_data;
+    if (production <= 1) {
+        log->lists++;
+        log->last_first = first;
+        log->last_end = end;
+    }
+}
+
+/**
+ * Test: empty alternatives, spans, and unbound token types
+ */
+static bool test_empty_rules_and_skipping(void) {
+    enum { ITEM = 7, COMMENT = 9 };
+    RiftGrammar* g = rift_grammar_create();
+    rift_grammar_add_terminal(g, "ITEM", ITEM);
+    TEST_ASSERT(rift_grammar_add_rules(g, "list : list ITEM | ;") == 2, "Rules added");
+    TEST_ASSERT(rift_grammar_build(g) == 0, "Built");
+
+    size_t error = 0;
+    SpanLog log = { 0, 0, 0 };
+    TEST_ASSERT(rift_grammar_parse(g, NULL, 0, log_span, &log, &error) == 0, "Empty list");
+    TEST_ASSERT(log.lists == 1, "Empty reduction");
+
+    uint32_t types[] = { COMMENT, ITEM, COMMENT, ITEM, ITEM };
+    memset(&log, 0, sizeof(log));
+    TEST_ASSERT(rift_grammar_parse(g, types, 5, log_span, &log, &error) == 0, "Three items");
+    TEST_ASSERT(log.lists == 4, "One reduction per item plus the empty list");
+    TEST_ASSERT(log.last_end == 5, "Final span ends after the last item");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("Empty rules and skipping");
+}
+
+/**
+ * Test: ambiguity is resolved yacc-style and counted
+ */
+static bool test_conflicts(void) {
+    RiftGrammar* g = rift_grammar_create();
+    rift_grammar_add_terminal(g, "NUM", NUM);
+    rift_grammar_add_terminal(g, "PLUS", PLUS);
+    rift_grammar_add_rules(g, "e : e PLUS e | NUM");
+    TEST_ASSERT(rift_grammar_build(g) == 0, "Ambiguous grammar still builds");
+
+    RiftGrammarStats stats;
+    rift_grammar_get_stats(g, &stats);
+    TEST_ASSERT(stats.shift_reduce_conflicts == 1, "One shift/reduce conflict");
+
+    uint32_t types[] = { NUM, PLUS, NUM, PLUS, NUM };
+    size_t error = 0;
+    TEST_ASSERT(rift_grammar_parse(g, types, 5, NULL, NULL, &error) == 0, "Parses with shift");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("Conflicts");
+}
+
+/**
+ * Test: malformed BNF and undefined symbols are reported
+ */
+static bool test_definition_errors(void) {
+    RiftGrammar* g = rift_grammar_create();
+    TEST_ASSERT(rift_grammar_build(g) == -1, "No productions");
+
+    TEST_ASSERT(rift_grammar_add_rules(g, "a : b $ c") == -1, "Bad character");
+    TEST_ASSERT(strstr(rift_grammar_error(g), "$") != NULL, "Error names the character");
+    TEST_ASSERT(rift_grammar_add_rules(g, ": b") == -1, "Missing rule name");
+
+    TEST_ASSERT(rift_grammar_add_rules(g, "a : b") == 1, "Rule after failures");
+    TEST_ASSERT(rift_grammar_build(g) == -1, "b is undefined");
+    TEST_ASSERT(strstr(rift_grammar_error(g), "'b'") != NULL, "Error names the symbol");
+
+    rift_grammar_add_terminal(g, "b", 1);
+    TEST_ASSERT(rift_grammar_build(g) == 0, "Built once b is a terminal");
+    TEST_ASSERT(rift_grammar_add_terminal(g, "b", 2) == -1, "Rebinding rejected");
+
+    rift_grammar_add_terminal(g, "a", 3);
+    TEST_ASSERT(rift_grammar_build(g) == -1, "Terminal and rule at once");
+    TEST_ASSERT(!rift_grammar_is_built(g), "Tables dropped");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("Definition errors");
+}
+
+static void count_reduction(uint32_t production, size_t first, size_t end, void* user_data) {
+    (void)production;
+    (void)first;
+    (void)end;
+    (*(size_t*)user_data)++;
+}
+
+/**
+ * Test: deep nesting and long sequences parse in one pass
+ */
+static bool test_long_input(void) {
+    RiftGrammar* g = expression_grammar();
+    TEST_ASSERT(g != NULL, "Grammar built");
+
+    /* ((((1)))) ... nested 5000 deep, then + 1 repeated */
+    size_t depth = 5000, terms = 100000;
+    size_t count = depth * 2 + 1 + terms * 2;
+    uint32_t* types = malloc(count * sizeof(uint32_t));
+    TEST_ASSERT(types != NULL, "Allocation");
+
+    size_t n = 0;
+    for (size_t i = 0; i < depth; i++) types[n++] = LPAREN;
+    types[n++] = NUM;
+    for (size_t i = 0; i < depth; i++) types[n++] = RPAREN;
+    for (size_t i = 0; i < terms; i++) {
+        types[n++] = PLUS;
+        types[n++] = NUM;
+    }
+
+    size_t reductions = 0, error = 0;
+    TEST_ASSERT(rift_grammar_parse(g, types, count, count_reduction, &reductions, &error) == 0,
+                "Accepted");
+    /* NUM->factor->term->expr once, each paren adds factor->term->expr,
+     * each "+ NUM" adds factor, term and expr+term */
+    TEST_ASSERT(reductions == 3 + depth * 3 + terms * 3, "Reduction count");
+
+    free(types);
+    rift_grammar_destroy(g);
+    TEST_PASS("Long input");
+}
+
+/* Feed a whole sequence in push mode; the index of a rejected token, or
+ * count when it was the end of input */
+static int push_all(const RiftGrammar* g, const uint32_t* types, size_t count,
+                    RiftReduceFn on_reduce, void* user_data, size_t* error) {
+    RiftGrammarPush* push = rift_grammar_push_create(g, on_reduce, user_data);
+    if (!push) return -2;
+    for (size_t i = 0; i < count; i++) {
+        if (rift_grammar_push_token(push, types[i]) != 0) break;
+    }
+    int result = rift_grammar_push_finish(push, error);
+    rift_grammar_push_destroy(push);
+    return result;
+}
+
+/**
+ * Test: push mode reduces exactly as the batch driver does
+ */
+static bool test_push_parse(void) {
+    RiftGrammar* g = expression_grammar();
+    TEST_ASSERT(g != NULL, "Grammar built");
+
+    uint32_t types[64];
+    int digits[64];
+    size_t error = 0;
+    size_t count = lex("2 * (3 + 4) * 5 + 1", types, digits);
+    Evaluator e = { digits, { 0 }, 0 };
+    TEST_ASSERT(push_all(g, types, count, evaluate, &e, &error) == 0, "Accepted");
+    TEST_ASSERT(e.depth == 1 && e.values[0] == 71, "Same evaluation");
+
+    /* Reductions arrive while tokens are still being fed */
+    size_t reductions = 0;
+    RiftGrammarPush* push = rift_grammar_push_create(g, count_reduction, &reductions);
+    TEST_ASSERT(push != NULL, "Push parser created");
+    TEST_ASSERT(rift_grammar_push_token(push, NUM) == 0, "Shift 1");
+    TEST_ASSERT(reductions == 0, "Nothing decided yet");
+    TEST_ASSERT(rift_grammar_push_token(push, PLUS) == 0, "Shift +");
+    TEST_ASSERT(reductions == 3, "1 reduced to expr on seeing +");
+    TEST_ASSERT(rift_grammar_push_token(push, PLUS) == -1, "Rejects + +");
+    TEST_ASSERT(rift_grammar_push_token(push, NUM) == -1, "Stays failed");
+    TEST_ASSERT(rift_grammar_push_finish(push, &error) == -1 && error == 2, "Error at second +");
+    rift_grammar_push_destroy(push);
+
+    count = lex("(1+2", types, digits);
+    TEST_ASSERT(push_all(g, types, count, NULL, NULL, &error) == -1, "Rejects (1+2");
+    TEST_ASSERT(error == count, "Error at end of input");
+    TEST_ASSERT(push_all(g, types, 0, NULL, NULL, &error) == -1 && error == 0, "Empty input");
+
+    rift_grammar_destroy(g);
+    TEST_PASS("Push parse");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,339 @@
+/**
+ * =================================================================
+ * test_heap_queue.c - RIFT-0 Concurrent Priority Queue Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Stage-0 job scheduling queue
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/lexer/heap_queue.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_exact_order_single_shard(void);
+static bool test_growth_without_drops(void);
+static bool test_batch_operations(void);
+static bool test_timed_dequeue(void);
+static bool test_many_producers(void);
+static bool test_size_never_wraps(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Concurrent Priority Queue Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Exact Order (Single Shard)", test_exact_order_single_shard);
+    run_test("Growth Without Drops", test_growth_without_drops);
+    run_test("Batch Operations", test_batch_operations);
+    run_test("Timed Dequeue", test_timed_dequeue);
+    run_test("Many Producers", test_many_producers);
+    run_test("Size Never Wraps", test_size_never_wraps);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/**
+ * Test: one shard behaves as a strict min-heap
+ */
+static bool test_exact_order_single_shard(void) {
+    HeapQueue* hq = hq_create_sharded(4, 1);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    int priorities[] = { 5, 1, 9, 3, 7, 2, 8 };
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT(hq_enqueue(hq, priorities[i], i) == 0, "Enqueue");
+    }
+
+    int last = -1;
+    Item item;
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT(hq_try_dequeue(hq, &item), "Dequeue");
+        TEST_ASSERT(item.priority >= last, "Priorities ascend");
+        last = item.priority;
+    }
+    TEST_ASSERT(!hq_try_dequeue(hq, &item), "Empty after drain");
+
+    Item empty = hq_dequeue(hq);
+    TEST_ASSERT(empty.priority == 0 && empty.value == 0, "Legacy empty result");
+
+    hq_destroy(hq);
+    TEST_PASS("Exact order");
+}
+
+/**
+ * Test: enqueueing far past the initial capacity keeps every item
+ */
+static bool test_growth_without_drops(void) {
+    HeapQueue* hq = hq_create(8);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    for (int i = 0; i < 100000; i++) {
+        TEST_ASSERT(hq_enqueue(hq, i % 97, i) == 0, "Enqueue");
+    }
+    TEST_ASSERT(hq_size(hq) == 100000, "Size counts every item");
+
+    long long sum = 0;
+    Item item;
+    while (hq_try_dequeue(hq, &item)) {
+        sum += item.value;
+    }
+    TEST_ASSERT(sum == 100000LL * 99999 / 2, "Every value returned once");
+    TEST_ASSERT(hq_size(hq) == 0, "Drained");
+
+    hq_destroy(hq);
+    TEST_PASS("Growth without drops");
+}
+
+/**
+ * Test: batch enqueue and dequeue
+ */
+static bool test_batch_operations(void) {
+    HeapQueue* hq = hq_create_sharded(16, 4);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    Item items[256];
+    for (int i = 0; i < 256; i++) {
+        items[i] = (Item){ 255 - i, i };
+    }
+    TEST_ASSERT(hq_enqueue_batch(hq, items, 256) == 0, "Batch enqueue");
+
+    /* A single batch lands in one shard, so it comes back sorted */
+    Item out[300];
+    size_t got = hq_dequeue_batch(hq, out, 300);
+    TEST_ASSERT(got == 256, "Batch dequeue takes everything");
+    for (size_t i = 1; i < got; i++) {
+        TEST_ASSERT(out[i - 1].priority <= out[i].priority, "Batch sorted");
+    }
+
+    hq_destroy(hq);
+    TEST_PASS("Batch operations");
+}
+
+static void* delayed_producer(void* arg) {
+    HeapQueue* hq = (HeapQueue*)arg;
+    struct timespec delay = { 0, 50 * 1000000L };
+    nanosleep(&delay, NULL);
+    hq_enqueue(hq, 1, 42);
+    nanosleep(&delay, NULL);
+    hq_close(hq);
+    return NULL;
+}
+
+/**
+ * Test: blocking pop waits for producers, times out, and ends on close
+ */
+static bool test_timed_dequeue(void) {
+    HeapQueue* hq = hq_create(0);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    Item item;
+    TEST_ASSERT(hq_dequeue_timed(hq, &item, 20) == -1, "Times out when empty");
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, delayed_producer, hq);
+    TEST_ASSERT(hq_dequeue_timed(hq, &item, -1) == 0, "Woken by enqueue");
+    TEST_ASSERT(item.value == 42, "Received the item");
+    TEST_ASSERT(hq_dequeue_timed(hq, &item, -1) == -1, "Woken by close");
+    pthread_join(producer, NULL);
+
+    TEST_ASSERT(hq_enqueue(hq, 1, 1) == -1, "Closed queue rejects work");
+
+    hq_destroy(hq);
+    TEST_PASS("Timed dequeue");
+}
+
+#define PRODUCERS 32
+#define CONSUMERS 4
+#define PER_PRODUCER 5000
+
+typedef struct {
+    HeapQueue* hq;
+    int id;
+    atomic_llong* sum;
+    atomic_int* received;
+} QueueWorker;
+
+static void* producer_main(void* arg) {
+    QueueWorker* w = (QueueWorker*)arg;
+    for (int i = 0; i < PER_PRODUCER; i += 10) {
+        Item batch[10];
+        for (int j = 0; j < 10; j++) {
+            batch[j] = (Item){ (i + j) % 64, w->id * PER_PRODUCER + i + j };
+        }
+        hq_enqueue_batch(w->hq, batch, 10);
+    }
+    return NULL;
+}
+
+static void* consumer_main(void* arg) {
+    QueueWorker* w = (QueueWorker*)arg;
+    Item batch[16];
+    Item item;
+
+    for (;;) {
+        size_t n = hq_dequeue_batch(w->hq, batch, 16);
+        for (size_t i = 0; i < n; i++) {
+            atomic_fetch_add(w->sum, batch[i].value);
+            atomic_fetch_add(w->received, 1);
+        }
+        if (n > 0) continue;
+
+        if (hq_dequeue_timed(w->hq, &item, -1) != 0) break;
+        atomic_fetch_add(w->sum, item.value);
+        atomic_fetch_add(w->received, 1);
+    }
+    return NULL;
+}
+
+/**
+ * Test: 32 producers and several consumers lose and duplicate nothing
+ */
+static bool test_many_producers(void) {
+    HeapQueue* hq = hq_create(64);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    atomic_llong sum;
+    atomic_int received;
+    atomic_init(&sum, 0);
+    atomic_init(&received, 0);
+
+    pthread_t producers[PRODUCERS];
+    pthread_t consumers[CONSUMERS];
+    QueueWorker consumer_args[CONSUMERS];
+    QueueWorker producer_args[PRODUCERS];
+
+    for (int i = 0; i < CONSUMERS; i++) {
+        consumer_args[i] = (QueueWorker){ hq, i, &sum, &received };
+        pthread_create(&consumers[i], NULL, consumer_main, &consumer_args[i]);
+    }
+    for (int i = 0; i < PRODUCERS; i++) {
+        producer_args[i] = (QueueWorker){ hq, i, &sum, &received };
+        pthread_create(&producers[i], NULL, producer_main, &producer_args[i]);
+    }
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_join(producers[i], NULL);
+    }
+    hq_close(hq);
+    for (int i = 0; i < CONSUMERS; i++) {
+        pthread_join(consumers[i], NULL);
+    }
+
+    long long total = (long long)PRODUCERS * PER_PRODUCER;
+    TEST_ASSERT(atomic_load(&received) == total, "Every item received once");
+    TEST_ASSERT(atomic_load(&sum) == total * (total - 1) / 2, "Values intact");
+    TEST_ASSERT(hq_size(hq) == 0, "Queue drained");
+
+    hq_destroy(hq);
+    TEST_PASS("Many producers");
+}
+
+typedef struct {
+    HeapQueue* hq;
+    size_t limit;
+    atomic_int* remaining;
+    atomic_bool* wrapped;
+} SizeWatcher;
+
+static void* eager_consumer(void* arg) {
+    SizeWatcher* w = (SizeWatcher*)arg;
+    Item item;
+    while (atomic_load(w->remaining) > 0) {
+        if (!hq_try_dequeue(w->hq, &item)) continue;
+        atomic_fetch_sub(w->remaining, 1);
+        if (hq_size(w->hq) > w->limit) atomic_store(w->wrapped, true);
+    }
+    return NULL;
+}
+
+/**
+ * Test: a consumer popping right after publication never sees the
+ * count below zero
+ */
+static bool test_size_never_wraps(void) {
+    HeapQueue* hq = hq_create(64);
+    TEST_ASSERT(hq != NULL, "Queue creation");
+
+    const int total = 200000;
+    atomic_int remaining;
+    atomic_bool wrapped;
+    atomic_init(&remaining, total);
+    atomic_init(&wrapped, false);
+
+    SizeWatcher watcher = { hq, (size_t)total, &remaining, &wrapped };
+    pthread_t consumers[CONSUMERS];
+    for (int i = 0; i < CONSUMERS; i++) {
+        pthread_create(&consumers[i], NULL, eager_consumer, &watcher);
+    }
+    for (int i = 0; i < total; i++) {
+        hq_enqueue(hq, i % 64, i);
+        if (hq_size(hq) > (size_t)total) atomic_store(&wrapped, true);
+    }
+    for (int i = 0; i < CONSUMERS; i++) {
+        pthread_join(consumers[i], NULL);
+    }
+
+    TEST_ASSERT(!atomic_load(&wrapped), "Size stays within enqueued items");
+    TEST_ASSERT(hq_size(hq) == 0, "Queue drained");
+
+    hq_destroy(hq);
+    TEST_PASS("Size never wraps");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
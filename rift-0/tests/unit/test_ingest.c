@@ -0,0 +1,308 @@
+/**
+ * =================================================================
+ * test_ingest.c - RIFT-0 Bulk File Ingestion Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Asynchronous file loading for batch tokenization
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_ingest.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_default_backend(void);
+static bool test_thread_backend(void);
+static bool test_deferred_release(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+/* =================================================================
+ * FIXTURE
+ * =================================================================
+ */
+
+#define SMALL_BUFFER 4096
+#define FIXTURE_FILES 9
+
+static char g_dir[64];
+static char g_paths[FIXTURE_FILES][128];
+static size_t g_sizes[FIXTURE_FILES];
+
+static char expected_byte(size_t file, size_t offset) {
+    return (char)('a' + (file * 7 + offset) % 26);
+}
+
+static bool write_file(const char* path, size_t file, size_t size) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    for (size_t i = 0; i < size; i++) fputc(expected_byte(file, i), f);
+    return fclose(f) == 0;
+}
+
+/* Empty, tiny, slot-sized and multi-slot files, plus three that must fail */
+static bool create_fixture(void) {
+    strcpy(g_dir, "/tmp/rift_ingest_XXXXXX");
+    if (!mkdtemp(g_dir)) return false;
+
+    size_t sizes[] = { 0, 17, SMALL_BUFFER - 1, SMALL_BUFFER, 3 * SMALL_BUFFER + 5, 200000 };
+    for (size_t i = 0; i < 6; i++) {
+        snprintf(g_paths[i], sizeof(g_paths[i]), "%s/file%zu.rift", g_dir, i);
+        g_sizes[i] = sizes[i];
+        if (!write_file(g_paths[i], i, sizes[i])) return false;
+    }
+    snprintf(g_paths[6], sizeof(g_paths[6]), "%s/missing.rift", g_dir);
+    snprintf(g_paths[7], sizeof(g_paths[7]), "%s", g_dir);
+    snprintf(g_paths[8], sizeof(g_paths[8]), "%s/pipe.rift", g_dir);
+    return mkfifo(g_paths[8], 0600) == 0;
+}
+
+static void remove_fixture(void) {
+    for (size_t i = 0; i < 6; i++) unlink(g_paths[i]);
+    unlink(g_paths[8]);
+    rmdir(g_dir);
+}
+
+typedef struct {
+    RiftIngest* ingest;
+    int delivered[FIXTURE_FILES];
+    int intact[FIXTURE_FILES];
+    int error[FIXTURE_FILES];
+} Results;
+
+static void check_buffer(Results* r, const RiftIngestBuffer* buffer) {
+    size_t i = buffer->index;
+    r->delivered[i]++;
+    r->error[i] = buffer->error;
+    if (buffer->error != 0 || buffer->size != g_sizes[i] || buffer->data[buffer->size] != '\0') {
+        return;
+    }
+    for (size_t k = 0; k < buffer->size; k++) {
+        if (buffer->data[k] != expected_byte(i, k)) return;
+    }
+    r->intact[i] = 1;
+}
+
+static void release_now(RiftIngestBuffer* buffer, void* user_data) {
+    Results* r = (Results*)user_data;
+    check_buffer(r, buffer);
+    rift_ingest_release(r->ingest, buffer);
+}
+
+static bool run_fixture(const RiftIngestConfig* config, Results* r) {
+    const char* paths[FIXTURE_FILES];
+    for (size_t i = 0; i < FIXTURE_FILES; i++) paths[i] = g_paths[i];
+
+    memset(r, 0, sizeof(*r));
+    r->ingest = rift_ingest_create(config);
+    if (!r->ingest) return false;
+
+    int result = rift_ingest_run(r->ingest, paths, FIXTURE_FILES, release_now, r);
+    rift_ingest_destroy(r->ingest);
+    return result == -1;
+}
+
+static bool fixture_ok(const Results* r) {
+    for (size_t i = 0; i < FIXTURE_FILES; i++) {
+        if (r->delivered[i] != 1) return false;
+    }
+    for (size_t i = 0; i < 6; i++) {
+        if (!r->intact[i]) return false;
+    }
+    /* Both backends take regular files only */
+    return r->error[6] == ENOENT && r->error[7] == EINVAL && r->error[8] == EINVAL;
+}
+
+/* =================================================================
+ * TESTS
+ * =================================================================
+ */
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Bulk File Ingestion Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    if (!create_fixture()) {
+        printf("Could not create fixture files\n");
+        return 1;
+    }
+
+    run_test("Default Backend", test_default_backend);
+    run_test("Thread Backend", test_thread_backend);
+    run_test("Deferred Release", test_deferred_release);
+
+    remove_fixture();
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/**
+ * Test: io_uring where available; small slots force files to grow
+ */
+static bool test_default_backend(void) {
+    RiftIngestConfig config = { .queue_depth = 3, .buffer_size = SMALL_BUFFER };
+    Results r;
+
+    TEST_ASSERT(run_fixture(&config, &r), "Run reports the failed paths");
+    TEST_ASSERT(fixture_ok(&r), "Every file delivered once and intact");
+
+    /* A size limit turns the largest file into an error */
+    config.max_file_size = 100000;
+    TEST_ASSERT(run_fixture(&config, &r), "Run with limit");
+    TEST_ASSERT(r.error[5] == EFBIG, "Oversized file rejected");
+    TEST_ASSERT(r.intact[4], "Smaller files unaffected");
+
+    TEST_PASS("Default backend");
+}
+
+/**
+ * Test: forced fallback, with and without a reader pool
+ */
+static bool test_thread_backend(void) {
+    RiftWorkPool* pool = rift_workpool_create(3);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    RiftIngestConfig config = { .readers = pool, .disable_io_uring = true };
+    RiftIngest* probe = rift_ingest_create(&config);
+    TEST_ASSERT(strcmp(rift_ingest_backend(probe), "threads") == 0, "Fallback selected");
+    rift_ingest_destroy(probe);
+
+    Results r;
+    TEST_ASSERT(run_fixture(&config, &r), "Pooled run");
+    TEST_ASSERT(fixture_ok(&r), "Pooled files intact");
+
+    config.readers = NULL;
+    TEST_ASSERT(run_fixture(&config, &r), "Inline run");
+    TEST_ASSERT(fixture_ok(&r), "Inline files intact");
+
+    rift_workpool_destroy(pool);
+    TEST_PASS("Thread backend");
+}
+
+typedef struct {
+    RiftIngest* ingest;
+    RiftWorkPool* pool;
+    RiftTaskGroup group;
+    atomic_int intact;
+} DeferredRun;
+
+typedef struct {
+    DeferredRun* run;
+    RiftIngestBuffer* buffer;
+} ReleaseJob;
+
+static void release_task(void* arg) {
+    ReleaseJob* job = (ReleaseJob*)arg;
+    RiftIngestBuffer* buffer = job->buffer;
+    size_t file = buffer->index % 6;
+
+    usleep(1000);
+    bool ok = buffer->error == 0 && buffer->size == g_sizes[file];
+    for (size_t k = 0; ok && k < buffer->size; k++) {
+        ok = buffer->data[k] == expected_byte(file, k);
+    }
+    if (ok) atomic_fetch_add(&job->run->intact, 1);
+
+    rift_ingest_release(job->run->ingest, buffer);
+    free(job);
+}
+
+static void hand_to_pool(RiftIngestBuffer* buffer, void* user_data) {
+    DeferredRun* run = (DeferredRun*)user_data;
+    ReleaseJob* job = malloc(sizeof(ReleaseJob));
+    job->run = run;
+    job->buffer = buffer;
+    if (rift_workpool_submit(run->pool, &run->group, release_task, job) != 0) {
+        release_task(job);
+    }
+}
+
+/**
+ * Test: consumers on other threads keep buffers while more files load
+ */
+static bool test_deferred_release(void) {
+    /* Only the readable fixture files, each eight times over */
+    const char* paths[6 * 8];
+    size_t count = 6 * 8;
+    for (size_t i = 0; i < count; i++) paths[i] = g_paths[i % 6];
+
+    DeferredRun run;
+    memset(&run, 0, sizeof(run));
+    atomic_init(&run.intact, 0);
+    run.pool = rift_workpool_create(2);
+    TEST_ASSERT(run.pool != NULL, "Pool creation");
+    rift_task_group_init(&run.group);
+
+    /* Two slots for 48 files: loading must wait on the consumers */
+    RiftIngestConfig config = { .queue_depth = 2, .buffer_size = SMALL_BUFFER };
+    run.ingest = rift_ingest_create(&config);
+    TEST_ASSERT(run.ingest != NULL, "Ingest creation");
+
+    TEST_ASSERT(rift_ingest_run(run.ingest, paths, count, hand_to_pool, &run) == 0,
+                "Every file loaded");
+    rift_workpool_wait(run.pool, &run.group);
+    TEST_ASSERT(atomic_load(&run.intact) == (int)count, "Every buffer intact");
+
+    rift_task_group_destroy(&run.group);
+    rift_ingest_destroy(run.ingest);
+    rift_workpool_destroy(run.pool);
+    TEST_PASS("Deferred release");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,232 @@
+/**
+ * =================================================================
+ * test_packrat.c - RIFT-0 Packrat Memo Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: (rule, offset) match memoization for recursive descent
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/packrat_memo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_store_lookup(void);
+static bool test_window_eviction(void);
+static bool test_new_input(void);
+static bool test_shared_passes(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Packrat Memo Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Store And Lookup", test_store_lookup);
+    run_test("Window Eviction", test_window_eviction);
+    run_test("New Input", test_new_input);
+    run_test("Shared Passes", test_shared_passes);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/**
+ * Test: matches, failures and empty matches come back as stored
+ */
+static bool test_store_lookup(void) {
+    PackratMemo* memo = packrat_memo_create(3, 100);
+    TEST_ASSERT(memo != NULL, "Memo creation");
+    TEST_ASSERT(memo->window == 128, "Window rounded to a power of two");
+    TEST_ASSERT(packrat_memo_create(0, 16) == NULL, "No rules rejected");
+
+    packrat_memo_begin(memo, 64);
+    size_t length = 99;
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 0, &length) == PACKRAT_UNKNOWN, "Empty table");
+
+    packrat_memo_store(memo, 0, 5, true, 7);
+    packrat_memo_store(memo, 1, 5, false, 0);
+    packrat_memo_store(memo, 2, 5, true, 0);
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 5, &length) == PACKRAT_MATCH && length == 7,
+                "Match length kept");
+    TEST_ASSERT(packrat_memo_lookup(memo, 1, 5, &length) == PACKRAT_FAIL, "Failure kept");
+    TEST_ASSERT(packrat_memo_lookup(memo, 2, 5, &length) == PACKRAT_MATCH && length == 0,
+                "Empty match differs from failure");
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 6, &length) == PACKRAT_UNKNOWN, "Other offset");
+    TEST_ASSERT(packrat_memo_lookup(memo, 3, 5, &length) == PACKRAT_UNKNOWN, "Unknown rule");
+
+    packrat_memo_store(memo, 0, 6, true, PACKRAT_MAX_LENGTH + 1);
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 6, &length) == PACKRAT_UNKNOWN,
+                "Oversized match not kept");
+    packrat_memo_store(memo, 0, 65, true, 1);
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 65, &length) == PACKRAT_UNKNOWN,
+                "Offsets past the input ignored");
+
+    packrat_memo_destroy(memo);
+    TEST_PASS("Store and lookup");
+}
+
+/**
+ * Test: a long input keeps only the most recent window of offsets
+ */
+static bool test_window_eviction(void) {
+    PackratMemo* memo = packrat_memo_create(2, 16);
+    TEST_ASSERT(memo != NULL, "Memo creation");
+
+    packrat_memo_begin(memo, 1000000);
+    for (size_t offset = 0; offset < 1000000; offset++) {
+        packrat_memo_store(memo, offset & 1, offset, true, offset % 13);
+    }
+
+    size_t length;
+    size_t kept = 0;
+    for (size_t offset = 0; offset < 1000000; offset++) {
+        PackratResult r = packrat_memo_lookup(memo, offset & 1, offset, &length);
+        if (r == PACKRAT_MATCH) {
+            TEST_ASSERT(length == offset % 13, "Surviving entry intact");
+            TEST_ASSERT(offset >= 1000000 - 16, "Only the last window survives");
+            kept++;
+        }
+    }
+    TEST_ASSERT(kept == 16, "A full window survives");
+
+    packrat_memo_destroy(memo);
+    TEST_PASS("Window eviction");
+}
+
+/**
+ * Test: entries from one input never answer for the next
+ */
+static bool test_new_input(void) {
+    PackratMemo* memo = packrat_memo_create(1, 64);
+    TEST_ASSERT(memo != NULL, "Memo creation");
+
+    size_t length;
+    for (int round = 0; round < 100; round++) {
+        packrat_memo_begin(memo, 10);
+        for (size_t offset = 0; offset < 10; offset++) {
+            TEST_ASSERT(packrat_memo_lookup(memo, 0, offset, &length) == PACKRAT_UNKNOWN,
+                        "Fresh input starts empty");
+            packrat_memo_store(memo, 0, offset, true, offset);
+        }
+    }
+
+    packrat_memo_begin(memo, 0);
+    TEST_ASSERT(packrat_memo_lookup(memo, 0, 0, &length) == PACKRAT_UNKNOWN, "Empty input");
+
+    packrat_memo_destroy(memo);
+    TEST_PASS("New input");
+}
+
+#define PASS_RULES 4
+#define PASS_LENGTH 20000
+
+typedef struct {
+    PackratMemo* memo;
+    size_t computed;
+    size_t wrong;
+} MemoPass;
+
+/* Deterministic stand-in for a pattern match */
+static long reference_match(size_t rule, size_t offset) {
+    return (offset * 7 + rule) % 5 == 0 ? -1 : (long)((offset + rule) % 9);
+}
+
+static void* memo_pass_main(void* arg) {
+    MemoPass* pass = (MemoPass*)arg;
+    size_t length;
+    for (size_t offset = 0; offset < PASS_LENGTH; offset++) {
+        for (size_t rule = 0; rule < PASS_RULES; rule++) {
+            long expected = reference_match(rule, offset);
+            PackratResult r = packrat_memo_lookup(pass->memo, rule, offset, &length);
+            if (r == PACKRAT_UNKNOWN) {
+                pass->computed++;
+                packrat_memo_store(pass->memo, rule, offset, expected >= 0,
+                                   expected >= 0 ? (size_t)expected : 0);
+            } else if ((r == PACKRAT_FAIL) != (expected < 0) ||
+                       (r == PACKRAT_MATCH && length != (size_t)expected)) {
+                pass->wrong++;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Test: two passes sharing one table only ever read correct results
+ */
+static bool test_shared_passes(void) {
+    PackratMemo* memo = packrat_memo_create(PASS_RULES, 256);
+    TEST_ASSERT(memo != NULL, "Memo creation");
+    packrat_memo_begin(memo, PASS_LENGTH);
+
+    pthread_t threads[2];
+    MemoPass passes[2] = { { memo, 0, 0 }, { memo, 0, 0 } };
+    for (int i = 0; i < 2; i++) {
+        pthread_create(&threads[i], NULL, memo_pass_main, &passes[i]);
+    }
+    for (int i = 0; i < 2; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    TEST_ASSERT(passes[0].wrong == 0 && passes[1].wrong == 0, "No stale or torn entries");
+    TEST_ASSERT(passes[0].computed + passes[1].computed >= (size_t)PASS_RULES * PASS_LENGTH,
+                "Every key computed at least once");
+
+    packrat_memo_destroy(memo);
+    TEST_PASS("Shared passes");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,181 @@
+/**
+ * =================================================================
+ * test_parse_arena.c - RIFT-0 Parse Arena Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Bump allocation for per-parse nodes
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/parse_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_alignment(void);
+static bool test_growth(void);
+static bool test_reset_reuses(void);
+static bool test_strndup(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Parse Arena Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Alignment", test_alignment);
+    run_test("Growth", test_growth);
+    run_test("Reset Reuses Chunks", test_reset_reuses);
+    run_test("Strndup", test_strndup);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/**
+ * Test: every block is maximally aligned and blocks do not overlap
+ */
+static bool test_alignment(void) {
+    ParseArena* arena = parse_arena_create(256);
+    TEST_ASSERT(arena != NULL, "Arena creation");
+
+    unsigned char* previous = NULL;
+    for (size_t size = 1; size <= 40; size++) {
+        unsigned char* block = parse_arena_alloc(arena, size);
+        TEST_ASSERT(block != NULL, "Allocation");
+        TEST_ASSERT((uintptr_t)block % alignof(max_align_t) == 0, "Aligned");
+        TEST_ASSERT(block != previous, "Distinct blocks");
+        memset(block, (int)size, size);
+        previous = block;
+    }
+
+    parse_arena_destroy(arena);
+    TEST_PASS("Alignment");
+}
+
+/**
+ * Test: chunks are chained as needed, including oversized requests
+ */
+static bool test_growth(void) {
+    ParseArena* arena = parse_arena_create(128);
+    TEST_ASSERT(arena != NULL, "Arena creation");
+
+    uint32_t* values[1000];
+    for (uint32_t i = 0; i < 1000; i++) {
+        values[i] = parse_arena_alloc(arena, sizeof(uint32_t));
+        TEST_ASSERT(values[i] != NULL, "Small allocation");
+        *values[i] = i;
+    }
+
+    char* large = parse_arena_alloc(arena, 10000);
+    TEST_ASSERT(large != NULL, "Oversized allocation");
+    memset(large, 'x', 10000);
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        TEST_ASSERT(*values[i] == i, "Earlier blocks untouched");
+    }
+    TEST_ASSERT(parse_arena_alloc(arena, SIZE_MAX) == NULL, "Impossible size rejected");
+
+    parse_arena_destroy(arena);
+    TEST_PASS("Growth");
+}
+
+/**
+ * Test: after a reset the same sequence lands in the same memory
+ */
+static bool test_reset_reuses(void) {
+    ParseArena* arena = parse_arena_create(512);
+    TEST_ASSERT(arena != NULL, "Arena creation");
+
+    void* first[300];
+    for (int i = 0; i < 300; i++) {
+        first[i] = parse_arena_alloc(arena, 24);
+        TEST_ASSERT(first[i] != NULL, "Allocation");
+    }
+
+    for (int round = 0; round < 5; round++) {
+        parse_arena_reset(arena);
+        for (int i = 0; i < 300; i++) {
+            TEST_ASSERT(parse_arena_alloc(arena, 24) == first[i], "Chunks reused in order");
+        }
+    }
+
+    parse_arena_destroy(arena);
+    TEST_PASS("Reset reuses chunks");
+}
+
+/**
+ * Test: copies are NUL-terminated and independent of the source
+ */
+static bool test_strndup(void) {
+    ParseArena* arena = parse_arena_create(0);
+    TEST_ASSERT(arena != NULL, "Default arena");
+
+    char source[] = "identifier = 42";
+    char* copy = parse_arena_strndup(arena, source, 10);
+    TEST_ASSERT(copy != NULL && strcmp(copy, "identifier") == 0, "Prefix copied");
+    source[0] = 'X';
+    TEST_ASSERT(copy[0] == 'i', "Copy is independent");
+
+    char* empty = parse_arena_strndup(arena, source, 0);
+    TEST_ASSERT(empty != NULL && empty[0] == '\0', "Empty copy");
+    TEST_ASSERT(parse_arena_strndup(arena, NULL, 3) == NULL, "NULL source rejected");
+
+    parse_arena_destroy(arena);
+    TEST_PASS("Strndup");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
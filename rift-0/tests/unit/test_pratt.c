@@ -0,0 +1,338 @@
+/**
+ * =================================================================
+ * test_pratt.c - RIFT-0 Expression Parser Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Pratt parsing of classic-mode expressions
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/rift_pratt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_precedence(void);
+static bool test_unary_and_groups(void);
+static bool test_statements(void);
+static bool test_syntax_errors(void);
+static bool test_evaluation(void);
+static bool test_deep_expressions(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Expression Parser Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Precedence", test_precedence);
+    run_test("Unary And Groups", test_unary_and_groups);
+    run_test("Statements", test_statements);
+    run_test("Syntax Errors", test_syntax_errors);
+    run_test("Evaluation", test_evaluation);
+    run_test("Deep Expressions", test_deep_expressions);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/* Classic-mode operators, one character per token; blanks stay unbound */
+static RiftPratt* classic_table(void) {
+    RiftPratt* p = rift_pratt_create();
+    if (!p) return NULL;
+    for (const char* c = "0123456789abcdefghijklmnopqrstuvwxyz"; *c; c++) {
+        rift_pratt_add_operand(p, RIFT_PRATT_CHAR_KEY(*c));
+    }
+    rift_pratt_add_infix(p, '=', 1, RIFT_PRATT_RIGHT);
+    rift_pratt_add_infix(p, '+', 2, RIFT_PRATT_LEFT);
+    rift_pratt_add_infix(p, '-', 2, RIFT_PRATT_LEFT);
+    rift_pratt_add_infix(p, '*', 3, RIFT_PRATT_LEFT);
+    rift_pratt_add_infix(p, '/', 3, RIFT_PRATT_LEFT);
+    rift_pratt_add_infix(p, '^', 4, RIFT_PRATT_RIGHT);
+    rift_pratt_add_prefix(p, '-', 5);
+    rift_pratt_add_postfix(p, '!', 6);
+    rift_pratt_add_group(p, '(', ')');
+    rift_pratt_add_separator(p, ';');
+    return p;
+}
+
+static size_t keys_of(const char* text, uint32_t* keys) {
+    size_t n = 0;
+    for (; text[n]; n++) keys[n] = RIFT_PRATT_CHAR_KEY(text[n]);
+    return n;
+}
+
+typedef struct {
+    char text[256];
+    size_t length;
+} Rpn;
+
+/* Reverse Polish rendering; prefix minus prints as '~' */
+static void rpn_leave(const FlatTree* tree, uint32_t node, void* user_data) {
+    Rpn* rpn = (Rpn*)user_data;
+    uint32_t kind = tree->kinds[node];
+    char c = (char)RIFT_PRATT_KEY(kind);
+    if (!flat_tree_is_terminal(tree, node) && RIFT_PRATT_FIXITY(kind) == RIFT_PRATT_PREFIX) {
+        c = '~';
+    }
+    if (rpn->length + 2 < sizeof(rpn->text)) rpn->text[rpn->length++] = c;
+}
+
+/* Parse and render every root, roots separated by ' ' */
+static bool render(const RiftPratt* p, const char* text, char* out, size_t* error) {
+    uint32_t keys[256];
+    size_t count = keys_of(text, keys);
+    FlatTree* tree = flat_tree_create(0);
+    if (!tree) return false;
+
+    bool ok = rift_pratt_parse(p, keys, count, tree, error) == 0;
+    Rpn rpn = { .length = 0 };
+    for (uint32_t root = 0; ok && root < tree->count; root += tree->nodes[root].subtree_size) {
+        if (rpn.length) rpn.text[rpn.length++] = ' ';
+        flat_tree_visit(tree, root, NULL, rpn_leave, &rpn);
+    }
+    rpn.text[rpn.length] = '\0';
+    strcpy(out, rpn.text);
+    flat_tree_destroy(tree);
+    return ok;
+}
+
+static bool renders_as(const RiftPratt* p, const char* text, const char* expected) {
+    char out[256];
+    size_t error;
+    return render(p, text, out, &error) && strcmp(out, expected) == 0;
+}
+
+/**
+ * Test: binding powers and associativity shape the tree
+ */
+static bool test_precedence(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    TEST_ASSERT(renders_as(p, "1 + 2 * 3 - 4", "123*+4-"), "Mixed levels");
+    TEST_ASSERT(renders_as(p, "8 / 4 / 2", "84/2/"), "Left associative");
+    TEST_ASSERT(renders_as(p, "2 ^ 3 ^ 2", "232^^"), "Right associative");
+    TEST_ASSERT(renders_as(p, "a = b = 1 + c", "ab1c+=="), "Assignment binds loosest");
+    TEST_ASSERT(renders_as(p, "7", "7"), "Lone operand");
+
+    rift_pratt_destroy(p);
+    TEST_PASS("Precedence");
+}
+
+/**
+ * Test: prefix and postfix operators, brackets and their token spans
+ */
+static bool test_unary_and_groups(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    TEST_ASSERT(renders_as(p, "a - -b", "ab~-"), "Binary then unary minus");
+    TEST_ASSERT(renders_as(p, "-2 ^ 2", "2~2^"), "Prefix level above power");
+    TEST_ASSERT(renders_as(p, "-3!", "3!~"), "Postfix applies first");
+    TEST_ASSERT(renders_as(p, "3! + 1", "3!1+"), "Postfix then infix");
+    TEST_ASSERT(renders_as(p, "(1 + 2) * 3", "12+3*"), "Brackets override");
+    TEST_ASSERT(renders_as(p, "((((x))))", "x"), "Brackets add no nodes");
+
+    uint32_t keys[32];
+    size_t count = keys_of("(1+2)*3", keys);
+    FlatTree* tree = flat_tree_create(0);
+    size_t error;
+    TEST_ASSERT(rift_pratt_parse(p, keys, count, tree, &error) == 0, "Parsed");
+    TEST_ASSERT(tree->kinds[0] == (RIFT_PRATT_INFIX | '*'), "Root is *");
+    TEST_ASSERT(tree->nodes[0].first_token == 0 && tree->nodes[0].end_token == 7, "Root span");
+    TEST_ASSERT(tree->kinds[1] == (RIFT_PRATT_INFIX | '+'), "Left child is +");
+    TEST_ASSERT(tree->nodes[1].first_token == 0 && tree->nodes[1].end_token == 5,
+                "Bracketed span includes brackets");
+    flat_tree_destroy(tree);
+
+    rift_pratt_destroy(p);
+    TEST_PASS("Unary and groups");
+}
+
+/**
+ * Test: consecutive statements become sibling roots
+ */
+static bool test_statements(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    /* The !classic block of classical.rift, one letter per name */
+    TEST_ASSERT(renders_as(p, "x = 4\ny = x * 2\nr = x + y", "x4= yx2*= rxy+="),
+                "Juxtaposed operands start statements");
+    TEST_ASSERT(renders_as(p, "a = 1; ; b = 2;", "a1= b2="), "Separators");
+    TEST_ASSERT(renders_as(p, "", ""), "Empty input");
+    TEST_ASSERT(renders_as(p, "1 (2)", "1 2"), "Bracket starts a statement");
+
+    rift_pratt_destroy(p);
+    TEST_PASS("Statements");
+}
+
+/**
+ * Test: incomplete and malformed expressions report the right token
+ */
+static bool test_syntax_errors(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    char out[256];
+    size_t error = 0;
+    TEST_ASSERT(!render(p, "1 +", out, &error) && error == 3, "Dangling operator");
+    TEST_ASSERT(!render(p, "(1 + 2", out, &error) && error == 6, "Unclosed bracket");
+    TEST_ASSERT(!render(p, "1 + 2)", out, &error) && error == 5, "Unopened bracket");
+    TEST_ASSERT(!render(p, "* 1", out, &error) && error == 0, "Leading infix");
+    TEST_ASSERT(!render(p, "1 + ;", out, &error) && error == 4, "Separator inside");
+    TEST_ASSERT(!render(p, "(1; 2)", out, &error) && error == 2, "Separator in brackets");
+
+    TEST_ASSERT(rift_pratt_add_infix(p, '+', 0, RIFT_PRATT_LEFT) == -1, "Level 0 rejected");
+    TEST_ASSERT(rift_pratt_add_operand(p, RIFT_PRATT_MAX_KEY + 1) == -1, "Key range");
+
+    rift_pratt_destroy(p);
+    TEST_PASS("Syntax errors");
+}
+
+typedef struct {
+    const char* text;
+    long values[64];
+    size_t depth;
+} Evaluator;
+
+static void evaluate_leave(const FlatTree* tree, uint32_t node, void* user_data) {
+    Evaluator* e = (Evaluator*)user_data;
+    uint32_t kind = tree->kinds[node];
+    if (flat_tree_is_terminal(tree, node)) {
+        e->values[e->depth++] = e->text[tree->nodes[node].first_token] - '0';
+        return;
+    }
+    if (RIFT_PRATT_FIXITY(kind) == RIFT_PRATT_PREFIX) {
+        e->values[e->depth - 1] = -e->values[e->depth - 1];
+        return;
+    }
+    long rhs = e->values[--e->depth];
+    long* lhs = &e->values[e->depth - 1];
+    switch (RIFT_PRATT_KEY(kind)) {
+        case '+': *lhs += rhs; break;
+        case '-': *lhs -= rhs; break;
+        case '*': *lhs *= rhs; break;
+        case '/': *lhs /= rhs; break;
+        default: break;
+    }
+}
+
+/**
+ * Test: a post-order walk of the tree evaluates the expression
+ */
+static bool test_evaluation(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    const char* text = "2 * (3 + 4) - 8 / 2 + -1";
+    uint32_t keys[64];
+    size_t count = keys_of(text, keys);
+    FlatTree* tree = flat_tree_create(0);
+    size_t error;
+    TEST_ASSERT(rift_pratt_parse(p, keys, count, tree, &error) == 0, "Parsed");
+
+    Evaluator e = { .text = text, .depth = 0 };
+    flat_tree_visit(tree, 0, NULL, evaluate_leave, &e);
+    TEST_ASSERT(e.depth == 1 && e.values[0] == 9, "2*(3+4)-8/2+-1 == 9");
+
+    flat_tree_destroy(tree);
+    rift_pratt_destroy(p);
+    TEST_PASS("Evaluation");
+}
+
+#define DEEP_TOKENS 300001
+
+/**
+ * Test: deep nesting and long chains need no recursion
+ */
+static bool test_deep_expressions(void) {
+    RiftPratt* p = classic_table();
+    TEST_ASSERT(p != NULL, "Table creation");
+
+    uint32_t* keys = malloc(DEEP_TOKENS * sizeof(uint32_t));
+    FlatTree* tree = flat_tree_create(0);
+    TEST_ASSERT(keys && tree, "Buffers");
+    size_t error;
+
+    /* ((((...1...)))) */
+    size_t depth = DEEP_TOKENS / 2;
+    for (size_t i = 0; i < depth; i++) {
+        keys[i] = '(';
+        keys[depth + 1 + i] = ')';
+    }
+    keys[depth] = '1';
+    TEST_ASSERT(rift_pratt_parse(p, keys, DEEP_TOKENS, tree, &error) == 0, "Deep brackets");
+    TEST_ASSERT(tree->count == 1 && tree->nodes[0].end_token == DEEP_TOKENS, "One spanning leaf");
+
+    /* 1^1^1^...: right associative, so every operator waits on the stack */
+    for (size_t i = 0; i < DEEP_TOKENS; i++) keys[i] = i % 2 ? '^' : '1';
+    TEST_ASSERT(rift_pratt_parse(p, keys, DEEP_TOKENS, tree, &error) == 0, "Right chain");
+    TEST_ASSERT(tree->count == DEEP_TOKENS, "Node per token");
+    TEST_ASSERT(tree->nodes[DEEP_TOKENS - 2].parent == DEEP_TOKENS - 3, "Nested to the right");
+
+    /* -(-(-(...1))) */
+    for (size_t i = 0; i < DEEP_TOKENS - 1; i++) keys[i] = '-';
+    keys[DEEP_TOKENS - 1] = '1';
+    TEST_ASSERT(rift_pratt_parse(p, keys, DEEP_TOKENS, tree, &error) == 0, "Prefix chain");
+    TEST_ASSERT(tree->count == DEEP_TOKENS, "Node per token");
+
+    flat_tree_destroy(tree);
+    free(keys);
+    rift_pratt_destroy(p);
+    TEST_PASS("Deep expressions");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
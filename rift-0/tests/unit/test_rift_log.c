@@ -0,0 +1,284 @@
+/**
+ * =================================================================
+ * test_rift_log.c - RIFT-0 Logging Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Leveled, buffered library logging
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_level_filtering(void);
+static bool test_arguments_not_evaluated(void);
+static bool test_binary_records(void);
+static bool test_async_delivery(void);
+static bool test_shutdown_live_threads(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Logging Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Level Filtering", test_level_filtering);
+    run_test("Arguments Not Evaluated", test_arguments_not_evaluated);
+    run_test("Binary Records", test_binary_records);
+    run_test("Async Delivery", test_async_delivery);
+    run_test("Shutdown With Live Threads", test_shutdown_live_threads);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/* Log into an anonymous temporary file and read it back */
+static int open_capture(void) {
+    FILE* f = tmpfile();
+    return f ? dup(fileno(f)) : -1;
+}
+
+static size_t read_capture(int fd, char* buffer, size_t size) {
+    lseek(fd, 0, SEEK_SET);
+    ssize_t n = read(fd, buffer, size - 1);
+    buffer[n > 0 ? n : 0] = '\0';
+    return n > 0 ? (size_t)n : 0;
+}
+
+/**
+ * Test: only records at or above the runtime level are written
+ */
+static bool test_level_filtering(void) {
+    int fd = open_capture();
+    TEST_ASSERT(fd >= 0, "Capture file");
+
+    RiftLogConfig config = { RIFT_LOG_LEVEL_INFO, fd, false, false, 0 };
+    TEST_ASSERT(rift_log_init(&config) == 0, "Init succeeds");
+
+    RIFT_LOG_DEBUG("hidden %d", 1);
+    RIFT_LOG_INFO("shown %d", 2);
+    RIFT_LOG_ERROR("failure %s", "x");
+    rift_log_flush();
+
+    char buffer[1024];
+    read_capture(fd, buffer, sizeof(buffer));
+    TEST_ASSERT(strstr(buffer, "hidden") == NULL, "DEBUG filtered");
+    TEST_ASSERT(strstr(buffer, "[INFO] test_rift_log.c:") != NULL, "INFO prefix");
+    TEST_ASSERT(strstr(buffer, "shown 2\n") != NULL, "INFO message");
+    TEST_ASSERT(strstr(buffer, "[ERROR]") != NULL, "ERROR written");
+
+    TEST_ASSERT(rift_log_level_from_string("warning") == RIFT_LOG_LEVEL_WARN,
+                "Level names parse");
+
+    rift_log_shutdown();
+    close(fd);
+    TEST_PASS("Level filtering");
+}
+
+static int g_evaluations;
+static int count_evaluation(void) {
+    return ++g_evaluations;
+}
+
+/**
+ * Test: a disabled record costs a branch, never its arguments
+ */
+static bool test_arguments_not_evaluated(void) {
+    rift_log_set_level(RIFT_LOG_LEVEL_OFF);
+    g_evaluations = 0;
+
+    RIFT_LOG_ERROR("value %d", count_evaluation());
+    TEST_ASSERT(g_evaluations == 0, "Arguments skipped when disabled");
+
+    rift_log_set_level(RIFT_LOG_DEFAULT_LEVEL);
+    TEST_PASS("Arguments not evaluated");
+}
+
+/**
+ * Test: binary mode produces framed records
+ */
+static bool test_binary_records(void) {
+    int fd = open_capture();
+    TEST_ASSERT(fd >= 0, "Capture file");
+
+    RiftLogConfig config = { RIFT_LOG_LEVEL_TRACE, fd, false, true, 0 };
+    TEST_ASSERT(rift_log_init(&config) == 0, "Init succeeds");
+
+    RIFT_LOG_WARN("binary %d", 7);
+    rift_log_flush();
+
+    char buffer[1024];
+    size_t n = read_capture(fd, buffer, sizeof(buffer));
+    TEST_ASSERT(n > sizeof(RiftLogRecordHeader), "Record written");
+
+    RiftLogRecordHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    TEST_ASSERT(header.magic == RIFT_LOG_BINARY_MAGIC, "Magic");
+    TEST_ASSERT(header.level == RIFT_LOG_LEVEL_WARN, "Level");
+    TEST_ASSERT(sizeof(header) + header.length == n, "Length covers payload");
+
+    const char* file = buffer + sizeof(header);
+    TEST_ASSERT(strcmp(file, "test_rift_log.c") == 0, "File name");
+    TEST_ASSERT(memcmp(file + strlen(file) + 1, "binary 7", 8) == 0, "Message");
+
+    rift_log_shutdown();
+    close(fd);
+    TEST_PASS("Binary records");
+}
+
+static void* log_worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    for (int i = 0; i < 500; i++) {
+        RIFT_LOG_INFO("worker %d record %d", id, i);
+    }
+    return NULL;
+}
+
+/**
+ * Test: records buffered on worker threads all reach the descriptor
+ */
+static bool test_async_delivery(void) {
+    int fd = open_capture();
+    TEST_ASSERT(fd >= 0, "Capture file");
+
+    RiftLogConfig config = { RIFT_LOG_LEVEL_INFO, fd, true, false, 1024 };
+    TEST_ASSERT(rift_log_init(&config) == 0, "Async init succeeds");
+
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, log_worker, (void*)(intptr_t)i);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    rift_log_shutdown();
+
+    size_t size = (size_t)lseek(fd, 0, SEEK_END);
+    char* buffer = malloc(size + 1);
+    TEST_ASSERT(buffer != NULL, "Read buffer");
+    read_capture(fd, buffer, size + 1);
+
+    int lines = 0;
+    for (char* p = buffer; *p; p++) {
+        if (*p == '\n') lines++;
+    }
+    bool last_seen = strstr(buffer, "worker 3 record 499\n") != NULL;
+    free(buffer);
+    close(fd);
+
+    TEST_ASSERT(lines == 2000, "Every record delivered once");
+    TEST_ASSERT(last_seen, "Final record delivered at thread exit");
+    TEST_PASS("Async delivery");
+}
+
+static pthread_barrier_t g_logged;
+static pthread_barrier_t g_shut_down;
+
+static void* idle_worker(void* arg) {
+    int id = (int)(intptr_t)arg;
+    for (int i = 0; i < 10; i++) {
+        RIFT_LOG_INFO("idle %d record %d", id, i);
+    }
+    pthread_barrier_wait(&g_logged);
+    pthread_barrier_wait(&g_shut_down);
+    return NULL;
+}
+
+/**
+ * Test: shutdown ships records still buffered by threads that are alive
+ */
+static bool test_shutdown_live_threads(void) {
+    int fd = open_capture();
+    TEST_ASSERT(fd >= 0, "Capture file");
+
+    RiftLogConfig config = { RIFT_LOG_LEVEL_INFO, fd, true, false, 4096 };
+    TEST_ASSERT(rift_log_init(&config) == 0, "Async init succeeds");
+
+    pthread_barrier_init(&g_logged, NULL, 5);
+    pthread_barrier_init(&g_shut_down, NULL, 5);
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, idle_worker, (void*)(intptr_t)i);
+    }
+    pthread_barrier_wait(&g_logged);
+    rift_log_shutdown();
+
+    size_t size = (size_t)lseek(fd, 0, SEEK_END);
+    char* buffer = malloc(size + 1);
+    TEST_ASSERT(buffer != NULL, "Read buffer");
+    read_capture(fd, buffer, size + 1);
+
+    pthread_barrier_wait(&g_shut_down);
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_barrier_destroy(&g_logged);
+    pthread_barrier_destroy(&g_shut_down);
+
+    int lines = 0;
+    for (char* p = buffer; *p; p++) {
+        if (*p == '\n') lines++;
+    }
+    free(buffer);
+    close(fd);
+
+    TEST_ASSERT(lines == 40, "Records of live threads delivered at shutdown");
+    TEST_PASS("Shutdown with live threads");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
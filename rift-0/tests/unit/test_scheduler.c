@@ -0,0 +1,260 @@
+/**
+ * =================================================================
+ * test_scheduler.c - RIFT-0 Cooperative Job Scheduler Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: M:N scheduling of governed jobs
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_scheduler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_interleaving(void);
+static bool test_many_jobs(void);
+static bool test_time_slice(void);
+static bool test_outside_job(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Cooperative Job Scheduler Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Interleaving", test_interleaving);
+    run_test("Many Jobs", test_many_jobs);
+    run_test("Time Slice", test_time_slice);
+    run_test("Outside Job", test_outside_job);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+typedef struct {
+    char* log;
+    size_t* length;
+    int* arrived;
+    char tag;
+} TraceJob;
+
+static void trace_job(void* arg) {
+    TraceJob* job = (TraceJob*)arg;
+
+    /* Both jobs share one worker, so this wait only works by yielding */
+    (*job->arrived)++;
+    while (*job->arrived < 2) rift_job_yield();
+
+    for (int i = 0; i < 3; i++) {
+        job->log[(*job->length)++] = job->tag;
+        rift_job_yield();
+    }
+}
+
+/**
+ * Test: on one worker, yielding jobs take turns
+ */
+static bool test_interleaving(void) {
+    RiftSchedulerConfig config = { 1, 0, 0, 0 };
+    RiftScheduler* s = rift_scheduler_create(&config);
+    TEST_ASSERT(s != NULL, "Scheduler creation");
+
+    char log[16] = { 0 };
+    size_t length = 0;
+    int arrived = 0;
+    TraceJob a = { log, &length, &arrived, 'A' };
+    TraceJob b = { log, &length, &arrived, 'B' };
+
+    TEST_ASSERT(rift_scheduler_spawn(s, trace_job, &a) == 0, "Spawn A");
+    TEST_ASSERT(rift_scheduler_spawn(s, trace_job, &b) == 0, "Spawn B");
+    rift_scheduler_wait(s);
+
+    TEST_ASSERT(length == 6, "Every step logged");
+    for (size_t i = 1; i < length; i++) {
+        TEST_ASSERT(log[i] != log[i - 1], "Jobs alternate at each yield");
+    }
+
+    RiftSchedulerStats stats;
+    rift_scheduler_get_stats(s, &stats);
+    TEST_ASSERT(stats.completed == 2, "Both completed");
+    TEST_ASSERT(stats.switches >= 6, "Every yield resumed later");
+
+    rift_scheduler_destroy(s);
+    TEST_PASS("Interleaving");
+}
+
+#define MANY_JOBS 5000
+#define YIELDS_PER_JOB 20
+
+typedef struct {
+    atomic_long* total;
+    atomic_int* thread_changes;
+} CountJob;
+
+static void count_job(void* arg) {
+    CountJob* job = (CountJob*)arg;
+    pthread_t home = pthread_self();
+
+    for (int i = 0; i < YIELDS_PER_JOB; i++) {
+        /* Thread-local addresses cached before a yield must stay valid */
+        rift_job_yield();
+        if (!pthread_equal(home, pthread_self())) {
+            atomic_fetch_add(job->thread_changes, 1);
+        }
+        atomic_fetch_add(job->total, 1);
+    }
+}
+
+/**
+ * Test: thousands of yielding jobs on a few workers, none migrating
+ */
+static bool test_many_jobs(void) {
+    RiftSchedulerConfig config = { 3, 16 * 1024, 0, 64 };
+    RiftScheduler* s = rift_scheduler_create(&config);
+    TEST_ASSERT(s != NULL, "Scheduler creation");
+
+    atomic_long total;
+    atomic_int thread_changes;
+    atomic_init(&total, 0);
+    atomic_init(&thread_changes, 0);
+    CountJob job = { &total, &thread_changes };
+
+    for (int i = 0; i < MANY_JOBS; i++) {
+        TEST_ASSERT(rift_scheduler_spawn(s, count_job, &job) == 0, "Spawn");
+    }
+    rift_scheduler_wait(s);
+
+    TEST_ASSERT(atomic_load(&total) == (long)MANY_JOBS * YIELDS_PER_JOB, "Every step ran");
+    TEST_ASSERT(atomic_load(&thread_changes) == 0, "Jobs stay on their worker");
+
+    RiftSchedulerStats stats;
+    rift_scheduler_get_stats(s, &stats);
+    TEST_ASSERT(stats.spawned == MANY_JOBS && stats.completed == MANY_JOBS, "All retired");
+    TEST_ASSERT(stats.switches == (size_t)MANY_JOBS * YIELDS_PER_JOB, "Switch count");
+
+    rift_scheduler_destroy(s);
+    TEST_PASS("Many jobs");
+}
+
+typedef struct {
+    atomic_int* turns;
+    int* yields;
+} SliceJob;
+
+static void slice_job(void* arg) {
+    SliceJob* job = (SliceJob*)arg;
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    /* Spin ~20 ms, yielding only when the scheduler asks */
+    do {
+        if (rift_job_should_yield()) {
+            (*job->yields)++;
+            rift_job_yield();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((now.tv_sec - start.tv_sec) * 1000000000L + (now.tv_nsec - start.tv_nsec)
+             < 20 * 1000000L);
+    atomic_fetch_add(job->turns, 1);
+}
+
+/**
+ * Test: should_yield fires after the slice only when others are waiting
+ */
+static bool test_time_slice(void) {
+    RiftSchedulerConfig config = { 1, 0, 500, 0 };
+    RiftScheduler* s = rift_scheduler_create(&config);
+    TEST_ASSERT(s != NULL, "Scheduler creation");
+
+    atomic_int turns;
+    atomic_init(&turns, 0);
+    int alone = 0;
+    SliceJob solo = { &turns, &alone };
+    rift_scheduler_spawn(s, slice_job, &solo);
+    rift_scheduler_wait(s);
+    TEST_ASSERT(alone == 0, "A lone job is never asked to yield");
+
+    int yields_a = 0, yields_b = 0;
+    SliceJob a = { &turns, &yields_a };
+    SliceJob b = { &turns, &yields_b };
+    rift_scheduler_spawn(s, slice_job, &a);
+    rift_scheduler_spawn(s, slice_job, &b);
+    rift_scheduler_wait(s);
+
+    TEST_ASSERT(atomic_load(&turns) == 3, "All jobs finished");
+    TEST_ASSERT(yields_a > 0 && yields_b > 0, "Competing jobs share the worker");
+
+    rift_scheduler_destroy(s);
+    TEST_PASS("Time slice");
+}
+
+/**
+ * Test: the job API is harmless outside the scheduler
+ */
+static bool test_outside_job(void) {
+    TEST_ASSERT(!rift_job_in_scheduler(), "Not in a job");
+    TEST_ASSERT(!rift_job_should_yield(), "No slice outside a job");
+    rift_job_yield();
+
+    RiftScheduler* s = rift_scheduler_create(NULL);
+    TEST_ASSERT(s != NULL, "Default configuration");
+    rift_scheduler_wait(s);
+    rift_scheduler_destroy(s);
+    TEST_PASS("Outside job");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,1192 @@
+/**
+ * =================================================================
+ * test_tb_parser.c - RIFT-0 Dual-Mode Parser Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: [tb] parsing, consensus and YODA bitmaps
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/parser/rift_tb_parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_dual_mode_consensus(void);
+static bool test_consensus_with_grammar(void);
+static bool test_persistent_worker(void);
+static bool test_reparse_lookahead(void);
+static bool test_reparse_random_edits(void);
+static bool test_yoda_batch(void);
+static bool test_token_views(void);
+static bool test_invariant_slice(void);
+static bool test_parse_blocks(void);
+static bool test_stream_sink(void);
+static bool test_stream_ring(void);
+static bool test_multiline_tokens(void);
+static bool test_parity_exclusion(void);
+static bool test_parity_sequence(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Dual-Mode Parser Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Dual Mode Consensus", test_dual_mode_consensus);
+    run_test("Consensus With Grammar", test_consensus_with_grammar);
+    run_test("Persistent Worker", test_persistent_worker);
+    run_test("Reparse Lookahead", test_reparse_lookahead);
+    run_test("Reparse Random Edits", test_reparse_random_edits);
+    run_test("YODA Batch", test_yoda_batch);
+    run_test("Token Views", test_token_views);
+    run_test("Invariant Slice", test_invariant_slice);
+    run_test("Parse Blocks", test_parse_blocks);
+    run_test("Stream Sink", test_stream_sink);
+    run_test("Stream Ring", test_stream_ring);
+    run_test("Multi-line Tokens", test_multiline_tokens);
+    run_test("Parity Exclusion", test_parity_exclusion);
+    run_test("Parity Sequence", test_parity_sequence);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+/* =================================================================
+ * FIXTURE
+ * =================================================================
+ */
+
+/* Numbers are lexed by both passes, words by bottom-up only */
+static DualModeParser* split_parser(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    if (!parser) return NULL;
+    if (!rift_tb_add_pattern(parser, "[0-9]+", "[tb]", false) ||
+        !rift_tb_add_pattern(parser, "[a-z]+", "[b]", false)) {
+        rift_tb_parser_destroy(parser);
+        return NULL;
+    }
+    return parser;
+}
+
+static bool bit_set(const uint64_t* bitmap, size_t i) {
+    return (bitmap[i / 64] >> (i % 64)) & 1;
+}
+
+/* Token i of the bottom-up stream is a number exactly when both
+ * passes should have produced it */
+static bool consensus_matches_numbers(const uint64_t* consensus,
+                                      const TokenMemory* tokens,
+                                      size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (bit_set(consensus, i) != (tokens[i].token_type == 0)) return false;
+    }
+    return true;
+}
+
+/* Words and numbers separated by spaces, every third a word */
+static size_t mixed_input(char* buffer, size_t size) {
+    size_t length = 0;
+    for (size_t i = 0; length + 24 < size; i++) {
+        if (i % 3 == 0) {
+            length += (size_t)snprintf(buffer + length, size - length, "w%c ",
+                                       (char)('a' + i % 26));
+        } else {
+            length += (size_t)snprintf(buffer + length, size - length, "%zu ", i);
+        }
+    }
+    return length;
+}
+
+/* A parser over patterns, all added with flags, in mode */
+static DualModeParser* pattern_parser(const char* const* patterns, const char* flags,
+                                      ParseMode mode, bool copies) {
+    DualModeParser* parser = rift_tb_parser_create();
+    if (!parser) return NULL;
+    for (size_t i = 0; patterns[i]; i++) {
+        if (!rift_tb_add_pattern(parser, patterns[i], flags, false)) {
+            rift_tb_parser_destroy(parser);
+            return NULL;
+        }
+    }
+    parser->current_mode = mode;
+    rift_tb_set_copy_lexemes(parser, copies);
+    return parser;
+}
+
+static bool same_tokens(const TokenMemory* a, size_t a_count,
+                        const TokenMemory* b, size_t b_count,
+                        const char* input, bool copies) {
+    if (a_count != b_count) return false;
+    for (size_t i = 0; i < a_count; i++) {
+        if (a[i].token_type != b[i].token_type ||
+            a[i].token_value != b[i].token_value ||
+            a[i].lexeme_start != b[i].lexeme_start ||
+            a[i].lexeme_end != b[i].lexeme_end) {
+            return false;
+        }
+        size_t length = a[i].lexeme_end - a[i].lexeme_start;
+        const char* lexeme = (const char*)a[i].memory_value;
+        if (copies ? strlen(lexeme) != length : lexeme != input + a[i].lexeme_start) {
+            return false;
+        }
+        if (memcmp(lexeme, input + a[i].lexeme_start, length) != 0) return false;
+    }
+    return true;
+}
+
+static void free_copies(TokenMemory* tokens, size_t count, bool copies) {
+    if (!copies) return;
+    for (size_t i = 0; i < count; i++) free(tokens[i].memory_value);
+}
+
+/* Apply edit to the reparsed stream and check it against a full parse
+ * of the new input by a second parser of the same setup */
+static bool reparse_matches(DualModeParser* parser,
+                            DualModeParser* reference,
+                            const char* input,
+                            size_t length,
+                            const RiftTbEdit* edit,
+                            TokenMemory* tokens,
+                            size_t* count) {
+    if (rift_tb_reparse(parser, input, length, edit, tokens, count) != 0) return false;
+
+    TokenMemory* full = NULL;
+    size_t full_count = 0;
+    if (rift_tb_parse_input(reference, input, length, &full, &full_count) != 0) return false;
+
+    bool copies = parser->copy_lexemes;
+    bool ok = same_tokens(tokens, *count, full, full_count, input, copies);
+    if (ok && parser->current_mode == PARSE_MODE_DUAL) {
+        const uint64_t* consensus = NULL;
+        const uint64_t* expected = NULL;
+        rift_tb_consensus_bitmap(parser, &consensus);
+        rift_tb_consensus_bitmap(reference, &expected);
+        for (size_t i = 0; ok && i < full_count; i++) {
+            ok = bit_set(consensus, i) == bit_set(expected, i);
+        }
+    }
+    free_copies(full, full_count, copies);
+    free(full);
+    return ok;
+}
+
+static uint32_t g_random = 2463534242u;
+
+static uint32_t next_random(void) {
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+    return g_random;
+}
+
+/* =================================================================
+ * TESTS
+ * =================================================================
+ */
+
+/**
+ * Test: consensus goes to its bitmap and leaves token types alone
+ */
+static bool test_dual_mode_consensus(void) {
+    DualModeParser* parser = split_parser();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+
+    const char* input = "ab 12 cd 34 ef";
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    TEST_ASSERT(rift_tb_parse_input(parser, input, strlen(input), &tokens, &count) == 0,
+                "Dual-mode parse");
+    TEST_ASSERT(count == 5, "Bottom-up stream is the output");
+
+    uint32_t expected[] = { 1, 0, 1, 0, 1 };
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT(tokens[i].token_type == expected[i], "Types are pattern indices");
+    }
+
+    const uint64_t* consensus = NULL;
+    TEST_ASSERT(rift_tb_consensus_bitmap(parser, &consensus), "Consensus bitmap");
+    TEST_ASSERT(consensus[0] == 0x0A, "Only the numbers agree");
+
+    /* A later parse replaces the bitmap, stale bits included */
+    const char* numbers = "1 2 3";
+    free(tokens);
+    TEST_ASSERT(rift_tb_parse_input(parser, numbers, strlen(numbers), &tokens, &count) == 0,
+                "Second parse");
+    TEST_ASSERT(count == 3 && consensus[0] == 0x07, "Every number agrees");
+
+    free(tokens);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Dual-mode consensus");
+}
+
+/**
+ * Test: the grammar sees plain types with consensus marked
+ */
+static bool test_consensus_with_grammar(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    TEST_ASSERT(rift_tb_add_terminal(parser, "NUM", "[0-9]+", "[tb]"), "NUM terminal");
+    TEST_ASSERT(rift_tb_add_terminal(parser, "WORD", "[a-z]+", "[b]"), "WORD terminal");
+    TEST_ASSERT(rift_tb_add_rule(parser, "list : list item | item ;\n"
+                                         "item : NUM | WORD ;\n"), "Rules");
+
+    const char* input = "x 1 y 2";
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    TEST_ASSERT(rift_tb_parse_input(parser, input, strlen(input), &tokens, &count) == 0,
+                "Dual-mode parse");
+    TEST_ASSERT(count == 4, "Four tokens");
+    TEST_ASSERT(rift_tb_parse_tree(parser) != NULL, "Grammar accepted the stream");
+
+    const uint64_t* consensus = NULL;
+    TEST_ASSERT(rift_tb_consensus_bitmap(parser, &consensus), "Consensus bitmap");
+    TEST_ASSERT(consensus_matches_numbers(consensus, tokens, count), "Numbers agree");
+
+    free(tokens);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Consensus with grammar");
+}
+
+/**
+ * Test: the worker kept by the parser serves parse after parse
+ */
+static bool test_persistent_worker(void) {
+    DualModeParser* parser = split_parser();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    TEST_ASSERT(parser->workers != NULL, "Worker created with the parser");
+
+    static char input[16000];
+    size_t length = mixed_input(input, sizeof(input));
+    const uint64_t* consensus = NULL;
+    TEST_ASSERT(rift_tb_consensus_bitmap(parser, &consensus), "Consensus bitmap");
+
+    TokenMemory* tokens = NULL;
+    size_t first_count = 0;
+    for (int round = 0; round < 200; round++) {
+        size_t count = 0;
+        TEST_ASSERT(rift_tb_parse_input(parser, input, length, &tokens, &count) == 0,
+                    "Dual-mode parse");
+        if (round == 0) first_count = count;
+        TEST_ASSERT(count == first_count && count > 1000, "Same stream every round");
+        TEST_ASSERT(consensus_matches_numbers(consensus, tokens, count),
+                    "Consensus stable across parses");
+        free(tokens);
+
+        /* Single-mode parses in between leave the worker idle */
+        if (round % 50 == 49) {
+            parser->current_mode = PARSE_MODE_BOTTOM_UP;
+            TEST_ASSERT(rift_tb_parse_input(parser, input, length, &tokens, &count) == 0 &&
+                        count == first_count, "Bottom-up parse");
+            free(tokens);
+            parser->current_mode = PARSE_MODE_DUAL;
+        }
+    }
+    TEST_ASSERT(atomic_load(&parser->stats.parity_eliminations) == 200, "Every round dual");
+    TEST_ASSERT(atomic_load(&parser->stats.top_down_ops) >= 200 * first_count / 2,
+                "Top-down pass ran every round");
+
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Persistent worker");
+}
+
+static const char* const g_decimal_patterns[] = {
+    "[0-9]+\\.[0-9]+", "[0-9]+", "[.a-z]", NULL
+};
+static const char* const g_keyword_patterns[] = { "abcd", "a", "[a-z]", NULL };
+
+/* Block comments span lines; stray comment bytes are tokens too */
+#define COMMENT_PATTERN "/\\*([^*]|\\*+[^*/])*\\*+/"
+static const char* const g_comment_patterns[] = {
+    COMMENT_PATTERN, "[a-z]+", "[*/]", NULL
+};
+
+static const ParseMode g_modes[] = {
+    PARSE_MODE_DUAL, PARSE_MODE_TOP_DOWN, PARSE_MODE_BOTTOM_UP
+};
+
+/* Parse before, edit it into after and check the reparse in every mode */
+static bool reparse_case(const char* const* patterns,
+                         const char* flags,
+                         const char* before,
+                         const char* after,
+                         RiftTbEdit edit) {
+    for (size_t m = 0; m < sizeof(g_modes) / sizeof(g_modes[0]); m++) {
+        DualModeParser* parser = pattern_parser(patterns, flags, g_modes[m], false);
+        DualModeParser* reference = pattern_parser(patterns, flags, g_modes[m], false);
+        TokenMemory* tokens = NULL;
+        size_t count = 0;
+        bool ok = parser && reference &&
+                  rift_tb_parse_input(parser, before, strlen(before), &tokens, &count) == 0 &&
+                  reparse_matches(parser, reference, after, strlen(after), &edit,
+                                  tokens, &count);
+        free(tokens);
+        rift_tb_parser_destroy(reference);
+        rift_tb_parser_destroy(parser);
+        if (!ok) return false;
+    }
+    return true;
+}
+
+/**
+ * Test: tokens before an edit are re-lexed when their match could
+ * have looked into it
+ */
+static bool test_reparse_lookahead(void) {
+    /* "1" was a number because ".x" could not continue it; "1.5" is one */
+    RiftTbEdit decimal = { 6, 7, 7 };
+    TEST_ASSERT(reparse_case(g_decimal_patterns, "[tb]", "x = 1.x", "x = 1.5", decimal),
+                "Decimal completed by the edit");
+
+    /* "abc" were three letters until the keyword was completed */
+    RiftTbEdit keyword = { 3, 4, 4 };
+    TEST_ASSERT(reparse_case(g_keyword_patterns, "[tb]", "abcX", "abcd", keyword),
+                "Keyword completed by the edit");
+    TEST_ASSERT(reparse_case(g_keyword_patterns, "[tb]", "abcd", "abcX", keyword),
+                "Keyword broken by the edit");
+
+    /* Later lines are shifted; with line matching earlier ones are kept */
+    RiftTbEdit line = { 8, 8, 10 };
+    TEST_ASSERT(reparse_case(g_decimal_patterns, "[tb]", "1.5 ab\n1.x\n2.25",
+                             "1.5 ab\n1.5.x\n2.25", line), "Multi-line edit");
+    TEST_ASSERT(reparse_case(g_decimal_patterns, "m[tb]", "1.5 ab\n1.x\n2.25",
+                             "1.5 ab\n1.5.x\n2.25", line), "Multi-line edit, line matching");
+
+    /* Closing a comment on a later line swallows the line it opened on */
+    RiftTbEdit close = { 9, 9, 12 };
+    TEST_ASSERT(reparse_case(g_comment_patterns, "[tb]", "a /* b\nc d", "a /* b\nc */ d",
+                             close), "Comment closed by the edit");
+    RiftTbEdit reopen = { 9, 12, 9 };
+    TEST_ASSERT(reparse_case(g_comment_patterns, "[tb]", "a /* b\nc */ d", "a /* b\nc d",
+                             reopen), "Comment reopened by the edit");
+
+    TEST_PASS("Reparse lookahead");
+}
+
+/* Random text over the characters the patterns care about */
+static void random_text(char* out, size_t length) {
+    static const char alphabet[] = "abcd1.5 \n/*";
+    for (size_t i = 0; i < length; i++) {
+        out[i] = alphabet[next_random() % (sizeof(alphabet) - 1)];
+    }
+}
+
+/* A chain of random edits, each checked against a full parse */
+static bool random_edits(const char* const* patterns, const char* flags, ParseMode mode,
+                         bool copies, size_t initial, size_t edits) {
+    DualModeParser* parser = pattern_parser(patterns, flags, mode, copies);
+    DualModeParser* reference = pattern_parser(patterns, flags, mode, copies);
+    if (!parser || !reference) return false;
+
+    /* Spans point into the input, so each edit writes the other buffer */
+    size_t capacity = initial * 2 + 64;
+    char* buffers[2] = { malloc(capacity + 1), malloc(capacity + 1) };
+    size_t length = initial;
+    random_text(buffers[0], length);
+    buffers[0][length] = '\0';
+
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    bool ok = buffers[0] && buffers[1] &&
+              rift_tb_parse_input(parser, buffers[0], length, &tokens, &count) == 0;
+
+    for (size_t n = 0; ok && n < edits; n++) {
+        const char* old_text = buffers[n % 2];
+        char* new_text = buffers[(n + 1) % 2];
+
+        RiftTbEdit edit;
+        edit.start = next_random() % (length + 1);
+        edit.old_end = edit.start + next_random() % (length - edit.start + 1) % 6;
+        size_t inserted = next_random() % 6;
+        if (length - (edit.old_end - edit.start) + inserted > capacity) inserted = 0;
+        edit.new_end = edit.start + inserted;
+
+        memcpy(new_text, old_text, edit.start);
+        random_text(new_text + edit.start, inserted);
+        memcpy(new_text + edit.new_end, old_text + edit.old_end, length - edit.old_end);
+        length = length - (edit.old_end - edit.start) + inserted;
+        new_text[length] = '\0';
+
+        ok = reparse_matches(parser, reference, new_text, length, &edit, tokens, &count);
+    }
+
+    free_copies(tokens, count, copies);
+    free(tokens);
+    free(buffers[0]);
+    free(buffers[1]);
+    rift_tb_parser_destroy(reference);
+    rift_tb_parser_destroy(parser);
+    return ok;
+}
+
+/**
+ * Test: random edits in every mode give what a full parse gives
+ */
+static bool test_reparse_random_edits(void) {
+    for (size_t m = 0; m < sizeof(g_modes) / sizeof(g_modes[0]); m++) {
+        TEST_ASSERT(random_edits(g_decimal_patterns, "[tb]", g_modes[m], false, 300, 300),
+                    "Decimal patterns");
+        TEST_ASSERT(random_edits(g_keyword_patterns, "[tb]", g_modes[m], false, 300, 300),
+                    "Keyword patterns");
+        TEST_ASSERT(random_edits(g_decimal_patterns, "m[tb]", g_modes[m], false, 300, 300),
+                    "Decimal patterns, line matching");
+        TEST_ASSERT(random_edits(g_comment_patterns, "[tb]", g_modes[m], false, 300, 300),
+                    "Comment patterns");
+    }
+    TEST_ASSERT(random_edits(g_decimal_patterns, "[tb]", PARSE_MODE_BOTTOM_UP, true, 300, 200),
+                "Copied lexemes");
+
+    /* Past memory_size tokens the stream is cut short, before and after */
+    TEST_ASSERT(random_edits(g_keyword_patterns, "[tb]", PARSE_MODE_BOTTOM_UP, false,
+                             6000, 100), "Capped stream");
+    TEST_ASSERT(random_edits(g_keyword_patterns, "m[tb]", PARSE_MODE_BOTTOM_UP, false,
+                             6000, 100), "Capped stream, line matching");
+
+    TEST_PASS("Reparse random edits");
+}
+
+/* Bitmaps from a batch call agree with rift_tb_yoda_evaluate token by
+ * token, bits past count included (they must be clear) */
+static bool batch_matches(DualModeParser* parser,
+                          const TokenMemory* tokens,
+                          size_t count,
+                          YodaConfig* config,
+                          const uint64_t* invariant,
+                          const uint64_t* truth) {
+    for (size_t i = 0; i < YODA_BITMAP_WORDS(count) * 64; i++) {
+        YodaEvalResult result = i < count
+            ? rift_tb_yoda_evaluate(parser, &tokens[i], config)
+            : YODA_EVAL_FALSE;
+        if (bit_set(invariant, i) != (result == YODA_EVAL_INVARIANT)) return false;
+        if (bit_set(truth, i) != (result == YODA_EVAL_TRUE)) return false;
+    }
+    return true;
+}
+
+/**
+ * Test: batch and column evaluation against the per-token evaluator
+ */
+static bool test_yoda_batch(void) {
+    DualModeParser* parser = split_parser();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+
+    /* Every mix of invariant bit, value and lexeme */
+    enum { COUNT = 200 };
+    static char lexeme[] = "x";
+    TokenMemory tokens[COUNT];
+    uint32_t types[COUNT];
+    uint32_t values[COUNT];
+    const void* lexemes[COUNT];
+    for (size_t i = 0; i < COUNT; i++) {
+        uint32_t r = next_random();
+        tokens[i] = (TokenMemory){
+            .token_type = (r & 1 ? 0x80000000u : 0) | (r >> 8) % 5,
+            .token_value = r & 2 ? (r >> 16) : 0,
+            .memory_value = r & 4 ? lexeme : NULL,
+        };
+        types[i] = tokens[i].token_type;
+        values[i] = tokens[i].token_value;
+        lexemes[i] = tokens[i].memory_value;
+    }
+
+    size_t counts[] = { 0, 1, 63, 64, 65, 128, COUNT };
+    uint64_t invariant[YODA_BITMAP_WORDS(COUNT)];
+    uint64_t truth[YODA_BITMAP_WORDS(COUNT)];
+    for (int flags = 0; flags < 4; flags++) {
+        YodaConfig config = {
+            .reverse_condition_order = true,
+            .null_nil_semantics = flags & 1,
+            .invariant_slicing = flags & 2,
+        };
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+            size_t count = counts[c];
+            size_t expected = 0;
+            for (size_t i = 0; i < count; i++) {
+                expected += rift_tb_yoda_evaluate(parser, &tokens[i], &config) ==
+                            YODA_EVAL_INVARIANT;
+            }
+
+            memset(invariant, 0xff, sizeof(invariant));
+            memset(truth, 0xff, sizeof(truth));
+            TEST_ASSERT(rift_tb_yoda_evaluate_batch(parser, tokens, count, &config,
+                                                    invariant, truth) == expected,
+                        "Batch invariant count");
+            TEST_ASSERT(batch_matches(parser, tokens, count, &config, invariant, truth),
+                        "Batch bitmaps");
+
+            memset(invariant, 0xff, sizeof(invariant));
+            memset(truth, 0xff, sizeof(truth));
+            TEST_ASSERT(rift_tb_yoda_evaluate_columns(parser, types, values, lexemes, count,
+                                                      &config, invariant, truth) == expected,
+                        "Column invariant count");
+            TEST_ASSERT(batch_matches(parser, tokens, count, &config, invariant, truth),
+                        "Column bitmaps");
+        }
+    }
+
+    /* Either bitmap may be left out */
+    TEST_ASSERT(rift_tb_yoda_evaluate_batch(parser, tokens, COUNT, NULL, NULL, truth) ==
+                rift_tb_yoda_evaluate_batch(parser, tokens, COUNT, NULL, invariant, NULL),
+                "Optional bitmaps");
+
+    /* A dual-mode parse leaves the bitmaps of its output */
+    const char* input = "ab 12 cd 0 ef";
+    TokenMemory* output = NULL;
+    size_t count = 0;
+    const uint64_t* parse_invariant = NULL;
+    const uint64_t* parse_truth = NULL;
+    TEST_ASSERT(rift_tb_parse_input(parser, input, strlen(input), &output, &count) == 0,
+                "Dual-mode parse");
+    TEST_ASSERT(rift_tb_yoda_bitmaps(parser, &parse_invariant, &parse_truth), "Parse bitmaps");
+    TEST_ASSERT(batch_matches(parser, output, count, NULL, parse_invariant, parse_truth),
+                "Parse bitmaps match the evaluator");
+
+    free(output);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("YODA batch");
+}
+
+/* Halve down to single tokens; every token is reached once, at its
+ * source index */
+static bool halves_cover(const TokenSliceView* view, const TokenMemory* base, size_t* seen) {
+    if (view->count == 0) return true;
+    if (view->tokens != base + view->start || view->mid != view->count / 2) return false;
+    if (view->count == 1) {
+        seen[view->start]++;
+        return true;
+    }
+
+    TokenSliceView first;
+    TokenSliceView second;
+    rift_tb_view_halves(view, &first, &second);
+    if (first.start != view->start || first.count != view->mid) return false;
+    if (second.start != view->start + view->mid ||
+        second.count != view->count - view->mid) {
+        return false;
+    }
+    return halves_cover(&first, base, seen) && halves_cover(&second, base, seen);
+}
+
+/**
+ * Test: views, slices and halves keep source indices
+ */
+static bool test_token_views(void) {
+    enum { COUNT = 37 };
+    TokenMemory tokens[COUNT];
+    for (size_t i = 0; i < COUNT; i++) {
+        tokens[i] = (TokenMemory){ .token_type = (uint32_t)i };
+    }
+
+    TokenSliceView view;
+    TEST_ASSERT(!rift_tb_token_view(tokens, COUNT, 5, 5, &view), "Empty range rejected");
+    TEST_ASSERT(!rift_tb_token_view(tokens, COUNT, 0, COUNT + 1, &view), "Overrun rejected");
+    TEST_ASSERT(!rift_tb_token_view(NULL, COUNT, 0, 1, &view), "Missing array rejected");
+
+    TEST_ASSERT(rift_tb_token_view(tokens, COUNT, 3, 30, &view), "View");
+    TEST_ASSERT(view.tokens == tokens + 3 && view.start == 3 && view.count == 27 &&
+                view.mid == 13, "View of [3, 30)");
+    TEST_ASSERT(rift_tb_view_in_first_half(&view, 12) && !rift_tb_view_in_first_half(&view, 13),
+                "Half membership by index");
+
+    /* A slice of a slice still knows where it sits in the array */
+    TokenSliceView sub;
+    TokenSliceView subsub;
+    TEST_ASSERT(rift_tb_view_slice(&view, 4, 20, &sub), "Slice");
+    TEST_ASSERT(sub.start == 7 && sub.count == 16 && sub.tokens[0].token_type == 7,
+                "Slice of [7, 23)");
+    TEST_ASSERT(rift_tb_view_slice(&sub, 15, 16, &subsub), "Slice of slice");
+    TEST_ASSERT(subsub.start == 22 && subsub.count == 1 && subsub.tokens[0].token_type == 22,
+                "Slice of [22, 23)");
+    TEST_ASSERT(!rift_tb_view_slice(&sub, 10, 17, &subsub), "Slice past the view rejected");
+
+    /* Halving a one-token view gives an empty first half */
+    TokenSliceView first;
+    TokenSliceView second;
+    rift_tb_view_halves(&subsub, &first, &second);
+    TEST_ASSERT(first.count == 0 && second.count == 1 && second.start == 22,
+                "One-token halves");
+
+    size_t seen[COUNT] = { 0 };
+    TEST_ASSERT(rift_tb_token_view(tokens, COUNT, 0, COUNT, &view), "Whole view");
+    TEST_ASSERT(halves_cover(&view, tokens, seen), "Halves keep indices");
+    for (size_t i = 0; i < COUNT; i++) {
+        TEST_ASSERT(seen[i] == 1, "Every token in exactly one leaf");
+    }
+
+    TEST_PASS("Token views");
+}
+
+/**
+ * Test: an invariant slice of a parse views that output in place, its
+ * halves split at mid, and leaves the token types unmarked
+ */
+static bool test_invariant_slice(void) {
+    DualModeParser* parser = split_parser();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+
+    char input[600];
+    size_t length = mixed_input(input, sizeof(input));
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    TEST_ASSERT(rift_tb_parse_input(parser, input, length, &tokens, &count) == 0, "Parse");
+    TEST_ASSERT(count > 40, "Enough tokens");
+
+    TokenMemory before[40];
+    memcpy(before, tokens, 40 * sizeof(TokenMemory));
+
+    TokenSliceView view;
+    TEST_ASSERT(rift_tb_invariant_slice(parser, tokens, count, 5, 40, &view), "Slice");
+    TEST_ASSERT(view.tokens == tokens + 5 && view.start == 5 && view.count == 35 &&
+                view.mid == 17, "Slice of [5, 40) over the output");
+    TEST_ASSERT(memcmp(before, tokens, 40 * sizeof(TokenMemory)) == 0, "Output unmarked");
+
+    /* Lexemes in the halves are the parse's, at their source indices */
+    TokenSliceView first;
+    TokenSliceView second;
+    rift_tb_view_halves(&view, &first, &second);
+    TEST_ASSERT(first.start == 5 && first.count == 17 && second.start == 22 &&
+                second.count == 18, "Halves at mid");
+    TEST_ASSERT(first.tokens[0].lexeme_start == tokens[5].lexeme_start &&
+                second.tokens[0].memory_value == input + tokens[22].lexeme_start,
+                "Halves view the parse output");
+    for (size_t i = 0; i < view.count; i++) {
+        TEST_ASSERT(rift_tb_view_in_first_half(&view, i) == (i < 17), "Half by index");
+    }
+
+    TEST_ASSERT(!rift_tb_invariant_slice(parser, tokens, count, 5, count + 1, &view),
+                "Range past the output rejected");
+    TEST_ASSERT(!rift_tb_invariant_slice(parser, tokens, count, 7, 7, &view),
+                "Empty range rejected");
+    parser->yoda_config.invariant_slicing = false;
+    TEST_ASSERT(!rift_tb_invariant_slice(parser, tokens, count, 5, 40, &view),
+                "Off without invariant slicing");
+
+    free(tokens);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Invariant slice");
+}
+
+enum { BLOCK_COUNT = 8000, BLOCK_TOKENS = 6, BAD_BLOCK = 5000 };
+
+/* BLOCK_COUNT one-line functions; BAD_BLOCK, when asked for, has a
+ * second name the rules reject */
+static char* block_source(size_t* length, bool with_bad_block) {
+    char* source = malloc(BLOCK_COUNT * 16 + 1);
+    if (!source) return NULL;
+    size_t n = 0;
+    for (size_t b = 0; b < BLOCK_COUNT; b++) {
+        const char* text = with_bad_block && b == BAD_BLOCK ? "fn { a b c } x\n"
+                                                            : "fn { a b c }\n";
+        n += (size_t)sprintf(source + n, "%s", text);
+    }
+    *length = n;
+    return source;
+}
+
+/* The output of one parse_blocks call and the shape of its tree */
+static bool blocks_ok(DualModeParser* parser, RiftWorkPool* pool,
+                      const char* source, size_t length) {
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    if (rift_tb_parse_blocks(parser, pool, source, length, &tokens, &count) != 0) return false;
+
+    /* Not capped at memory_size, and every token where a full lex puts it */
+    static const uint32_t types[BLOCK_TOKENS] = { 2, 0, 2, 2, 2, 1 };
+    bool ok = count == BLOCK_COUNT * BLOCK_TOKENS;
+    for (size_t i = 0; ok && i < count; i++) {
+        size_t line = i / BLOCK_TOKENS * 13;
+        ok = tokens[i].token_type == types[i % BLOCK_TOKENS] &&
+             tokens[i].lexeme_start >= line && tokens[i].lexeme_end <= line + 13 &&
+             tokens[i].memory_value == source + tokens[i].lexeme_start;
+    }
+
+    /* One tree root per block, over that block's tokens */
+    const FlatTree* tree = rift_tb_parse_tree(parser);
+    size_t roots = 0;
+    for (uint32_t node = tree && tree->count ? 0 : FLAT_TREE_NONE;
+         ok && node != FLAT_TREE_NONE; node = flat_tree_next_sibling(tree, node)) {
+        ok = tree->nodes[node].first_token == roots * BLOCK_TOKENS &&
+             tree->nodes[node].end_token == (roots + 1) * BLOCK_TOKENS;
+        roots++;
+    }
+    ok = ok && roots == BLOCK_COUNT;
+
+    free(tokens);
+    return ok;
+}
+
+/**
+ * Test: blocks on a pool and on the calling thread give one result
+ */
+static bool test_parse_blocks(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    TEST_ASSERT(rift_tb_add_terminal(parser, "LBRACE", "\\{", "[tb]") &&
+                rift_tb_add_terminal(parser, "RBRACE", "\\}", "[tb]") &&
+                rift_tb_add_terminal(parser, "NAME", "[a-z]+", "[tb]"), "Terminals");
+    TEST_ASSERT(rift_tb_add_rule(parser, "unit  : NAME LBRACE items RBRACE ;\n"
+                                         "items : items NAME | ;\n"), "Rules");
+
+    size_t length = 0;
+    char* source = block_source(&length, false);
+    TEST_ASSERT(source != NULL, "Source");
+
+    RiftWorkPool* pool = rift_workpool_create(3);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    /* Pool sizes change the regex sets, so alternate them */
+    for (int round = 0; round < 3; round++) {
+        TEST_ASSERT(blocks_ok(parser, NULL, source, length), "Blocks without a pool");
+        TEST_ASSERT(blocks_ok(parser, pool, source, length), "Blocks on a pool");
+    }
+
+    /* One rejected block drops the tree and is reported by token */
+    free(source);
+    source = block_source(&length, true);
+    TEST_ASSERT(source != NULL, "Source with a bad block");
+    RiftWorkPool* pools[] = { NULL, pool };
+    for (size_t p = 0; p < 2; p++) {
+        TokenMemory* tokens = NULL;
+        size_t count = 0;
+        TEST_ASSERT(rift_tb_parse_blocks(parser, pools[p], source, length, &tokens, &count) == 0,
+                    "Blocks parse");
+        TEST_ASSERT(count == BLOCK_COUNT * BLOCK_TOKENS + 1, "Every token kept");
+        TEST_ASSERT(rift_tb_parse_tree(parser) == NULL, "No tree");
+        TEST_ASSERT(parser->bu_state.error_token == (BAD_BLOCK + 1) * BLOCK_TOKENS,
+                    "Error at the extra name");
+        free(tokens);
+    }
+
+    rift_workpool_destroy(pool);
+    free(source);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Parse blocks");
+}
+
+/* Keeps what it is given, up to limit tokens in all */
+typedef struct {
+    TokenMemory tokens[4096];
+    bool consensus[4096];
+    size_t count;
+    size_t limit;
+    size_t calls;
+    size_t reduced_end;         /* Furthest token a reduction covered */
+} Collector;
+
+static size_t collect(const TokenMemory* tokens, size_t count,
+                      const uint64_t* consensus, void* user_data) {
+    Collector* c = (Collector*)user_data;
+    size_t take = c->limit - c->count < count ? c->limit - c->count : count;
+    for (size_t i = 0; i < take; i++) {
+        c->tokens[c->count] = tokens[i];
+        c->consensus[c->count] = consensus && bit_set(consensus, i);
+        c->count++;
+    }
+    c->calls++;
+    return take;
+}
+
+static void note_reduction(uint32_t production, size_t first, size_t end, void* user_data) {
+    Collector* c = (Collector*)user_data;
+    (void)production;
+    (void)first;
+    if (end > c->reduced_end) c->reduced_end = end;
+}
+
+/**
+ * Test: streamed batches match a whole parse, and a sink that stops
+ * early is credited with what it took and nothing more
+ */
+static bool test_stream_sink(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    TEST_ASSERT(rift_tb_add_terminal(parser, "NUM", "[0-9]+", "[tb]") &&
+                rift_tb_add_terminal(parser, "WORD", "[a-z]+", "[b]"), "Terminals");
+    TEST_ASSERT(rift_tb_add_rule(parser, "list : list item | item ;\n"
+                                         "item : NUM | WORD ;\n"), "Rules");
+
+    static char input[8000];
+    size_t length = mixed_input(input, sizeof(input));
+    TokenMemory* whole = NULL;
+    size_t whole_count = 0;
+    TEST_ASSERT(rift_tb_parse_input(parser, input, length, &whole, &whole_count) == 0,
+                "Whole parse");
+    TEST_ASSERT(rift_tb_parse_tree(parser) != NULL, "Whole parse accepted");
+    const uint64_t* consensus = NULL;
+    rift_tb_consensus_bitmap(parser, &consensus);
+    uint64_t expected[YODA_BITMAP_WORDS(4096)];
+    memcpy(expected, consensus, YODA_BITMAP_WORDS(whole_count) * sizeof(uint64_t));
+
+    static Collector c;
+    memset(&c, 0, sizeof(c));
+    c.limit = SIZE_MAX;
+    size_t count = 0;
+    rift_tb_set_reduce_handler(parser, note_reduction, &c);
+    TEST_ASSERT(rift_tb_parse_stream(parser, input, length, collect, &c, 100, &count) == 0,
+                "Stream");
+    TEST_ASSERT(count == whole_count && c.count == whole_count, "Every token streamed");
+    TEST_ASSERT(c.calls == (whole_count + 99) / 100, "Batches of 100");
+    TEST_ASSERT(parser->bu_state.accepted, "Grammar accepted the stream");
+    TEST_ASSERT(same_tokens(c.tokens, c.count, whole, whole_count, input, false),
+                "Stream matches the whole parse");
+    for (size_t i = 0; i < whole_count; i++) {
+        TEST_ASSERT(c.consensus[i] == bit_set(expected, i), "Consensus per batch");
+    }
+
+    /* Stopping part way through the third batch */
+    memset(&c, 0, sizeof(c));
+    c.limit = 250;
+    TEST_ASSERT(rift_tb_parse_stream(parser, input, length, collect, &c, 100, &count) == -1,
+                "Stopped stream");
+    TEST_ASSERT(c.calls == 3 && c.count == 250, "Sink stopped after 250");
+    TEST_ASSERT(count == 250, "Only taken tokens counted");
+    TEST_ASSERT(c.reduced_end <= 250, "Grammar saw no token the sink refused");
+    TEST_ASSERT(!parser->bu_state.accepted && parser->bu_state.error_token == 250,
+                "Stopped where the sink did");
+
+    free(whole);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Stream sink");
+}
+
+typedef struct {
+    DualModeParser* parser;
+    RiftTbRing* ring;
+    const char* input;
+    size_t length;
+    size_t count;
+    int result;
+} Producer;
+
+static void* produce(void* arg) {
+    Producer* p = (Producer*)arg;
+    p->result = rift_tb_parse_stream(p->parser, p->input, p->length, rift_tb_ring_sink,
+                                     p->ring, 64, &p->count);
+    rift_tb_ring_close(p->ring);
+    return NULL;
+}
+
+/* Pop until the ring is drained or stop tokens arrived, then cancel;
+ * every lexeme copy received is checked and freed */
+static size_t consume(Producer* p, size_t stop, bool* intact) {
+    TokenMemory batch[50];
+    size_t received = 0;
+    size_t n;
+    *intact = true;
+    while (received < stop && (n = rift_tb_ring_pop(p->ring, batch, 50)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            const char* lexeme = (const char*)batch[i].memory_value;
+            size_t span = batch[i].lexeme_end - batch[i].lexeme_start;
+            if (strlen(lexeme) != span ||
+                memcmp(lexeme, p->input + batch[i].lexeme_start, span) != 0) {
+                *intact = false;
+            }
+            free(batch[i].memory_value);
+        }
+        received += n;
+    }
+    if (received < stop) return received;
+    rift_tb_ring_cancel(p->ring);
+    return received;
+}
+
+/**
+ * Test: a consumer thread drains a streamed parse through the ring,
+ * and cancelling stops the parse
+ */
+static bool test_stream_ring(void) {
+    DualModeParser* parser = split_parser();
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    rift_tb_set_copy_lexemes(parser, true);
+
+    /* Far past memory_size; the stream is not capped */
+    size_t size = 200000;
+    char* input = malloc(size);
+    TEST_ASSERT(input != NULL, "Input");
+    size_t length = mixed_input(input, size);
+    size_t expected = 0;
+    for (size_t i = 0; i < length; i++) {
+        expected += input[i] != ' ' && (i == 0 || input[i - 1] == ' ');
+    }
+
+    for (int cancel = 0; cancel < 2; cancel++) {
+        Producer p = { parser, rift_tb_ring_create(100, true), input, length, 0, 0 };
+        TEST_ASSERT(p.ring != NULL, "Ring creation");
+
+        pthread_t thread;
+        TEST_ASSERT(pthread_create(&thread, NULL, produce, &p) == 0, "Producer thread");
+        bool intact = false;
+        size_t received = consume(&p, cancel ? 5000 : SIZE_MAX, &intact);
+        pthread_join(thread, NULL);
+
+        TEST_ASSERT(intact, "Lexemes arrive intact");
+        if (cancel) {
+            /* The parse counts what the ring took, some of which the
+             * cancel dropped; at most a ring's worth, rounded up */
+            TEST_ASSERT(p.result == -1, "Cancel stops the parse");
+            TEST_ASSERT(received >= 5000 && p.count >= received && p.count <= received + 128,
+                        "Count is what the ring accepted");
+            TEST_ASSERT(p.count < expected, "Parse ended early");
+        } else {
+            TEST_ASSERT(p.result == 0, "Whole stream");
+            TEST_ASSERT(p.count == expected && received == expected, "Every token received");
+        }
+        rift_tb_ring_destroy(p.ring);
+    }
+
+    free(input);
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Stream ring");
+}
+
+static bool token_is(const TokenMemory* token, const char* input, const char* text) {
+    size_t length = token->lexeme_end - token->lexeme_start;
+    return length == strlen(text) && memcmp(input + token->lexeme_start, text, length) == 0;
+}
+
+/* The comment tokens of g_comment_input, spanning lines */
+static const char g_comment_input[] = "a { /* one\ntwo */ b }\nc { d /* x\n\ny */ }\n";
+
+static bool comments_whole(const TokenMemory* tokens, size_t count) {
+    return count == 10 &&
+           token_is(&tokens[2], g_comment_input, "/* one\ntwo */") &&
+           token_is(&tokens[8], g_comment_input, "/* x\n\ny */");
+}
+
+/**
+ * Test: without line matching a token spans lines in every parse path;
+ * with it, matches stop at line ends and a reparse keeps earlier lines
+ */
+static bool test_multiline_tokens(void) {
+    const char* const patterns[] = { COMMENT_PATTERN, "[a-z]+", "[{}]", NULL };
+    size_t length = strlen(g_comment_input);
+
+    for (size_t m = 0; m < sizeof(g_modes) / sizeof(g_modes[0]); m++) {
+        DualModeParser* parser = pattern_parser(patterns, "[tb]", g_modes[m], false);
+        TEST_ASSERT(parser != NULL, "Parser creation");
+        TokenMemory* tokens = NULL;
+        size_t count = 0;
+        TEST_ASSERT(rift_tb_parse_input(parser, g_comment_input, length, &tokens, &count) == 0,
+                    "Parse");
+        TEST_ASSERT(comments_whole(tokens, count), "Comments whole in a parse");
+        free(tokens);
+        rift_tb_parser_destroy(parser);
+    }
+
+    DualModeParser* parser = pattern_parser(patterns, "[tb]", PARSE_MODE_DUAL, false);
+    TEST_ASSERT(parser != NULL, "Parser creation");
+    TokenMemory* tokens = NULL;
+    size_t count = 0;
+    TEST_ASSERT(rift_tb_parse_blocks(parser, NULL, g_comment_input, length, &tokens, &count) == 0,
+                "Blocks parse");
+    TEST_ASSERT(comments_whole(tokens, count), "Comments whole in blocks");
+    free(tokens);
+
+    static Collector c;
+    memset(&c, 0, sizeof(c));
+    c.limit = SIZE_MAX;
+    TEST_ASSERT(rift_tb_parse_stream(parser, g_comment_input, length, collect, &c, 4, &count) == 0,
+                "Stream");
+    TEST_ASSERT(comments_whole(c.tokens, c.count), "Comments whole in a stream");
+    rift_tb_parser_destroy(parser);
+
+    /* A newline the pattern names still ends the match with line matching */
+    const char* const spaces[] = { "[a-z]+", "[[:space:]]+", NULL };
+    const char* text = "ab \n\ncd";
+    for (int lines = 0; lines < 2; lines++) {
+        parser = pattern_parser(spaces, lines ? "m[b]" : "[b]", PARSE_MODE_BOTTOM_UP, false);
+        TEST_ASSERT(parser != NULL, "Parser creation");
+        TEST_ASSERT(rift_tb_parse_input(parser, text, strlen(text), &tokens, &count) == 0,
+                    "Parse");
+        if (lines) {
+            TEST_ASSERT(count == 4 && token_is(&tokens[1], text, " \n") &&
+                        token_is(&tokens[2], text, "\n"), "Runs cut at line ends");
+        } else {
+            TEST_ASSERT(count == 3 && token_is(&tokens[1], text, " \n\n"), "Run spans lines");
+        }
+        free(tokens);
+        rift_tb_parser_destroy(parser);
+    }
+
+    /* Line matching keeps the lines before an edit; otherwise only the
+     * stream after it can be reused */
+    const char* before = "ab cd\nef gh\nij";
+    const char* after = "ab cd\nef gh\nijk";
+    RiftTbEdit edit = { 14, 14, 15 };
+    for (int lines = 0; lines < 2; lines++) {
+        parser = pattern_parser(g_keyword_patterns, lines ? "m[tb]" : "[tb]",
+                                PARSE_MODE_BOTTOM_UP, false);
+        TEST_ASSERT(parser != NULL, "Parser creation");
+        TEST_ASSERT(rift_tb_parse_input(parser, before, strlen(before), &tokens, &count) == 0,
+                    "Parse");
+        size_t reused = atomic_load(&parser->stats.reused_tokens);
+        TEST_ASSERT(rift_tb_reparse(parser, after, strlen(after), &edit, tokens, &count) == 0,
+                    "Reparse");
+        reused = atomic_load(&parser->stats.reused_tokens) - reused;
+        TEST_ASSERT(count == 11, "Every letter a token");
+        TEST_ASSERT(reused == (lines ? 8u : 0u), "Earlier lines kept only with line matching");
+        free(tokens);
+        rift_tb_parser_destroy(parser);
+    }
+
+    TEST_PASS("Multi-line tokens");
+}
+
+#define PARITY_THREADS      8
+#define PARITY_TURNS        20000
+
+typedef struct {
+    ParityEliminator* elim;
+    size_t thread_index;
+    long* counter;                   /* Guarded only by the parity lock */
+    atomic_int* inside;
+    atomic_bool* overlapped;
+} ParityWorker;
+
+static void* parity_worker(void* arg) {
+    ParityWorker* w = (ParityWorker*)arg;
+    bool topdown = true;
+
+    for (int i = 0; i < PARITY_TURNS; i++) {
+        /* A mismatch fails without holding the lock; try the other mode */
+        while (!rift_tb_acquire_parity(w->elim, w->thread_index, topdown)) {
+            topdown = !topdown;
+        }
+        if (atomic_fetch_add(w->inside, 1) != 0) atomic_store(w->overlapped, true);
+        long value = *(volatile long*)w->counter;
+        if ((i & 63) == 0) sched_yield();
+        *(volatile long*)w->counter = value + 1;
+        atomic_fetch_sub(w->inside, 1);
+        rift_tb_release_parity(w->elim, w->thread_index);
+    }
+    return NULL;
+}
+
+/**
+ * Test: threads on both parity indices never hold a turn at once
+ */
+static bool test_parity_exclusion(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    TEST_ASSERT(parser != NULL && parser->parity_elim != NULL, "Parser creation");
+
+    long counter = 0;
+    atomic_int inside;
+    atomic_bool overlapped;
+    atomic_init(&inside, 0);
+    atomic_init(&overlapped, false);
+
+    pthread_t threads[PARITY_THREADS];
+    ParityWorker workers[PARITY_THREADS];
+    for (int i = 0; i < PARITY_THREADS; i++) {
+        workers[i] = (ParityWorker){ parser->parity_elim, (size_t)i % THREAD_PAIR_COUNT,
+                                     &counter, &inside, &overlapped };
+        pthread_create(&threads[i], NULL, parity_worker, &workers[i]);
+    }
+    for (int i = 0; i < PARITY_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    TEST_ASSERT(!atomic_load(&overlapped), "One parity turn at a time");
+    TEST_ASSERT(counter == (long)PARITY_THREADS * PARITY_TURNS, "No increment lost");
+    TEST_ASSERT(atomic_load(&parser->parity_elim->parity_lock) == 0, "Lock free afterwards");
+
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Parity exclusion");
+}
+
+/**
+ * Test: walking the tbtbbt pattern, a matching turn flips only its own
+ * parity bit on release and a mismatch fails with the lock released
+ */
+static bool test_parity_sequence(void) {
+    DualModeParser* parser = rift_tb_parser_create();
+    TEST_ASSERT(parser != NULL && parser->parity_elim != NULL, "Parser creation");
+    ParityEliminator* elim = parser->parity_elim;
+    TEST_ASSERT(atomic_load(&elim->parity_state) == PARITY_PATTERN, "Initial pattern");
+
+    int mismatches = 0;
+    for (size_t index = 0; index < THREAD_PAIR_COUNT; index++) {
+        for (const char* step = TB_PATTERN_STR; *step; step++) {
+            bool topdown = *step == 't';
+            uint32_t before = (uint32_t)atomic_load(&elim->parity_state);
+            uint32_t bit = 1u << index;
+            bool expected = ((before & bit) != 0) == topdown;
+
+            bool acquired = rift_tb_acquire_parity(elim, index, topdown);
+            TEST_ASSERT(acquired == expected, "Turn granted only on matching parity");
+            if (!acquired) {
+                mismatches++;
+                TEST_ASSERT(atomic_load(&elim->parity_lock) == 0, "Mismatch releases the lock");
+                TEST_ASSERT(atomic_load(&elim->parity_state) == before, "Mismatch keeps parity");
+                continue;
+            }
+
+            TEST_ASSERT(atomic_load(&elim->parity_lock) != 0, "Turn holds the lock");
+            TEST_ASSERT(elim->thread_is_topdown[index] == topdown, "Turn records its mode");
+            rift_tb_release_parity(elim, index);
+            TEST_ASSERT(atomic_load(&elim->parity_lock) == 0, "Release frees the lock");
+            TEST_ASSERT(atomic_load(&elim->parity_state) == (before ^ bit), "Release flips one bit");
+        }
+    }
+
+    /* From 101001, index 0 misses the second b and index 1 the first t and second b */
+    TEST_ASSERT(mismatches == 3, "Mismatches where the pattern disagrees");
+    TEST_ASSERT(!rift_tb_acquire_parity(elim, THREAD_PAIR_COUNT, true), "Index out of range");
+
+    rift_tb_parser_destroy(parser);
+    TEST_PASS("Parity sequence");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,210 @@
+/**
+ * =================================================================
+ * test_telemetry.c - RIFT-0 Telemetry Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Per-thread telemetry rings and aggregation
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_spawn_hierarchy(void);
+static bool test_concurrent_heartbeats(void);
+static bool test_ring_reuse(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Telemetry Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    if (rift_telemetry_init() != 0) {
+        printf("Could not start telemetry\n");
+        return 1;
+    }
+
+    run_test("Spawn Hierarchy", test_spawn_hierarchy);
+    run_test("Concurrent Heartbeats", test_concurrent_heartbeats);
+    run_test("Ring Reuse", test_ring_reuse);
+
+    rift_telemetry_print_report();
+    rift_telemetry_shutdown();
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+static uint64_t spawn(uint64_t parent, const char* location) {
+    rift_thread_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.telemetry.parent_rift_id = parent;
+    if (rift_telemetry_register_spawn(&context, location) != 0) return 0;
+    return context.telemetry.rift_thread_id;
+}
+
+/**
+ * Test: depth and child counts are derived from the parent chain
+ */
+static bool test_spawn_hierarchy(void) {
+    uint64_t root = spawn(0, "root");
+    uint64_t child = spawn(root, "child");
+    uint64_t grandchild = spawn(child, "grandchild");
+    TEST_ASSERT(root && child && grandchild, "Spawns registered");
+
+    rift_spawn_telemetry_t* t = rift_telemetry_get(grandchild);
+    TEST_ASSERT(t != NULL, "Grandchild visible immediately");
+    TEST_ASSERT(t->hierarchy_depth == 2, "Grandchild depth");
+    TEST_ASSERT(strcmp(t->spawn_location, "grandchild") == 0, "Spawn location kept");
+    TEST_ASSERT(rift_telemetry_get(root)->child_count == 1, "Root child count");
+    TEST_ASSERT(rift_telemetry_get(12345678) == NULL, "Unknown id");
+
+    rift_governance_policy_t policy;
+    memset(&policy, 0, sizeof(policy));
+    TEST_ASSERT(rift_telemetry_validate_spawn(root, &policy), "Default limits allow a child");
+
+    policy.max_children = 1;
+    TEST_ASSERT(!rift_telemetry_validate_spawn(root, &policy), "Child limit reached");
+
+    policy.max_children = 0;
+    policy.trace_capped = true;
+    policy.max_hierarchy_depth = 2;
+    TEST_ASSERT(rift_telemetry_validate_spawn(root, &policy), "Depth 1 within cap");
+    TEST_ASSERT(!rift_telemetry_validate_spawn(child, &policy), "Depth 2 over cap");
+    TEST_ASSERT(!rift_telemetry_validate_spawn(987654321, &policy), "Unknown parent");
+
+    TEST_PASS("Spawn hierarchy");
+}
+
+#define HEARTBEAT_THREADS 16
+#define HEARTBEATS_PER_THREAD 20000
+
+typedef struct {
+    uint64_t parent;
+    uint64_t id;
+    int beats;
+} HeartbeatWorker;
+
+static void* heartbeat_thread(void* arg) {
+    HeartbeatWorker* worker = (HeartbeatWorker*)arg;
+    worker->id = spawn(worker->parent, "heartbeat_thread");
+    for (int i = 0; i < worker->beats; i++) {
+        rift_telemetry_heartbeat(worker->id);
+    }
+    return NULL;
+}
+
+static bool run_workers(uint64_t parent, int beats, HeartbeatWorker* workers) {
+    pthread_t threads[HEARTBEAT_THREADS];
+    for (int i = 0; i < HEARTBEAT_THREADS; i++) {
+        workers[i].parent = parent;
+        workers[i].beats = beats;
+        if (pthread_create(&threads[i], NULL, heartbeat_thread, &workers[i]) != 0) return false;
+    }
+    for (int i = 0; i < HEARTBEAT_THREADS; i++) pthread_join(threads[i], NULL);
+    return true;
+}
+
+/**
+ * Test: every heartbeat from many threads is folded in or counted as dropped
+ */
+static bool test_concurrent_heartbeats(void) {
+    rift_telemetry_stats_t before, after;
+    rift_telemetry_get_stats(&before);
+
+    uint64_t parent = spawn(0, "heartbeat_parent");
+    HeartbeatWorker workers[HEARTBEAT_THREADS];
+    TEST_ASSERT(run_workers(parent, HEARTBEATS_PER_THREAD, workers), "Threads started");
+
+    rift_telemetry_get_stats(&after);
+    uint64_t sent = (uint64_t)HEARTBEAT_THREADS * HEARTBEATS_PER_THREAD;
+    TEST_ASSERT((after.heartbeats - before.heartbeats) + (after.dropped - before.dropped) == sent,
+                "No heartbeat unaccounted for");
+    TEST_ASSERT(after.registered - before.registered == HEARTBEAT_THREADS + 1,
+                "Spawns are never dropped");
+    TEST_ASSERT(rift_telemetry_get(parent)->child_count == HEARTBEAT_THREADS,
+                "Children counted across threads");
+
+    struct timespec when;
+    for (int i = 0; i < HEARTBEAT_THREADS; i++) {
+        TEST_ASSERT(rift_telemetry_last_heartbeat(workers[i].id, &when), "Heartbeat recorded");
+    }
+
+    TEST_PASS("Concurrent heartbeats");
+}
+
+/**
+ * Test: rings of exited threads are adopted instead of reallocated
+ */
+static bool test_ring_reuse(void) {
+    rift_telemetry_stats_t before, after;
+    HeartbeatWorker workers[HEARTBEAT_THREADS];
+
+    TEST_ASSERT(run_workers(0, 10, workers), "First wave");
+    rift_telemetry_get_stats(&before);
+
+    TEST_ASSERT(run_workers(0, 10, workers), "Second wave");
+    rift_telemetry_get_stats(&after);
+
+    TEST_ASSERT(after.threads == before.threads, "No new rings for the second wave");
+    TEST_ASSERT(rift_telemetry_get(workers[HEARTBEAT_THREADS - 1].id) != NULL,
+                "Adopted rings still deliver");
+
+    TEST_PASS("Ring reuse");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
@@ -0,0 +1,246 @@
+/**
+ * =================================================================
+ * test_token_cache.c - RIFT-0 Token Cache Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Content-addressed on-disk tokenization cache
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/lexer/token_cache.h"
+#include "rift-0/core/rift_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+static char g_cache_dir[256];
+
+/* Forward declarations */
+static bool test_hash_reference_values(void);
+static bool test_store_and_lookup(void);
+static bool test_ruleset_change_misses(void);
+static bool test_content_change_misses(void);
+static bool test_lru_eviction(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+static void remove_cache_dir(void);
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Token Cache Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    snprintf(g_cache_dir, sizeof(g_cache_dir), "/tmp/rift-token-cache-%ld",
+             (long)getpid());
+
+    run_test("Hash Reference Values", test_hash_reference_values);
+    run_test("Store And Lookup", test_store_and_lookup);
+    run_test("Rule-Set Change Misses", test_ruleset_change_misses);
+    run_test("Content Change Misses", test_content_change_misses);
+    run_test("LRU Eviction", test_lru_eviction);
+
+    remove_cache_dir();
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+static RiftTokenCache* open_cache(size_t max_bytes) {
+    RiftTokenCacheConfig config = { g_cache_dir, max_bytes };
+    return rift_token_cache_open(&config);
+}
+
+static void fill_tokens(TokenTriplet* tokens, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        tokens[i].type = (uint8_t)(i % 7);
+        tokens[i].mem_ptr = (uint16_t)(i * 3);
+        tokens[i].value = (uint8_t)i;
+    }
+}
+
+/**
+ * Test: digests match published XXH64 values, so keys are stable
+ */
+static bool test_hash_reference_values(void) {
+    TEST_ASSERT(rift_hash64("", 0, 0) == 0xEF46DB3751D8E999ULL,
+                "Empty input digest");
+    TEST_ASSERT(rift_hash64("abc", 3, 0) == 0x44BC2CF5AD770999ULL,
+                "Short input digest");
+    TEST_ASSERT(rift_hash64("abc", 3, 1) != rift_hash64("abc", 3, 0),
+                "Seed participates in digest");
+
+    TEST_PASS("Hash reference values");
+}
+
+/**
+ * Test: a stored stream is returned verbatim on the next lookup
+ */
+static bool test_store_and_lookup(void) {
+    const char* source = "let x = 42;";
+    TokenTriplet tokens[16];
+    fill_tokens(tokens, 16);
+
+    RiftTokenCache* cache = open_cache(0);
+    TEST_ASSERT(cache != NULL, "Cache opens");
+
+    RiftTokenCacheHit hit;
+    TEST_ASSERT(!rift_token_cache_lookup(cache, source, strlen(source), 1, &hit),
+                "Cold lookup misses");
+    TEST_ASSERT(rift_token_cache_store(cache, source, strlen(source), 1,
+                                       tokens, 16) == 0,
+                "Store succeeds");
+    TEST_ASSERT(rift_token_cache_lookup(cache, source, strlen(source), 1, &hit),
+                "Warm lookup hits");
+    TEST_ASSERT(hit.count == 16, "Token count preserved");
+    TEST_ASSERT(memcmp(hit.tokens, tokens, sizeof(tokens)) == 0,
+                "Token stream preserved");
+    rift_token_cache_release(&hit);
+
+    RiftTokenCacheStats stats;
+    rift_token_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.hits == 1 && stats.misses == 1 && stats.stores == 1,
+                "Statistics track hits, misses and stores");
+
+    rift_token_cache_close(cache);
+    TEST_PASS("Store and lookup");
+}
+
+/**
+ * Test: a different rule-set never reuses another rule-set's tokens
+ */
+static bool test_ruleset_change_misses(void) {
+    const char* source = "let x = 42;";
+    RiftTokenCache* cache = open_cache(0);
+    TEST_ASSERT(cache != NULL, "Cache opens");
+
+    RiftTokenCacheHit hit;
+    TEST_ASSERT(!rift_token_cache_lookup(cache, source, strlen(source), 2, &hit),
+                "Other rule-set misses");
+    TEST_ASSERT(rift_token_cache_ruleset_hash(NULL) ==
+                rift_token_cache_ruleset_hash(NULL),
+                "Rule-set hash is deterministic");
+
+    rift_token_cache_close(cache);
+    TEST_PASS("Rule-set change misses");
+}
+
+/**
+ * Test: editing the source invalidates the entry
+ */
+static bool test_content_change_misses(void) {
+    const char* source = "let x = 43;";
+    RiftTokenCache* cache = open_cache(0);
+    TEST_ASSERT(cache != NULL, "Cache opens");
+
+    RiftTokenCacheHit hit;
+    TEST_ASSERT(!rift_token_cache_lookup(cache, source, strlen(source), 1, &hit),
+                "Edited source misses");
+
+    rift_token_cache_close(cache);
+    TEST_PASS("Content change misses");
+}
+
+/**
+ * Test: the directory stays under budget, oldest entries leave first
+ */
+static bool test_lru_eviction(void) {
+    TokenTriplet tokens[256];
+    fill_tokens(tokens, 256);
+
+    /* Budget holds roughly four entries */
+    size_t entry_bytes = 64 + sizeof(tokens);
+    RiftTokenCache* cache = open_cache(entry_bytes * 4);
+    TEST_ASSERT(cache != NULL, "Cache opens");
+
+    char source[32];
+    for (int i = 0; i < 12; i++) {
+        snprintf(source, sizeof(source), "source-%d", i);
+        TEST_ASSERT(rift_token_cache_store(cache, source, strlen(source), 1,
+                                           tokens, 256) == 0,
+                    "Store succeeds");
+        usleep(2000);
+    }
+
+    RiftTokenCacheStats stats;
+    rift_token_cache_get_stats(cache, &stats);
+    TEST_ASSERT(stats.evictions > 0, "Entries were evicted");
+    TEST_ASSERT(stats.bytes_on_disk <= entry_bytes * 4, "Directory within budget");
+
+    RiftTokenCacheHit hit;
+    snprintf(source, sizeof(source), "source-%d", 0);
+    TEST_ASSERT(!rift_token_cache_lookup(cache, source, strlen(source), 1, &hit),
+                "Oldest entry evicted");
+    snprintf(source, sizeof(source), "source-%d", 11);
+    TEST_ASSERT(rift_token_cache_lookup(cache, source, strlen(source), 1, &hit),
+                "Newest entry retained");
+    rift_token_cache_release(&hit);
+
+    rift_token_cache_close(cache);
+    TEST_PASS("LRU eviction");
+}
+
+static void remove_cache_dir(void) {
+    DIR* dir = opendir(g_cache_dir);
+    if (!dir) return;
+
+    struct dirent* de;
+    char path[512];
+    while ((de = readdir(dir)) != NULL) {
+        if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0) continue;
+        snprintf(path, sizeof(path), "%s/%s", g_cache_dir, de->d_name);
+        unlink(path);
+    }
+    closedir(dir);
+    rmdir(g_cache_dir);
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
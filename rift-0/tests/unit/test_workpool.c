@@ -0,0 +1,298 @@
+/**
+ * =================================================================
+ * test_workpool.c - RIFT-0 Work-Stealing Pool Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Fork/join task execution for batch processing
+ * OBINexus Computing Framework - Aegis Project
+ * =================================================================
+ */
+
+#include "rift-0/core/rift_workpool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_flat_completion(void);
+static bool test_nested_tasks(void);
+static bool test_stealing(void);
+static bool test_placement(void);
+
+static void run_test(const char *test_name, bool (*test_func)(void));
+
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT-0 Work-Stealing Pool Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Flat Completion", test_flat_completion);
+    run_test("Nested Tasks", test_nested_tasks);
+    run_test("Stealing", test_stealing);
+    run_test("Placement", test_placement);
+
+    printf("\nTests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+    }
+
+    return g_test_suite.tests_failed == 0 ? 0 : 1;
+}
+
+static void increment_task(void* arg) {
+    atomic_fetch_add((atomic_int*)arg, 1);
+}
+
+/**
+ * Test: wait returns only after every submitted task ran
+ */
+static bool test_flat_completion(void) {
+    RiftWorkPool* pool = rift_workpool_create(4);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+    TEST_ASSERT(rift_workpool_worker_count(pool) == 4, "Worker count");
+    TEST_ASSERT(rift_workpool_current_worker(pool) == -1, "Caller is off-pool");
+
+    atomic_int counter;
+    atomic_init(&counter, 0);
+
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+    for (int i = 0; i < 10000; i++) {
+        TEST_ASSERT(rift_workpool_submit(pool, &group, increment_task, &counter) == 0,
+                    "Submit succeeds");
+    }
+    rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+
+    TEST_ASSERT(atomic_load(&counter) == 10000, "Every task executed once");
+
+    RiftWorkPoolStats stats;
+    rift_workpool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.executed == 10000, "Executed count");
+
+    rift_workpool_destroy(pool);
+    TEST_PASS("Flat completion");
+}
+
+typedef struct {
+    RiftWorkPool* pool;
+    RiftTaskGroup* group;
+    atomic_int* leaves;
+    int depth;
+} TreeNode;
+
+/* Each node fans out into two children until depth runs out */
+static void tree_task(void* arg) {
+    TreeNode* node = (TreeNode*)arg;
+
+    if (node->depth == 0) {
+        atomic_fetch_add(node->leaves, 1);
+        free(node);
+        return;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        TreeNode* child = malloc(sizeof(TreeNode));
+        *child = *node;
+        child->depth = node->depth - 1;
+        rift_workpool_submit(node->pool, node->group, tree_task, child);
+    }
+    free(node);
+}
+
+/**
+ * Test: tasks submitted from tasks belong to the same group
+ */
+static bool test_nested_tasks(void) {
+    RiftWorkPool* pool = rift_workpool_create(3);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    atomic_int leaves;
+    atomic_init(&leaves, 0);
+
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+
+    TreeNode* root = malloc(sizeof(TreeNode));
+    *root = (TreeNode){ pool, &group, &leaves, 12 };
+    TEST_ASSERT(rift_workpool_submit(pool, &group, tree_task, root) == 0, "Submit root");
+    rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+
+    TEST_ASSERT(atomic_load(&leaves) == 4096, "Wait covered nested tasks");
+
+    rift_workpool_destroy(pool);
+    TEST_PASS("Nested tasks");
+}
+
+typedef struct {
+    RiftWorkPool* pool;
+    RiftTaskGroup* group;
+    atomic_int* started;
+    atomic_int* workers_seen;
+} SpawnArgs;
+
+static void slow_task(void* arg) {
+    SpawnArgs* args = (SpawnArgs*)arg;
+    int worker = rift_workpool_current_worker(args->pool);
+    if (worker >= 0) {
+        atomic_fetch_or(args->workers_seen, 1 << worker);
+    }
+    atomic_fetch_add(args->started, 1);
+
+    /* Hold this worker until a sibling has started elsewhere */
+    for (int spins = 0; atomic_load(args->started) < 2 && spins < 1000000; spins++) {
+        sched_yield();
+    }
+}
+
+static void spawn_task(void* arg) {
+    SpawnArgs* args = (SpawnArgs*)arg;
+    for (int i = 0; i < 8; i++) {
+        rift_workpool_submit(args->pool, args->group, slow_task, args);
+    }
+}
+
+/**
+ * Test: work queued on one worker's deque is taken by others
+ */
+static bool test_stealing(void) {
+    RiftWorkPool* pool = rift_workpool_create(2);
+    TEST_ASSERT(pool != NULL, "Pool creation");
+
+    atomic_int started;
+    atomic_int workers_seen;
+    atomic_init(&started, 0);
+    atomic_init(&workers_seen, 0);
+
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+    SpawnArgs args = { pool, &group, &started, &workers_seen };
+
+    TEST_ASSERT(rift_workpool_submit(pool, &group, spawn_task, &args) == 0, "Submit spawner");
+    rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+
+    TEST_ASSERT(atomic_load(&started) == 8, "Every child ran");
+
+    /* Children all started on the spawner's deque; any other
+     * participant (second worker or the waiting caller) stole. */
+    RiftWorkPoolStats stats;
+    rift_workpool_get_stats(pool, &stats);
+    TEST_ASSERT(stats.stolen > 0, "Children were stolen");
+
+    rift_workpool_destroy(pool);
+    TEST_PASS("Stealing");
+}
+
+typedef struct {
+    atomic_int started;
+    int node[4];
+} StartLog;
+
+static void record_start(size_t worker, int node, void* user_data) {
+    StartLog* log = (StartLog*)user_data;
+    log->node[worker] = node;
+    atomic_fetch_add(&log->started, 1);
+}
+
+/**
+ * Test: pinned workers run the start hook and report per-node counts
+ */
+static bool test_placement(void) {
+    RiftWorkPoolConfig config;
+    memset(&config, 0, sizeof(config));
+    config.worker_count = 4;
+    config.placement.pin_policy = PIN_CORE_COMPACT;
+    strcpy(config.placement.cpu_list, "0");
+
+    StartLog log;
+    memset(&log, 0, sizeof(log));
+    atomic_init(&log.started, 0);
+    config.on_worker_start = record_start;
+    config.user_data = &log;
+
+    RiftWorkPool* pool = rift_workpool_create_with_config(&config);
+    TEST_ASSERT(pool != NULL, "Pool pinned to CPU 0");
+
+    atomic_int counter;
+    atomic_init(&counter, 0);
+    RiftTaskGroup group;
+    rift_task_group_init(&group);
+    for (int i = 0; i < 1000; i++) {
+        rift_workpool_submit(pool, &group, increment_task, &counter);
+    }
+    rift_workpool_wait(pool, &group);
+    rift_task_group_destroy(&group);
+
+    /* Workers that never ran a task may still be starting */
+    while (atomic_load(&log.started) < 4) sched_yield();
+    for (size_t i = 0; i < 4; i++) {
+        TEST_ASSERT(log.node[i] == rift_workpool_worker_node(pool, i), "Hook saw home node");
+    }
+
+    RiftWorkPoolStats stats;
+    rift_workpool_get_stats(pool, &stats);
+    RiftWorkPoolNodeStats nodes[RIFT_WORKPOOL_MAX_NODES];
+    size_t node_count = rift_workpool_get_node_stats(pool, nodes, RIFT_WORKPOOL_MAX_NODES);
+    TEST_ASSERT(node_count == 1, "Every worker on CPU 0's node");
+    TEST_ASSERT(nodes[0].workers == 4, "Node worker count");
+    TEST_ASSERT(nodes[0].remote == 0, "Pinned workers never ran remote");
+    TEST_ASSERT(nodes[0].executed <= stats.executed, "Caller-run tasks not attributed");
+
+    rift_workpool_destroy(pool);
+
+    /* Malformed or out-of-range CPU lists are rejected */
+    strcpy(config.placement.cpu_list, "0-x");
+    TEST_ASSERT(rift_workpool_create_with_config(&config) == NULL, "Malformed list");
+    strcpy(config.placement.cpu_list, "999999");
+    TEST_ASSERT(rift_workpool_create_with_config(&config) == NULL, "Out-of-range list");
+
+    TEST_PASS("Placement");
+}
+
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}